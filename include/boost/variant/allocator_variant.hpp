@@ -0,0 +1,340 @@
+//-----------------------------------------------------------------------------
+// boost variant/allocator_variant.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_ALLOCATOR_VARIANT_HPP
+#define BOOST_VARIANT_ALLOCATOR_VARIANT_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <memory> // for std::allocator_arg_t, std::allocator_traits
+#include <utility> // for std::forward
+
+#include <boost/variant/variant.hpp>
+#include <boost/variant/get.hpp>
+#include <boost/variant/detail/move.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/core/empty_value.hpp>
+#include <boost/mpl/begin_end.hpp>
+#include <boost/mpl/distance.hpp>
+#include <boost/mpl/find.hpp>
+#include <boost/mpl/not.hpp>
+#include <boost/mpl/or.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+#include <boost/utility/enable_if.hpp>
+
+namespace boost {
+
+///////////////////////////////////////////////////////////////////////////////
+// class template allocator_variant
+//
+// Variant of the bounded types T... that keeps an allocator and constructs
+// every content with it, by uses-allocator construction: on construction,
+// on copy and move, and on each assignment that changes the type of the
+// content. The contents that use Allocator (such as std::pmr containers
+// with std::pmr::polymorphic_allocator) then stay in its memory resource.
+//
+// As for the std::pmr containers, the allocator is not propagated by the
+// assignments, nor by swap (the allocators of the swapped variants must
+// compare equal), and a copy gets the allocator of
+// select_on_container_copy_construction. An allocator aware container of
+// allocator_variant passes its allocator to its elements.
+//
+template <typename Allocator, typename... T>
+class allocator_variant
+    : private boost::empty_value<Allocator>
+{
+public: // typedefs
+
+    typedef Allocator allocator_type;
+    typedef boost::variant<T...> variant_type;
+    typedef typename variant_type::types types;
+
+private: // representation
+
+    typedef boost::empty_value<Allocator> base_type;
+    typedef std::allocator_traits<Allocator> traits;
+
+    variant_type value_;
+
+private: // helpers
+
+    const allocator_type& allocator() const BOOST_NOEXCEPT
+    {
+        return base_type::get();
+    }
+
+    template <typename U>
+    struct is_self
+        : is_same<
+              typename remove_cv<typename remove_reference<U>::type>::type
+            , allocator_variant
+            >
+    {
+    };
+
+    template <typename U>
+    struct is_self_or_allocator
+        : mpl::or_<
+              is_self<U>
+            , is_same<
+                  typename remove_cv<typename remove_reference<U>::type>::type
+                , allocator_type
+                >
+            >
+    {
+    };
+
+    template <typename U>
+    struct bounded_index
+        : mpl::distance<
+              typename mpl::begin<types>::type
+            , typename mpl::find<types, U>::type
+            >
+    {
+    };
+
+    // Assigns in place a content of the same type, which keeps its memory,
+    // else constructs the new content with the allocator.
+
+    void assign_variant(const variant_type& rhs)
+    {
+        if (value_.which() == rhs.which())
+            value_ = rhs;
+        else
+            value_ = variant_type(std::allocator_arg, allocator(), rhs);
+    }
+
+    void assign_variant(variant_type&& rhs)
+    {
+        if (value_.which() == rhs.which())
+            value_ = detail::variant::move(rhs);
+        else
+            value_ = variant_type(std::allocator_arg, allocator(), detail::variant::move(rhs));
+    }
+
+    template <typename U>
+    void assign_value(U&& rhs, mpl::true_) // is bounded type
+    {
+        typedef typename remove_cv<typename remove_reference<U>::type>::type rhs_t;
+
+        if (value_.which() == bounded_index<rhs_t>::value)
+            boost::relaxed_get<rhs_t>(value_) = std::forward<U>(rhs);
+        else
+            value_ = variant_type(std::allocator_arg, allocator(), std::forward<U>(rhs));
+    }
+
+    template <typename U>
+    void assign_value(U&& rhs, mpl::false_) // is bounded type
+    {
+        value_ = variant_type(std::allocator_arg, allocator(), std::forward<U>(rhs));
+    }
+
+public: // structors
+
+    allocator_variant()
+        : base_type(boost::empty_init_t())
+        , value_(std::allocator_arg, allocator())
+    {
+    }
+
+    explicit allocator_variant(const allocator_type& a)
+        : base_type(boost::empty_init_t(), a)
+        , value_(std::allocator_arg, a)
+    {
+    }
+
+    allocator_variant(std::allocator_arg_t, const allocator_type& a)
+        : base_type(boost::empty_init_t(), a)
+        , value_(std::allocator_arg, a)
+    {
+    }
+
+    template <typename U>
+    allocator_variant(
+          U&& operand
+        , typename disable_if<is_self_or_allocator<U>, bool>::type = true
+        )
+        : base_type(boost::empty_init_t())
+        , value_(std::allocator_arg, allocator(), std::forward<U>(operand))
+    {
+    }
+
+    template <typename U>
+    allocator_variant(
+          std::allocator_arg_t
+        , const allocator_type& a
+        , U&& operand
+        , typename disable_if<is_self<U>, bool>::type = true
+        )
+        : base_type(boost::empty_init_t(), a)
+        , value_(std::allocator_arg, a, std::forward<U>(operand))
+    {
+    }
+
+    allocator_variant(const allocator_variant& operand)
+        : base_type(
+              boost::empty_init_t()
+            , traits::select_on_container_copy_construction(operand.get_allocator())
+            )
+        , value_(std::allocator_arg, allocator(), operand.value_)
+    {
+    }
+
+    // The contents of operand were constructed with the same allocator.
+    allocator_variant(allocator_variant&& operand)
+        : base_type(boost::empty_init_t(), operand.get_allocator())
+        , value_(detail::variant::move(operand.value_))
+    {
+    }
+
+    allocator_variant(std::allocator_arg_t, const allocator_type& a, const allocator_variant& operand)
+        : base_type(boost::empty_init_t(), a)
+        , value_(std::allocator_arg, a, operand.value_)
+    {
+    }
+
+    allocator_variant(std::allocator_arg_t, const allocator_type& a, allocator_variant&& operand)
+        : base_type(boost::empty_init_t(), a)
+        , value_(std::allocator_arg, a, detail::variant::move(operand.value_))
+    {
+    }
+
+public: // modifiers
+
+    allocator_variant& operator=(const allocator_variant& rhs)
+    {
+        if (this != &rhs)
+            assign_variant(rhs.value_);
+        return *this;
+    }
+
+    allocator_variant& operator=(allocator_variant&& rhs)
+    {
+        if (this != &rhs)
+            assign_variant(detail::variant::move(rhs.value_));
+        return *this;
+    }
+
+    allocator_variant& operator=(const variant_type& rhs)
+    {
+        assign_variant(rhs);
+        return *this;
+    }
+
+    allocator_variant& operator=(variant_type&& rhs)
+    {
+        assign_variant(detail::variant::move(rhs));
+        return *this;
+    }
+
+    template <typename U>
+    typename disable_if<
+          mpl::or_<
+              is_self<U>
+            , is_same<typename remove_cv<typename remove_reference<U>::type>::type, variant_type>
+            >
+        , allocator_variant&
+        >::type
+    operator=(U&& rhs)
+    {
+        typedef typename remove_cv<typename remove_reference<U>::type>::type rhs_t;
+        typedef typename mpl::not_<is_same<
+              typename mpl::find<types, rhs_t>::type
+            , typename mpl::end<types>::type
+            > >::type is_bounded;
+
+        assign_value(std::forward<U>(rhs), is_bounded());
+        return *this;
+    }
+
+    void swap(allocator_variant& operand)
+    {
+        BOOST_ASSERT(allocator() == operand.allocator());
+        value_.swap(operand.value_);
+    }
+
+public: // queries
+
+    int which() const BOOST_NOEXCEPT
+    {
+        return value_.which();
+    }
+
+    const variant_type& value() const BOOST_NOEXCEPT
+    {
+        return value_;
+    }
+
+    allocator_type get_allocator() const BOOST_NOEXCEPT
+    {
+        return allocator();
+    }
+
+public: // visitation
+
+    // The contents may be modified in place, not replaced.
+
+    template <typename Visitor>
+    typename Visitor::result_type apply_visitor(Visitor& visitor)
+    {
+        return value_.apply_visitor(visitor);
+    }
+
+    template <typename Visitor>
+    typename Visitor::result_type apply_visitor(const Visitor& visitor)
+    {
+        return boost::apply_visitor(visitor, value_);
+    }
+
+    template <typename Visitor>
+    typename Visitor::result_type apply_visitor(Visitor& visitor) const
+    {
+        return value_.apply_visitor(visitor);
+    }
+
+    template <typename Visitor>
+    typename Visitor::result_type apply_visitor(const Visitor& visitor) const
+    {
+        return boost::apply_visitor(visitor, value_);
+    }
+};
+
+// function template swap
+//
+// Swaps two allocator_variant objects of the same type.
+//
+template <typename Allocator, typename... T>
+inline void swap(allocator_variant<Allocator, T...>& lhs, allocator_variant<Allocator, T...>& rhs)
+{
+    lhs.swap(rhs);
+}
+
+template <typename Allocator, typename... T>
+inline bool operator==(const allocator_variant<Allocator, T...>& lhs, const allocator_variant<Allocator, T...>& rhs)
+{
+    return lhs.value() == rhs.value();
+}
+
+template <typename Allocator, typename... T>
+inline bool operator!=(const allocator_variant<Allocator, T...>& lhs, const allocator_variant<Allocator, T...>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+} // namespace boost
+
+#endif // BOOST_VARIANT_ALLOCATOR_VARIANT_HPP
@@ -0,0 +1,546 @@
+//-----------------------------------------------------------------------------
+// boost variant/atomic_variant.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_ATOMIC_VARIANT_HPP
+#define BOOST_VARIANT_ATOMIC_VARIANT_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <atomic>
+#include <cstddef> // for std::size_t
+#include <cstring> // for std::memcpy
+
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/variant/variant.hpp>
+#include <boost/variant/static_visitor.hpp>
+#include <boost/variant/detail/index_sequence.hpp>
+
+#include <boost/mpl/at.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_empty.hpp>
+#include <boost/type_traits/is_reference.hpp>
+#include <boost/type_traits/is_trivially_copyable.hpp>
+
+// The 16 byte words go through cmpxchg16b on x86-64, std::atomic of that
+// size not being lock-free there with GCC (libatomic) nor MSVC:
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#   define BOOST_VARIANT_DETAIL_CMPXCHG16B
+#elif defined(_M_X64) && defined(BOOST_MSVC)
+#   include <intrin.h>
+#   pragma intrinsic(_InterlockedCompareExchange128)
+#   define BOOST_VARIANT_DETAIL_CMPXCHG16B
+#endif
+
+namespace boost {
+
+namespace detail { namespace variant {
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) metafunctions for the atomic_variant representation
+//
+template <typename... T>
+struct atomic_max_size;
+
+template <>
+struct atomic_max_size<>
+    : boost::integral_constant<std::size_t, 0>
+{
+};
+
+template <typename T, typename... Rest>
+struct atomic_max_size<T, Rest...>
+    : boost::integral_constant<
+          std::size_t
+        , (sizeof(T) > atomic_max_size<Rest...>::value ? sizeof(T) : atomic_max_size<Rest...>::value)
+        >
+{
+};
+
+template <typename... T>
+struct atomic_max_alignment;
+
+template <>
+struct atomic_max_alignment<>
+    : boost::integral_constant<std::size_t, 1>
+{
+};
+
+template <typename T, typename... Rest>
+struct atomic_max_alignment<T, Rest...>
+    : boost::integral_constant<
+          std::size_t
+        , (boost::alignment_of<T>::value > atomic_max_alignment<Rest...>::value
+            ? boost::alignment_of<T>::value : atomic_max_alignment<Rest...>::value)
+        >
+{
+};
+
+template <typename... T>
+struct atomic_all_trivial;
+
+template <>
+struct atomic_all_trivial<>
+    : boost::true_type
+{
+};
+
+template <typename T, typename... Rest>
+struct atomic_all_trivial<T, Rest...>
+    : boost::integral_constant<
+          bool
+        , !boost::is_reference<T>::value
+            && boost::is_trivially_copyable<T>::value
+            && atomic_all_trivial<Rest...>::value
+        >
+{
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template atomic_word
+//
+// Representation of atomic_variant: the object representation of the value
+// at the beginning and the which() in the last byte. Unused bytes are zero,
+// so equal values have equal representations.
+//
+template <std::size_t Size>
+struct atomic_word
+{
+    alignas(Size) unsigned char bytes[Size];
+
+    int which() const BOOST_NOEXCEPT
+    {
+        return bytes[Size - 1];
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template atomic_dword
+//
+// The subset of std::atomic<Word> used by atomic_variant, for a 16 byte
+// Word, on a lock cmpxchg16b. The instruction is a full barrier, so every
+// operation is sequentially consistent whatever the memory order given.
+//
+#if defined(BOOST_VARIANT_DETAIL_CMPXCHG16B)
+
+template <typename Word>
+class atomic_dword
+{
+private: // representation
+
+    BOOST_STATIC_ASSERT(sizeof(Word) == 16);
+
+    // mutable: a load is a compare-and-swap that stores the value loaded
+    alignas(16) mutable boost::uint64_t value_[2];
+
+    static bool cas(boost::uint64_t* target, boost::uint64_t (&expected)[2], const boost::uint64_t (&desired)[2]) BOOST_NOEXCEPT
+    {
+#if defined(BOOST_MSVC)
+        return _InterlockedCompareExchange128(
+              reinterpret_cast<volatile __int64*>(target)
+            , static_cast<__int64>(desired[1])
+            , static_cast<__int64>(desired[0])
+            , reinterpret_cast<__int64*>(expected)
+            ) != 0;
+#else
+        bool result;
+        __asm__ __volatile__(
+              "lock; cmpxchg16b %1\n\t"
+              "sete %0"
+            : "=q" (result), "+m" (*target), "+a" (expected[0]), "+d" (expected[1])
+            : "b" (desired[0]), "c" (desired[1])
+            : "cc", "memory"
+            );
+        return result;
+#endif
+    }
+
+    static void to_value(boost::uint64_t (&value)[2], const Word& word) BOOST_NOEXCEPT
+    {
+        std::memcpy(value, word.bytes, sizeof(value));
+    }
+
+    static Word to_word(const boost::uint64_t (&value)[2]) BOOST_NOEXCEPT
+    {
+        Word word;
+        std::memcpy(word.bytes, value, sizeof(value));
+        return word;
+    }
+
+public: // structors
+
+    explicit atomic_dword(const Word& word) BOOST_NOEXCEPT
+    {
+        atomic_dword::to_value(value_, word);
+    }
+
+private:
+    atomic_dword(const atomic_dword&);
+    atomic_dword& operator=(const atomic_dword&);
+
+public: // std::atomic interface
+
+    bool is_lock_free() const BOOST_NOEXCEPT
+    {
+        return true;
+    }
+
+    Word load(std::memory_order = std::memory_order_seq_cst) const BOOST_NOEXCEPT
+    {
+        // Stores back the same value if it is the guess:
+        boost::uint64_t expected[2] = { 0, 0 };
+        atomic_dword::cas(value_, expected, expected);
+        return atomic_dword::to_word(expected);
+    }
+
+    void store(const Word& word, std::memory_order order = std::memory_order_seq_cst) BOOST_NOEXCEPT
+    {
+        exchange(word, order);
+    }
+
+    Word exchange(const Word& word, std::memory_order = std::memory_order_seq_cst) BOOST_NOEXCEPT
+    {
+        boost::uint64_t desired[2];
+        atomic_dword::to_value(desired, word);
+
+        boost::uint64_t expected[2] = { 0, 0 };
+        while (!atomic_dword::cas(value_, expected, desired)) {}
+
+        return atomic_dword::to_word(expected);
+    }
+
+    bool compare_exchange_strong(Word& expected, const Word& desired, std::memory_order = std::memory_order_seq_cst) BOOST_NOEXCEPT
+    {
+        boost::uint64_t current[2];
+        boost::uint64_t next[2];
+        atomic_dword::to_value(current, expected);
+        atomic_dword::to_value(next, desired);
+
+        if (atomic_dword::cas(value_, current, next))
+            return true;
+
+        expected = atomic_dword::to_word(current);
+        return false;
+    }
+
+    bool compare_exchange_strong(Word& expected, const Word& desired, std::memory_order, std::memory_order) BOOST_NOEXCEPT
+    {
+        return compare_exchange_strong(expected, desired);
+    }
+
+    bool compare_exchange_weak(Word& expected, const Word& desired, std::memory_order = std::memory_order_seq_cst) BOOST_NOEXCEPT
+    {
+        return compare_exchange_strong(expected, desired);
+    }
+
+    bool compare_exchange_weak(Word& expected, const Word& desired, std::memory_order, std::memory_order) BOOST_NOEXCEPT
+    {
+        return compare_exchange_strong(expected, desired);
+    }
+};
+
+#endif // BOOST_VARIANT_DETAIL_CMPXCHG16B
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) metafunction atomic_word_storage
+//
+// The atomic holding the Word of atomic_variant, and whether it is lock-free
+// on all the processors of the target.
+//
+template <typename Word, bool DoubleWidth = (sizeof(Word) == 16)>
+struct atomic_word_storage
+{
+    typedef std::atomic<Word> type;
+
+#if defined(__cpp_lib_atomic_is_always_lock_free)
+    typedef boost::integral_constant<bool, std::atomic<Word>::is_always_lock_free> lock_free;
+#else
+    typedef boost::integral_constant<
+          bool
+        , sizeof(Word) <= sizeof(long long) && ATOMIC_LLONG_LOCK_FREE == 2
+        > lock_free;
+#endif
+};
+
+#if defined(BOOST_VARIANT_DETAIL_CMPXCHG16B)
+template <typename Word>
+struct atomic_word_storage<Word, true>
+{
+    typedef atomic_dword<Word> type;
+    typedef boost::true_type lock_free;
+};
+#endif
+
+template <typename Word, typename Variant, typename Indexes>
+struct atomic_unpack_table;
+
+template <typename Word, typename Variant, std::size_t... I>
+struct atomic_unpack_table<Word, Variant, index_sequence<I...> >
+{
+    typedef Variant (*unpack_t)(const Word&);
+
+    template <typename T>
+    static Variant unpack(const Word& word)
+    {
+        return Variant(*reinterpret_cast<const T*>(word.bytes));
+    }
+
+    static const unpack_t table[sizeof...(I)];
+};
+
+template <typename Word, typename Variant, std::size_t... I>
+const typename atomic_unpack_table<Word, Variant, index_sequence<I...> >::unpack_t
+    atomic_unpack_table<Word, Variant, index_sequence<I...> >::table[sizeof...(I)]
+        = { &atomic_unpack_table::template unpack<
+              typename mpl::at_c<typename Variant::types, static_cast<int>(I)>::type
+          >... };
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template atomic_packer
+//
+// Visitor that stores the content of a variant into an atomic_word.
+//
+template <typename Word>
+class atomic_packer
+    : public boost::static_visitor<>
+{
+private: // representation
+
+    Word& word_;
+
+public: // structors
+
+    explicit atomic_packer(Word& word) BOOST_NOEXCEPT
+        : word_(word)
+    {
+    }
+
+public: // visitor interface
+
+    template <typename T>
+    void operator()(const T& operand) const BOOST_NOEXCEPT
+    {
+        // The byte of an empty type is not a part of its value:
+        if (!boost::is_empty<T>::value)
+            std::memcpy(word_.bytes, &operand, sizeof(T));
+    }
+
+private:
+    atomic_packer& operator=(const atomic_packer&);
+};
+
+}} // namespace detail::variant
+
+///////////////////////////////////////////////////////////////////////////////
+// class template atomic_variant
+//
+// Atomic object holding a value of one of the bounded types. The which()
+// and the value are packed into a single 8 or 16 byte word, accessed via
+// std::atomic, or via cmpxchg16b on x86-64 for the 16 byte words. The
+// operations are always lock-free: a word that would need a lock on the
+// target (a 16 byte word elsewhere than on x86-64, unless std::atomic of
+// that size is lock-free there) fails to compile.
+//
+// The bounded types must be trivially copyable and fit into 15 bytes.
+// compare_exchange_* compare the object representations, as std::atomic
+// does: values of types with padding bits may compare unequal.
+//
+template <typename... T>
+class atomic_variant
+{
+public: // typedefs
+
+    typedef boost::variant<T...> value_type;
+    typedef typename value_type::types types;
+
+private: // representation
+
+    BOOST_STATIC_ASSERT_MSG(
+        detail::variant::atomic_all_trivial<T...>::value,
+        "boost::atomic_variant requires all the bounded types to be trivially copyable non-reference types"
+    );
+    BOOST_STATIC_ASSERT_MSG(
+        detail::variant::atomic_max_size<T...>::value < 16,
+        "boost::atomic_variant requires all the bounded types to fit into 15 bytes"
+    );
+    BOOST_STATIC_ASSERT_MSG(
+        sizeof...(T) <= 256,
+        "boost::atomic_variant supports at most 256 bounded types"
+    );
+
+    typedef detail::variant::atomic_word<
+        (detail::variant::atomic_max_size<T...>::value < 8
+            && detail::variant::atomic_max_alignment<T...>::value <= 8) ? 8 : 16
+    > word_t;
+
+    BOOST_STATIC_ASSERT_MSG(
+        detail::variant::atomic_word_storage<word_t>::lock_free::value,
+        "boost::atomic_variant requires a lock-free atomic of its word size: "
+        "bounded types of at most 7 bytes fit into an 8 byte word"
+    );
+
+    typedef detail::variant::atomic_unpack_table<
+          word_t
+        , value_type
+        , typename detail::variant::make_index_sequence<sizeof...(T)>::type
+        > unpack_table_t;
+
+    typename detail::variant::atomic_word_storage<word_t>::type word_;
+
+    static word_t pack(const value_type& operand) BOOST_NOEXCEPT
+    {
+        word_t word = {};
+        detail::variant::atomic_packer<word_t> visitor(word);
+        operand.apply_visitor(visitor);
+        word.bytes[sizeof(word.bytes) - 1] = static_cast<unsigned char>(operand.which());
+        return word;
+    }
+
+    static value_type unpack(const word_t& word) BOOST_NOEXCEPT
+    {
+        return unpack_table_t::table[word.which()](word);
+    }
+
+public: // structors
+
+    atomic_variant() BOOST_NOEXCEPT
+        : word_(atomic_variant::pack(value_type()))
+    {
+    }
+
+    atomic_variant(const value_type& operand) BOOST_NOEXCEPT
+        : word_(atomic_variant::pack(operand))
+    {
+    }
+
+private:
+    atomic_variant(const atomic_variant&);
+    atomic_variant& operator=(const atomic_variant&);
+
+public: // queries
+
+    bool is_lock_free() const BOOST_NOEXCEPT
+    {
+        return word_.is_lock_free();
+    }
+
+    int which(std::memory_order order = std::memory_order_seq_cst) const BOOST_NOEXCEPT
+    {
+        return word_.load(order).which();
+    }
+
+    value_type load(std::memory_order order = std::memory_order_seq_cst) const BOOST_NOEXCEPT
+    {
+        return atomic_variant::unpack(word_.load(order));
+    }
+
+    operator value_type() const BOOST_NOEXCEPT
+    {
+        return load();
+    }
+
+public: // modifiers
+
+    void store(const value_type& operand, std::memory_order order = std::memory_order_seq_cst) BOOST_NOEXCEPT
+    {
+        word_.store(atomic_variant::pack(operand), order);
+    }
+
+    atomic_variant& operator=(const value_type& operand) BOOST_NOEXCEPT
+    {
+        store(operand);
+        return *this;
+    }
+
+    value_type exchange(const value_type& operand, std::memory_order order = std::memory_order_seq_cst) BOOST_NOEXCEPT
+    {
+        return atomic_variant::unpack(word_.exchange(atomic_variant::pack(operand), order));
+    }
+
+    bool compare_exchange_weak(
+          value_type& expected, const value_type& desired
+        , std::memory_order success, std::memory_order failure
+        ) BOOST_NOEXCEPT
+    {
+        word_t current = atomic_variant::pack(expected);
+        if (word_.compare_exchange_weak(current, atomic_variant::pack(desired), success, failure))
+            return true;
+
+        expected = atomic_variant::unpack(current);
+        return false;
+    }
+
+    bool compare_exchange_weak(
+          value_type& expected, const value_type& desired
+        , std::memory_order order = std::memory_order_seq_cst
+        ) BOOST_NOEXCEPT
+    {
+        word_t current = atomic_variant::pack(expected);
+        if (word_.compare_exchange_weak(current, atomic_variant::pack(desired), order))
+            return true;
+
+        expected = atomic_variant::unpack(current);
+        return false;
+    }
+
+    bool compare_exchange_strong(
+          value_type& expected, const value_type& desired
+        , std::memory_order success, std::memory_order failure
+        ) BOOST_NOEXCEPT
+    {
+        word_t current = atomic_variant::pack(expected);
+        if (word_.compare_exchange_strong(current, atomic_variant::pack(desired), success, failure))
+            return true;
+
+        expected = atomic_variant::unpack(current);
+        return false;
+    }
+
+    bool compare_exchange_strong(
+          value_type& expected, const value_type& desired
+        , std::memory_order order = std::memory_order_seq_cst
+        ) BOOST_NOEXCEPT
+    {
+        word_t current = atomic_variant::pack(expected);
+        if (word_.compare_exchange_strong(current, atomic_variant::pack(desired), order))
+            return true;
+
+        expected = atomic_variant::unpack(current);
+        return false;
+    }
+
+public: // visitation support
+
+    // Visits a snapshot of the value loaded with the given memory order.
+    template <typename Visitor>
+    typename Visitor::result_type
+    apply_visitor(Visitor& visitor, std::memory_order order = std::memory_order_seq_cst) const
+    {
+        const value_type snapshot = load(order);
+        return snapshot.apply_visitor(visitor);
+    }
+
+    template <typename Visitor>
+    typename Visitor::result_type
+    apply_visitor(const Visitor& visitor, std::memory_order order = std::memory_order_seq_cst) const
+    {
+        const value_type snapshot = load(order);
+        return snapshot.apply_visitor(visitor);
+    }
+};
+
+} // namespace boost
+
+#endif // BOOST_VARIANT_ATOMIC_VARIANT_HPP
@@ -0,0 +1,283 @@
+//-----------------------------------------------------------------------------
+// boost variant/backup_pool.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_BACKUP_POOL_HPP
+#define BOOST_VARIANT_BACKUP_POOL_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <cstddef> // for std::size_t, std::max_align_t
+#include <new>
+
+#include <boost/cstdint.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Storage of the heap backups of boost::variant
+//
+// A cross type assignment of a variant whose content has neither a nothrow
+// move nor a nothrow copy constructor (and that has no nothrow default
+// constructible fallback type) backs up the content on the heap, and frees
+// the backup once the assignment succeeded.
+//
+// When BOOST_VARIANT_BACKUP_POOL is #defined, the backups come from per
+// thread free lists of blocks of a few size classes, refilled from the
+// backup allocator. The blocks freed by a thread are kept by that thread
+// (up to a bound per size class) and released at its exit.
+//
+// When BOOST_VARIANT_BACKUP_ALLOCATOR is #defined, it names the backup
+// allocator: a class with the static member functions
+//
+//   void* allocate(std::size_t size, std::size_t alignment);
+//   void deallocate(void* p, std::size_t size, std::size_t alignment) noexcept;
+//
+// declared before this header is included. allocate throws on failure.
+// Otherwise the backup allocator is operator new.
+//
+// Both macros must be #defined consistently in all the translation units.
+//
+
+namespace boost {
+
+///////////////////////////////////////////////////////////////////////////////
+// struct variant_backup_pool_stats
+//
+// Counters of the backup pool of a thread.
+//
+struct variant_backup_pool_stats
+{
+    boost::uint64_t hits;       // backups allocated from the free lists
+    boost::uint64_t misses;     // backups allocated from the backup allocator
+    boost::uint64_t releases;   // blocks returned to the backup allocator
+    std::size_t cached;         // blocks in the free lists
+};
+
+namespace detail { namespace variant {
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class new_backup_allocator
+//
+// The default backup allocator: operator new.
+//
+struct new_backup_allocator
+{
+    static void* allocate(std::size_t size, std::size_t alignment)
+    {
+#if defined(__cpp_aligned_new)
+        if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            return ::operator new(size, std::align_val_t(alignment));
+#endif
+        (void)alignment;
+        return ::operator new(size);
+    }
+
+    static void deallocate(void* p, std::size_t size, std::size_t alignment) BOOST_NOEXCEPT
+    {
+        (void)size;
+#if defined(__cpp_aligned_new)
+        if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            return ::operator delete(p, std::align_val_t(alignment));
+#endif
+        (void)alignment;
+        ::operator delete(p);
+    }
+};
+
+#if defined(BOOST_VARIANT_BACKUP_ALLOCATOR)
+typedef BOOST_VARIANT_BACKUP_ALLOCATOR backup_upstream_allocator;
+#else
+typedef new_backup_allocator backup_upstream_allocator;
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class backup_pool
+//
+// Backup allocator keeping per thread free lists of the blocks of up to
+// class_count * granularity bytes. Larger or over-aligned backups, and the
+// ones made while the thread exits, go to the backup allocator directly.
+//
+// A block may be freed by another thread than the one that allocated it:
+// the blocks of a size class are interchangeable.
+//
+#if !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+
+class backup_pool
+{
+public: // constants
+
+    BOOST_STATIC_CONSTANT(std::size_t, granularity = ::boost::alignment_of<std::max_align_t>::value);
+    BOOST_STATIC_CONSTANT(std::size_t, class_count = 16);
+    BOOST_STATIC_CONSTANT(std::size_t, max_cached = 64); // per size class
+
+private: // representation
+
+    struct free_block
+    {
+        free_block* next;
+    };
+
+    // Trivially destructible, so that it is usable until the thread ends.
+    struct state
+    {
+        free_block* heads[class_count];
+        std::size_t counts[class_count];
+        variant_backup_pool_stats stats;
+        bool exited;
+    };
+
+    struct cleanup
+    {
+        ~cleanup()
+        {
+            backup_pool::trim();
+            backup_pool::current().exited = true;
+        }
+    };
+
+    static state& current() BOOST_NOEXCEPT
+    {
+        static thread_local state pool; // zero initialized
+        return pool;
+    }
+
+    static void register_cleanup() BOOST_NOEXCEPT
+    {
+        static thread_local cleanup at_thread_exit;
+        (void)at_thread_exit;
+    }
+
+    static bool pooled(std::size_t size, std::size_t alignment) BOOST_NOEXCEPT
+    {
+        return size <= class_count * granularity && alignment <= granularity;
+    }
+
+    static std::size_t size_class(std::size_t size) BOOST_NOEXCEPT
+    {
+        return size ? (size - 1) / granularity : 0;
+    }
+
+public: // backup allocator interface
+
+    static void* allocate(std::size_t size, std::size_t alignment)
+    {
+        if (!pooled(size, alignment))
+            return backup_upstream_allocator::allocate(size, alignment);
+
+        state& pool = current();
+        const std::size_t c = size_class(size);
+        if (free_block* const block = pool.heads[c]) {
+            pool.heads[c] = block->next;
+            --pool.counts[c];
+            ++pool.stats.hits;
+            return block;
+        }
+
+        ++pool.stats.misses;
+        return backup_upstream_allocator::allocate((c + 1) * granularity, granularity);
+    }
+
+    static void deallocate(void* p, std::size_t size, std::size_t alignment) BOOST_NOEXCEPT
+    {
+        if (!pooled(size, alignment))
+            return backup_upstream_allocator::deallocate(p, size, alignment);
+
+        state& pool = current();
+        const std::size_t c = size_class(size);
+        if (pool.counts[c] == max_cached || pool.exited) {
+            ++pool.stats.releases;
+            return backup_upstream_allocator::deallocate(p, (c + 1) * granularity, granularity);
+        }
+
+        if (!pool.heads[c])
+            register_cleanup();
+
+        free_block* const block = ::new(p) free_block;
+        block->next = pool.heads[c];
+        pool.heads[c] = block;
+        ++pool.counts[c];
+    }
+
+public: // queries and modifiers
+
+    static variant_backup_pool_stats stats() BOOST_NOEXCEPT
+    {
+        state& pool = current();
+        variant_backup_pool_stats result = pool.stats;
+        result.cached = 0;
+        for (std::size_t c = 0; c != class_count; ++c)
+            result.cached += pool.counts[c];
+        return result;
+    }
+
+    static void trim() BOOST_NOEXCEPT
+    {
+        state& pool = current();
+        for (std::size_t c = 0; c != class_count; ++c) {
+            while (free_block* const block = pool.heads[c]) {
+                pool.heads[c] = block->next;
+                ++pool.stats.releases;
+                backup_upstream_allocator::deallocate(block, (c + 1) * granularity, granularity);
+            }
+            pool.counts[c] = 0;
+        }
+    }
+};
+
+#endif // !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) typedef backup_allocator
+//
+// The allocator of the heap backups, used by new_backup and delete_backup
+// of backup_holder.hpp.
+//
+#if defined(BOOST_VARIANT_BACKUP_POOL) && !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+typedef backup_pool backup_allocator;
+#else
+typedef backup_upstream_allocator backup_allocator;
+#endif
+
+}} // namespace detail::variant
+
+///////////////////////////////////////////////////////////////////////////////
+// function variant_backup_pool_snapshot
+//
+// Returns the counters of the backup pool of the calling thread, all zero
+// if BOOST_VARIANT_BACKUP_POOL is not #defined.
+//
+inline variant_backup_pool_stats variant_backup_pool_snapshot() BOOST_NOEXCEPT
+{
+#if defined(BOOST_VARIANT_BACKUP_POOL) && !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+    return detail::variant::backup_pool::stats();
+#else
+    variant_backup_pool_stats empty = { 0, 0, 0, 0 };
+    return empty;
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// function trim_variant_backup_pool
+//
+// Returns the blocks cached by the calling thread to the backup allocator.
+//
+inline void trim_variant_backup_pool() BOOST_NOEXCEPT
+{
+#if defined(BOOST_VARIANT_BACKUP_POOL) && !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+    detail::variant::backup_pool::trim();
+#endif
+}
+
+} // namespace boost
+
+#endif // BOOST_VARIANT_BACKUP_POOL_HPP
@@ -0,0 +1,696 @@
+//-----------------------------------------------------------------------------
+// boost variant/binary_codec.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_BINARY_CODEC_HPP
+#define BOOST_VARIANT_BINARY_CODEC_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <cstddef> // for std::size_t
+#include <cstring> // for std::memcpy
+#include <exception>
+#include <iterator> // for std::iterator_traits
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <boost/blank.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/core/enable_if.hpp>
+#include <boost/variant/variant.hpp>
+#include <boost/variant/detail/index_sequence.hpp>
+#include <boost/variant/detail/move.hpp>
+#include <boost/variant/detail/variant_access.hpp>
+
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/type_traits/is_enum.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+
+#if !defined(BOOST_VARIANT_CODEC_MAX_EMPTY_ELEMENTS)
+#   define BOOST_VARIANT_CODEC_MAX_EMPTY_ELEMENTS 65536
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Binary format:
+//
+//   variant          := varint(which()) payload
+//   arithmetic, enum := object representation, native byte order
+//   bool             := one byte, 0 or 1
+//   boost::blank     := (nothing)
+//   std::basic_string<Char> := varint(size()) characters
+//   std::vector<T>   := varint(size()) T...
+//
+// varint is the unsigned LEB128 encoding: 7 bits per byte, least significant
+// group first, high bit set on all bytes but the last one.
+//
+
+namespace boost {
+
+#if defined(BOOST_CLANG)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wweak-vtables"
+#endif
+//////////////////////////////////////////////////////////////////////////
+// class bad_variant_decode
+//
+// The exception thrown in the event of a malformed binary representation.
+//
+class BOOST_SYMBOL_VISIBLE bad_variant_decode
+    : public std::exception
+{
+public: // std::exception implementation
+
+    const char * what() const BOOST_NOEXCEPT_OR_NOTHROW BOOST_OVERRIDE
+    {
+        return "boost::bad_variant_decode: "
+               "malformed binary representation of a value";
+    }
+
+};
+#if defined(BOOST_CLANG)
+#   pragma clang diagnostic pop
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// class template variant_codec
+//
+// Customization point that provides binary encoding of T:
+//
+//   static std::size_t encoded_size(const T& value);
+//      Returns the exact count of bytes that encode() writes.
+//
+//   static unsigned char* encode(unsigned char* out, const T& value);
+//      Writes value to out and returns the end of the written bytes.
+//      Precondition: [out, out + encoded_size(value)) is writable.
+//
+//   static const unsigned char* decode(const unsigned char* in, const unsigned char* end, T& value);
+//      Reads value from [in, end) and returns the end of the read bytes, or
+//      nullptr if [in, end) holds only a part of the value. Throws
+//      bad_variant_decode if the input is malformed.
+//
+template <typename T, typename Enable = void>
+struct variant_codec
+{
+    // NOTE TO USER :
+    // Compile error here indicates that there is no binary encoding for T.
+    // Specialize boost::variant_codec<T> for it.
+    //
+    BOOST_STATIC_ASSERT_MSG(
+        (false && sizeof(T)),
+        "boost::variant_codec<T> is not specialized for the type T"
+    );
+};
+
+namespace detail { namespace variant {
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) varint functions
+//
+inline std::size_t varint_size(std::size_t value) BOOST_NOEXCEPT
+{
+    std::size_t size = 1;
+    for (; value >= 0x80; value >>= 7)
+        ++size;
+
+    return size;
+}
+
+inline unsigned char* encode_varint(unsigned char* out, std::size_t value) BOOST_NOEXCEPT
+{
+    for (; value >= 0x80; value >>= 7)
+        *out++ = static_cast<unsigned char>(value | 0x80);
+
+    *out++ = static_cast<unsigned char>(value);
+    return out;
+}
+
+inline const unsigned char* decode_varint(const unsigned char* in, const unsigned char* end, std::size_t& value)
+{
+    value = 0;
+    for (int shift = 0; in != end; shift += 7) {
+        if (shift >= std::numeric_limits<std::size_t>::digits)
+            boost::throw_exception(bad_variant_decode());
+
+        const unsigned char byte = *in++;
+
+        // The bits past the width of std::size_t must be zero:
+        const int width = std::numeric_limits<std::size_t>::digits - shift;
+        if (width < 7 && ((byte & 0x7f) >> width))
+            boost::throw_exception(bad_variant_decode());
+
+        value |= static_cast<std::size_t>(byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+            return in;
+    }
+
+    return nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) metafunction is_memcpy_codec
+//
+// True if the encoding of T is its object representation.
+//
+template <typename T>
+struct is_memcpy_codec
+    : boost::integral_constant<
+          bool
+        , (boost::is_arithmetic<T>::value || boost::is_enum<T>::value)
+            && !boost::is_same<T, bool>::value
+        >
+{
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) metafunction codec_min_size
+//
+// The least count of bytes that encode T, if known, or zero.
+//
+template <typename T, typename Enable = void>
+struct codec_min_size
+    : boost::integral_constant<std::size_t, 0>
+{
+};
+
+template <typename T>
+struct codec_min_size<T, typename boost::enable_if<is_memcpy_codec<T> >::type>
+    : boost::integral_constant<std::size_t, sizeof(T)>
+{
+};
+
+template <>
+struct codec_min_size<bool>
+    : boost::integral_constant<std::size_t, 1>
+{
+};
+
+template <typename CharT, typename Traits, typename Alloc>
+struct codec_min_size< std::basic_string<CharT, Traits, Alloc> >
+    : boost::integral_constant<std::size_t, 1> // varint(size())
+{
+};
+
+template <typename T, typename Alloc>
+struct codec_min_size< std::vector<T, Alloc> >
+    : boost::integral_constant<std::size_t, 1> // varint(size())
+{
+};
+
+template <BOOST_VARIANT_ENUM_PARAMS(typename U)>
+struct codec_min_size< boost::variant<BOOST_VARIANT_ENUM_PARAMS(U)> >
+    : boost::integral_constant<std::size_t, 1> // varint(which())
+{
+};
+
+template <typename T>
+inline const unsigned char* decode_memcpy(const unsigned char* in, const unsigned char* end, T* values, std::size_t count) BOOST_NOEXCEPT
+{
+    if (static_cast<std::size_t>(end - in) / sizeof(T) < count)
+        return nullptr;
+
+    if (count)
+        std::memcpy(values, in, count * sizeof(T));
+
+    return in + count * sizeof(T);
+}
+
+template <typename T>
+inline unsigned char* encode_memcpy(unsigned char* out, const T* values, std::size_t count) BOOST_NOEXCEPT
+{
+    if (count)
+        std::memcpy(out, values, count * sizeof(T));
+
+    return out + count * sizeof(T);
+}
+
+template <typename Vector>
+inline const unsigned char* decode_vector(const unsigned char* in, const unsigned char* end, Vector& value, boost::true_type /*is_memcpy_codec*/)
+{
+    std::size_t count;
+    in = ::boost::detail::variant::decode_varint(in, end, count);
+    if (!in || static_cast<std::size_t>(end - in) / sizeof(typename Vector::value_type) < count)
+        return nullptr;
+
+    value.resize(count);
+    return ::boost::detail::variant::decode_memcpy(in, end, value.data(), count);
+}
+
+template <typename Vector>
+inline const unsigned char* decode_vector(const unsigned char* in, const unsigned char* end, Vector& value, boost::false_type /*is_memcpy_codec*/)
+{
+    typedef variant_codec<typename Vector::value_type> codec_t;
+    typedef codec_min_size<typename Vector::value_type> min_size_t;
+
+    std::size_t count;
+    in = ::boost::detail::variant::decode_varint(in, end, count);
+    if (!in)
+        return in;
+
+    if (count > value.max_size())
+        boost::throw_exception(bad_variant_decode());
+
+    if (min_size_t::value && static_cast<std::size_t>(end - in) / min_size_t::value < count)
+        return nullptr;
+
+    // Grow by the decoded elements, not by count, which the input may not
+    // hold. The input does not bound the count of the elements with an empty
+    // encoding, so there may be at most BOOST_VARIANT_CODEC_MAX_EMPTY_ELEMENTS
+    // of them:
+    std::size_t empty_elements = 0;
+    for (std::size_t i = 0; in && i != count; ++i) {
+        if (i == value.size())
+            value.push_back(typename Vector::value_type());
+
+        const unsigned char* const element = in;
+        in = codec_t::decode(in, end, value[i]);
+        if (!min_size_t::value && in == element
+            && ++empty_elements > static_cast<std::size_t>(BOOST_VARIANT_CODEC_MAX_EMPTY_ELEMENTS))
+        {
+            boost::throw_exception(bad_variant_decode());
+        }
+    }
+
+    if (in && value.size() > count)
+        value.resize(count);
+
+    return in;
+}
+
+template <typename Vector>
+inline std::size_t vector_encoded_size(const Vector& value, boost::true_type /*is_memcpy_codec*/) BOOST_NOEXCEPT
+{
+    return ::boost::detail::variant::varint_size(value.size())
+        + value.size() * sizeof(typename Vector::value_type);
+}
+
+template <typename Vector>
+inline std::size_t vector_encoded_size(const Vector& value, boost::false_type /*is_memcpy_codec*/)
+{
+    typedef variant_codec<typename Vector::value_type> codec_t;
+
+    std::size_t size = ::boost::detail::variant::varint_size(value.size());
+    for (std::size_t i = 0; i != value.size(); ++i)
+        size += codec_t::encoded_size(value[i]);
+
+    return size;
+}
+
+template <typename Vector>
+inline unsigned char* encode_vector(unsigned char* out, const Vector& value, boost::true_type /*is_memcpy_codec*/) BOOST_NOEXCEPT
+{
+    out = ::boost::detail::variant::encode_varint(out, value.size());
+    return ::boost::detail::variant::encode_memcpy(out, value.data(), value.size());
+}
+
+template <typename Vector>
+inline unsigned char* encode_vector(unsigned char* out, const Vector& value, boost::false_type /*is_memcpy_codec*/)
+{
+    typedef variant_codec<typename Vector::value_type> codec_t;
+
+    out = ::boost::detail::variant::encode_varint(out, value.size());
+    for (std::size_t i = 0; i != value.size(); ++i)
+        out = codec_t::encode(out, value[i]);
+
+    return out;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template codec_alternative
+//
+// Encodes and decodes the I-th bounded type of Variant.
+//
+template <typename Variant, int I>
+struct codec_alternative
+{
+    typedef typename boost::remove_cv<
+        typename boost::remove_reference<
+            typename variant_alternative<Variant, I>::type
+        >::type
+    >::type value_t;
+
+    typedef variant_codec<value_t> codec_t;
+
+    static std::size_t encoded_size(const Variant& operand)
+    {
+        return ::boost::detail::variant::varint_size(I)
+            + codec_t::encoded_size(::boost::detail::variant::unchecked_get<I>(operand));
+    }
+
+    static unsigned char* encode(unsigned char* out, const Variant& operand)
+    {
+        out = ::boost::detail::variant::encode_varint(out, I);
+        return codec_t::encode(out, ::boost::detail::variant::unchecked_get<I>(operand));
+    }
+
+    static const unsigned char* decode(const unsigned char* in, const unsigned char* end, Variant& operand)
+    {
+        // Reuse the resources of the content if the bounded type matches...
+        if (operand.which() == I)
+            return codec_t::decode(in, end, ::boost::detail::variant::unchecked_get<I>(operand));
+
+        // ...otherwise decode into a temporary and move it in:
+        value_t value;
+        in = codec_t::decode(in, end, value);
+        if (in)
+            operand = ::boost::detail::variant::move(value);
+
+        return in;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template codec_table
+//
+// Tables of codec_alternative functions indexed by which().
+//
+template <typename Variant, typename Indexes>
+struct codec_table;
+
+template <typename Variant, std::size_t... I>
+struct codec_table<Variant, index_sequence<I...> >
+{
+    typedef std::size_t (*encoded_size_t)(const Variant&);
+    typedef unsigned char* (*encode_t)(unsigned char*, const Variant&);
+    typedef const unsigned char* (*decode_t)(const unsigned char*, const unsigned char*, Variant&);
+
+    static const encoded_size_t encoded_size[sizeof...(I)];
+    static const encode_t encode[sizeof...(I)];
+    static const decode_t decode[sizeof...(I)];
+};
+
+template <typename Variant, std::size_t... I>
+const typename codec_table<Variant, index_sequence<I...> >::encoded_size_t
+    codec_table<Variant, index_sequence<I...> >::encoded_size[sizeof...(I)]
+        = { &codec_alternative<Variant, static_cast<int>(I)>::encoded_size... };
+
+template <typename Variant, std::size_t... I>
+const typename codec_table<Variant, index_sequence<I...> >::encode_t
+    codec_table<Variant, index_sequence<I...> >::encode[sizeof...(I)]
+        = { &codec_alternative<Variant, static_cast<int>(I)>::encode... };
+
+template <typename Variant, std::size_t... I>
+const typename codec_table<Variant, index_sequence<I...> >::decode_t
+    codec_table<Variant, index_sequence<I...> >::decode[sizeof...(I)]
+        = { &codec_alternative<Variant, static_cast<int>(I)>::decode... };
+
+template <typename Iterator>
+struct codec_of_value
+{
+    typedef variant_codec<
+        typename boost::remove_cv<
+            typename std::iterator_traits<Iterator>::value_type
+        >::type
+    > type;
+};
+
+}} // namespace detail::variant
+
+///////////////////////////////////////////////////////////////////////////////
+// class template variant_codec specializations
+//
+template <typename T>
+struct variant_codec<T, typename boost::enable_if<detail::variant::is_memcpy_codec<T> >::type>
+{
+    static std::size_t encoded_size(const T&) BOOST_NOEXCEPT
+    {
+        return sizeof(T);
+    }
+
+    static unsigned char* encode(unsigned char* out, const T& value) BOOST_NOEXCEPT
+    {
+        return detail::variant::encode_memcpy(out, &value, 1);
+    }
+
+    static const unsigned char* decode(const unsigned char* in, const unsigned char* end, T& value) BOOST_NOEXCEPT
+    {
+        return detail::variant::decode_memcpy(in, end, &value, 1);
+    }
+};
+
+template <>
+struct variant_codec<bool>
+{
+    static std::size_t encoded_size(bool) BOOST_NOEXCEPT
+    {
+        return 1;
+    }
+
+    static unsigned char* encode(unsigned char* out, bool value) BOOST_NOEXCEPT
+    {
+        *out = static_cast<unsigned char>(value);
+        return out + 1;
+    }
+
+    static const unsigned char* decode(const unsigned char* in, const unsigned char* end, bool& value)
+    {
+        if (in == end)
+            return nullptr;
+
+        if (*in > 1)
+            boost::throw_exception(bad_variant_decode());
+
+        value = (*in == 1);
+        return in + 1;
+    }
+};
+
+template <>
+struct variant_codec<boost::blank>
+{
+    static std::size_t encoded_size(const boost::blank&) BOOST_NOEXCEPT
+    {
+        return 0;
+    }
+
+    static unsigned char* encode(unsigned char* out, const boost::blank&) BOOST_NOEXCEPT
+    {
+        return out;
+    }
+
+    static const unsigned char* decode(const unsigned char* in, const unsigned char*, boost::blank&) BOOST_NOEXCEPT
+    {
+        return in;
+    }
+};
+
+template <typename CharT, typename Traits, typename Alloc>
+struct variant_codec< std::basic_string<CharT, Traits, Alloc> >
+{
+    typedef std::basic_string<CharT, Traits, Alloc> value_type;
+
+    static std::size_t encoded_size(const value_type& value) BOOST_NOEXCEPT
+    {
+        return detail::variant::varint_size(value.size()) + value.size() * sizeof(CharT);
+    }
+
+    static unsigned char* encode(unsigned char* out, const value_type& value) BOOST_NOEXCEPT
+    {
+        out = detail::variant::encode_varint(out, value.size());
+        return detail::variant::encode_memcpy(out, value.data(), value.size());
+    }
+
+    static const unsigned char* decode(const unsigned char* in, const unsigned char* end, value_type& value)
+    {
+        std::size_t size;
+        in = detail::variant::decode_varint(in, end, size);
+        if (!in || static_cast<std::size_t>(end - in) / sizeof(CharT) < size)
+            return nullptr;
+
+        if (sizeof(CharT) == 1) {
+            value.assign(reinterpret_cast<const CharT*>(in), size);
+            return in + size;
+        }
+
+        // [in may be misaligned for CharT:]
+        value.resize(size);
+        return detail::variant::decode_memcpy(in, end, &value[0], size);
+    }
+};
+
+template <typename T, typename Alloc>
+struct variant_codec< std::vector<T, Alloc> >
+{
+    typedef std::vector<T, Alloc> value_type;
+    typedef detail::variant::is_memcpy_codec<T> is_memcpy_codec_t;
+
+    static std::size_t encoded_size(const value_type& value)
+    {
+        return detail::variant::vector_encoded_size(value, is_memcpy_codec_t());
+    }
+
+    static unsigned char* encode(unsigned char* out, const value_type& value)
+    {
+        return detail::variant::encode_vector(out, value, is_memcpy_codec_t());
+    }
+
+    static const unsigned char* decode(const unsigned char* in, const unsigned char* end, value_type& value)
+    {
+        return detail::variant::decode_vector(in, end, value, is_memcpy_codec_t());
+    }
+};
+
+template <BOOST_VARIANT_ENUM_PARAMS(typename U)>
+struct variant_codec< boost::variant<BOOST_VARIANT_ENUM_PARAMS(U)> >
+{
+    typedef boost::variant<BOOST_VARIANT_ENUM_PARAMS(U)> value_type;
+    typedef detail::variant::codec_table<
+          value_type
+        , typename detail::variant::make_index_sequence<
+              detail::variant::variant_size<value_type>::value
+            >::type
+        > table_t;
+
+    static std::size_t encoded_size(const value_type& value)
+    {
+        return table_t::encoded_size[value.which()](value);
+    }
+
+    static unsigned char* encode(unsigned char* out, const value_type& value)
+    {
+        return table_t::encode[value.which()](out, value);
+    }
+
+    static const unsigned char* decode(const unsigned char* in, const unsigned char* end, value_type& value)
+    {
+        std::size_t which;
+        in = detail::variant::decode_varint(in, end, which);
+        if (!in)
+            return in;
+
+        if (which >= static_cast<std::size_t>(detail::variant::variant_size<value_type>::value))
+            boost::throw_exception(bad_variant_decode());
+
+        return table_t::decode[which](in, end, value);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// function template encoded_variant_size
+//
+// Returns the count of bytes required to encode the given variant.
+//
+template <BOOST_VARIANT_ENUM_PARAMS(typename T)>
+inline std::size_t encoded_variant_size(const boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)>& operand)
+{
+    return variant_codec< boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> >::encoded_size(operand);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// function template encode_variant
+//
+// Writes the given variant to the given buffer. Returns the count of written
+// bytes, or 0 (with nothing written) if the buffer is too small.
+//
+template <BOOST_VARIANT_ENUM_PARAMS(typename T)>
+inline std::size_t encode_variant(
+      const boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)>& operand
+    , void* buffer, std::size_t size
+    )
+{
+    typedef variant_codec< boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> > codec_t;
+
+    const std::size_t required = codec_t::encoded_size(operand);
+    if (required > size)
+        return 0;
+
+    codec_t::encode(static_cast<unsigned char*>(buffer), operand);
+    return required;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// function template decode_variant
+//
+// Reads a variant from the given buffer. Returns the count of read bytes,
+// or 0 if the buffer holds only a part of the encoded variant (in which
+// case operand holds an unspecified valid value). Throws bad_variant_decode
+// if the input is malformed.
+//
+template <BOOST_VARIANT_ENUM_PARAMS(typename T)>
+inline std::size_t decode_variant(
+      boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)>& operand
+    , const void* buffer, std::size_t size
+    )
+{
+    typedef variant_codec< boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> > codec_t;
+
+    const unsigned char* const begin = static_cast<const unsigned char*>(buffer);
+    const unsigned char* const end = codec_t::decode(begin, begin + size, operand);
+    return end ? static_cast<std::size_t>(end - begin) : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// function template encode_variants
+//
+// Writes as many variants of [first, last) as fit into the given buffer.
+// Stores the count of written bytes into written and returns the iterator
+// to the first variant that was not written.
+//
+template <typename InputIt>
+inline InputIt encode_variants(
+      InputIt first, InputIt last
+    , void* buffer, std::size_t size, std::size_t& written
+    )
+{
+    typedef typename detail::variant::codec_of_value<InputIt>::type codec_t;
+
+    unsigned char* const begin = static_cast<unsigned char*>(buffer);
+    unsigned char* out = begin;
+    for (; first != last; ++first) {
+        if (codec_t::encoded_size(*first) > size - static_cast<std::size_t>(out - begin))
+            break;
+
+        out = codec_t::encode(out, *first);
+    }
+
+    written = static_cast<std::size_t>(out - begin);
+    return first;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// function template decode_variants
+//
+// Reads variants from the given buffer into [first, last) while the buffer
+// holds complete encoded variants. Stores the count of read bytes into
+// consumed and returns the iterator past the last decoded variant.
+//
+template <typename ForwardIt>
+inline ForwardIt decode_variants(
+      ForwardIt first, ForwardIt last
+    , const void* buffer, std::size_t size, std::size_t& consumed
+    )
+{
+    typedef typename detail::variant::codec_of_value<ForwardIt>::type codec_t;
+
+    const unsigned char* const begin = static_cast<const unsigned char*>(buffer);
+    const unsigned char* const end = begin + size;
+    const unsigned char* in = begin;
+    for (; first != last && in != end; ++first) {
+        const unsigned char* const next = codec_t::decode(in, end, *first);
+        if (!next)
+            break;
+
+        in = next;
+    }
+
+    consumed = static_cast<std::size_t>(in - begin);
+    return first;
+}
+
+} // namespace boost
+
+#endif // BOOST_VARIANT_BINARY_CODEC_HPP
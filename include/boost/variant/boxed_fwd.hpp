@@ -0,0 +1,48 @@
+//-----------------------------------------------------------------------------
+// boost variant/boxed_fwd.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_BOXED_FWD_HPP
+#define BOOST_VARIANT_BOXED_FWD_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <boost/variant/recursive_wrapper_fwd.hpp>
+
+#include <memory> // for std::allocator
+
+namespace boost {
+
+//////////////////////////////////////////////////////////////////////////
+// class template boxed
+//
+// Owning pointer to a T allocated with Allocator. Like recursive_wrapper,
+// invisible to get, apply_visitor and the comparisons of variant: used by
+// boxed_variant to keep the large bounded types out of the variant storage.
+//
+template <typename T, typename Allocator = std::allocator<T> > class boxed;
+
+///////////////////////////////////////////////////////////////////////////////
+// metafunction unwrap_recursive, partial specialization for boxed
+//
+// The public type of a boxed bounded type is the boxed type.
+//
+template <typename T, typename Allocator>
+struct unwrap_recursive< boxed<T, Allocator> >
+{
+    typedef T type;
+};
+
+} // namespace boost
+
+#endif // BOOST_VARIANT_BOXED_FWD_HPP
@@ -0,0 +1,332 @@
+//-----------------------------------------------------------------------------
+// boost variant/boxed_variant.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_BOXED_VARIANT_HPP
+#define BOOST_VARIANT_BOXED_VARIANT_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <cstddef> // for std::size_t
+#include <memory> // for std::allocator, std::allocator_traits
+#include <utility> // for std::forward
+
+#include <boost/variant/boxed_fwd.hpp>
+#include <boost/variant/variant.hpp>
+#include <boost/variant/detail/move.hpp>
+
+#include <boost/core/allocator_access.hpp>
+#include <boost/core/empty_value.hpp>
+#include <boost/core/no_exceptions_support.hpp>
+#include <boost/core/pointer_traits.hpp>
+#include <boost/core/swap.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/type_traits/is_reference.hpp>
+
+namespace boost {
+
+//////////////////////////////////////////////////////////////////////////
+// class template boxed
+//
+// See boxed_fwd.hpp for more information.
+//
+// As for recursive_wrapper, copy and move construction allocate a new T:
+// a moved from box still holds a value, so a moved from variant is never
+// empty.
+//
+template <typename T, typename Allocator>
+class boxed
+    : private boost::empty_value<
+          typename std::allocator_traits<Allocator>::template rebind_alloc<T>
+        >
+{
+public: // typedefs
+
+    typedef T type;
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<T>
+        allocator_type;
+
+private: // representation
+
+    typedef std::allocator_traits<allocator_type> traits;
+    typedef boost::empty_value<allocator_type> base_type;
+    typedef typename traits::pointer pointer;
+
+    typedef mpl::bool_<
+          traits::propagate_on_container_copy_assignment::value
+        > propagate_on_copy_assignment;
+    typedef mpl::bool_<
+          traits::propagate_on_container_move_assignment::value
+        > propagate_on_move_assignment;
+    typedef mpl::bool_<
+          traits::propagate_on_container_swap::value
+        > propagate_on_swap;
+    typedef mpl::bool_<
+          boost::allocator_is_always_equal<allocator_type>::type::value
+        > always_equal;
+
+    pointer p_;
+
+private: // helpers, for structors (below)
+
+    allocator_type& allocator() BOOST_NOEXCEPT
+    {
+        return base_type::get();
+    }
+
+    const allocator_type& allocator() const BOOST_NOEXCEPT
+    {
+        return base_type::get();
+    }
+
+    template <typename... Args>
+    static pointer create(allocator_type& a, Args&&... args)
+    {
+        pointer p = traits::allocate(a, 1);
+        BOOST_TRY
+        {
+            traits::construct(a, boost::to_address(p), std::forward<Args>(args)...);
+        }
+        BOOST_CATCH (...)
+        {
+            traits::deallocate(a, p, 1);
+            BOOST_RETHROW;
+        }
+        BOOST_CATCH_END
+
+        return p;
+    }
+
+public: // structors
+
+    boxed()
+        : base_type(boost::empty_init_t())
+        , p_(create(allocator()))
+    {
+    }
+
+    boxed(const boxed& operand)
+        : base_type(
+              boost::empty_init_t()
+            , traits::select_on_container_copy_construction(operand.get_allocator())
+            )
+        , p_(create(allocator(), operand.get()))
+    {
+    }
+
+    boxed(boxed&& operand)
+        : base_type(boost::empty_init_t(), operand.get_allocator())
+        , p_(create(allocator(), detail::variant::move(operand.get())))
+    {
+    }
+
+    // Allocator-extended copy and move, for the uses-allocator construction
+    // of the allocator-extended constructors of variant.
+    boxed(const boxed& operand, const allocator_type& a)
+        : base_type(boost::empty_init_t(), a)
+        , p_(create(allocator(), operand.get()))
+    {
+    }
+
+    boxed(boxed&& operand, const allocator_type& a)
+        : base_type(boost::empty_init_t(), a)
+        , p_(create(allocator(), detail::variant::move(operand.get())))
+    {
+    }
+
+    boxed(const T& operand)
+        : base_type(boost::empty_init_t())
+        , p_(create(allocator(), operand))
+    {
+    }
+
+    boxed(T&& operand)
+        : base_type(boost::empty_init_t())
+        , p_(create(allocator(), detail::variant::move(operand)))
+    {
+    }
+
+    boxed(const T& operand, const allocator_type& a)
+        : base_type(boost::empty_init_t(), a)
+        , p_(create(allocator(), operand))
+    {
+    }
+
+    boxed(T&& operand, const allocator_type& a)
+        : base_type(boost::empty_init_t(), a)
+        , p_(create(allocator(), detail::variant::move(operand)))
+    {
+    }
+
+    ~boxed()
+    {
+        traits::destroy(allocator(), boost::to_address(p_));
+        traits::deallocate(allocator(), p_, 1);
+    }
+
+public: // modifiers
+
+    boxed& operator=(const boxed& rhs)
+    {
+        copy_assign(rhs, propagate_on_copy_assignment());
+        return *this;
+    }
+
+    boxed& operator=(const T& rhs)
+    {
+        get() = rhs;
+        return *this;
+    }
+
+    // As for the allocator-aware containers, the allocators are exchanged
+    // only if they propagate on swap. Otherwise the pointers are exchanged if
+    // the allocators compare equal, else the values.
+    void swap(boxed& operand)
+        BOOST_NOEXCEPT_IF(propagate_on_swap::value || always_equal::value)
+    {
+        swap_impl(operand, propagate_on_swap());
+    }
+
+    boxed& operator=(boxed&& rhs)
+        BOOST_NOEXCEPT_IF(propagate_on_move_assignment::value || always_equal::value)
+    {
+        move_assign(rhs, propagate_on_move_assignment());
+        return *this;
+    }
+
+    boxed& operator=(T&& rhs)
+    {
+        get() = detail::variant::move(rhs);
+        return *this;
+    }
+
+private: // helpers, for modifiers (above)
+
+    void copy_assign(const boxed& rhs, mpl::false_)
+    {
+        get() = rhs.get();
+    }
+
+    void copy_assign(const boxed& rhs, mpl::true_)
+    {
+        if (always_equal::value || allocator() == rhs.allocator()) {
+            get() = rhs.get();
+            allocator() = rhs.allocator();
+            return;
+        }
+
+        // The value must be allocated by the propagated allocator:
+        allocator_type a(rhs.allocator());
+        pointer p = create(a, rhs.get());
+        traits::destroy(allocator(), boost::to_address(p_));
+        traits::deallocate(allocator(), p_, 1);
+        p_ = p;
+        allocator() = a;
+    }
+
+    void move_assign(boxed& rhs, mpl::true_) BOOST_NOEXCEPT
+    {
+        // rhs takes the previous value, with the allocator that allocated it:
+        boost::swap(p_, rhs.p_);
+        boost::swap(allocator(), rhs.allocator());
+    }
+
+    void move_assign(boxed& rhs, mpl::false_)
+    {
+        if (always_equal::value || allocator() == rhs.allocator())
+            boost::swap(p_, rhs.p_);
+        else
+            get() = detail::variant::move(rhs.get());
+    }
+
+    void swap_impl(boxed& operand, mpl::true_) BOOST_NOEXCEPT
+    {
+        boost::swap(p_, operand.p_);
+        boost::swap(allocator(), operand.allocator());
+    }
+
+    void swap_impl(boxed& operand, mpl::false_)
+    {
+        if (always_equal::value || allocator() == operand.allocator())
+            boost::swap(p_, operand.p_);
+        else
+            boost::swap(get(), operand.get());
+    }
+
+public: // queries
+
+    T& get() { return *get_pointer(); }
+    const T& get() const { return *get_pointer(); }
+
+    T* get_pointer() { return boost::to_address(p_); }
+    const T* get_pointer() const { return boost::to_address(p_); }
+
+    allocator_type get_allocator() const BOOST_NOEXCEPT
+    {
+        return base_type::get();
+    }
+};
+
+// function template swap
+//
+// Swaps two boxed<T, Allocator> objects of the same type.
+//
+template <typename T, typename Allocator>
+inline void swap(boxed<T, Allocator>& lhs, boxed<T, Allocator>& rhs)
+    BOOST_NOEXCEPT_IF(BOOST_NOEXCEPT_EXPR(lhs.swap(rhs)))
+{
+    lhs.swap(rhs);
+}
+
+namespace detail { namespace variant {
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) metafunction box_if_larger
+//
+// boxed<T> if T is larger than Limit bytes, else T. References are never
+// boxed.
+//
+template <std::size_t Limit, typename Allocator, typename T>
+struct box_if_larger
+    : mpl::if_c<
+          !boost::is_reference<T>::value && (sizeof(T) > Limit)
+        , boxed<T, typename std::allocator_traits<Allocator>::template rebind_alloc<T> >
+        , T
+        >
+{
+};
+
+}} // namespace detail::variant
+
+///////////////////////////////////////////////////////////////////////////////
+// alias templates basic_boxed_variant and boxed_variant
+//
+// Variant of the bounded types T..., where the types larger than Limit
+// bytes are held through a boxed allocated with Allocator (rebound to
+// each of them). The variant is then about Limit bytes large, whatever
+// the size of its rarely held large types.
+//
+// The bounded types must be complete.
+//
+template <std::size_t Limit, typename Allocator, typename... T>
+using basic_boxed_variant = variant<
+    typename detail::variant::box_if_larger<Limit, Allocator, T>::type...
+>;
+
+template <std::size_t Limit, typename... T>
+using boxed_variant = basic_boxed_variant<Limit, std::allocator<void>, T...>;
+
+} // namespace boost
+
+#endif // BOOST_VARIANT_BOXED_VARIANT_HPP
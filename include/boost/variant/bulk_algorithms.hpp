@@ -0,0 +1,380 @@
+//-----------------------------------------------------------------------------
+// boost variant/bulk_algorithms.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_BULK_ALGORITHMS_HPP
+#define BOOST_VARIANT_BULK_ALGORITHMS_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <cstddef> // for std::size_t
+#include <cstring> // for std::memcmp
+#include <iterator> // for std::iterator_traits
+
+#include <boost/variant/variant.hpp>
+#include <boost/variant/detail/variant_access.hpp>
+
+#include <boost/core/addressof.hpp>
+#include <boost/container_hash/hash.hpp>
+#include <boost/mpl/for_each.hpp>
+#include <boost/mpl/range_c.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_enum.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_pointer.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+
+namespace boost {
+
+///////////////////////////////////////////////////////////////////////////////
+// metafunction is_bitwise_comparable
+//
+// True if operator== on T is equivalent to comparing the object
+// representations of T. Users may specialize it for their own padding-free
+// types whose operator== compares all of the members.
+//
+template <typename T>
+struct is_bitwise_comparable
+    : boost::integral_constant<
+          bool
+        , boost::is_integral<T>::value
+            || boost::is_enum<T>::value
+            || boost::is_pointer<T>::value
+        >
+{
+};
+
+namespace detail { namespace variant {
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template bulk_chunk
+//
+// Fixed size block of range elements, grouped by the index of their bounded
+// type via counting sort so that each bounded type is processed by a tight
+// loop without visitation.
+//
+template <typename Variant>
+struct bulk_chunk
+{
+    BOOST_STATIC_CONSTANT(std::size_t, capacity = 256);
+    BOOST_STATIC_CONSTANT(int, alternatives = variant_size<Variant>::value);
+
+    const Variant* items[capacity];
+    int which[capacity];
+    unsigned short order[capacity];
+    std::size_t bucket[alternatives + 1];
+    std::size_t size;
+
+    void group() BOOST_NOEXCEPT
+    {
+        std::size_t position[alternatives];
+        for (int k = 0; k <= alternatives; ++k)
+            bucket[k] = 0;
+
+        for (std::size_t i = 0; i != size; ++i)
+            ++bucket[which[i] + 1];
+
+        for (int k = 0; k != alternatives; ++k) {
+            bucket[k + 1] += bucket[k];
+            position[k] = bucket[k];
+        }
+
+        for (std::size_t i = 0; i != size; ++i)
+            order[position[which[i]]++] = static_cast<unsigned short>(i);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template bulk_hasher
+//
+// Computes hash_value of each element of the chunk holding the Index-th
+// bounded type.
+//
+template <typename Variant>
+class bulk_hasher
+{
+private: // representation
+
+    const bulk_chunk<Variant>& chunk_;
+    std::size_t* hashes_;
+
+public: // structors
+
+    bulk_hasher(const bulk_chunk<Variant>& chunk, std::size_t* hashes) BOOST_NOEXCEPT
+        : chunk_(chunk)
+        , hashes_(hashes)
+    {
+    }
+
+public: // mpl::for_each interface
+
+    template <typename Index>
+    void operator()(Index) const
+    {
+        const int which = Index::value;
+
+        typedef typename variant_alternative<Variant, Index::value>::type alternative_t;
+        typedef typename boost::remove_cv<
+            typename boost::remove_reference<alternative_t>::type
+        >::type value_t;
+
+        // Must produce the same values as hash_value in hash_variant.hpp:
+        boost::hash<value_t> hasher;
+        for (std::size_t j = chunk_.bucket[which]; j != chunk_.bucket[which + 1]; ++j) {
+            const std::size_t i = chunk_.order[j];
+            std::size_t seed = hasher(
+                ::boost::detail::variant::unchecked_get<Index::value>(*chunk_.items[i])
+            );
+            hash_combine(seed, which);
+            hashes_[i] = seed;
+        }
+    }
+
+private:
+    bulk_hasher& operator=(const bulk_hasher&);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template bulk_comparer
+//
+// Compares the elements of the chunk holding the Index-th bounded type with
+// the corresponding elements of the other chunk.
+//
+// Precondition: lhs.which[i] == rhs.which[i] for each i.
+//
+template <typename Variant>
+class bulk_comparer
+{
+private: // representation
+
+    const bulk_chunk<Variant>& lhs_;
+    const bulk_chunk<Variant>& rhs_;
+    bool& equal_;
+
+    template <typename T>
+    static bool equal_impl(const T& lhs, const T& rhs, boost::true_type /*is_bitwise_comparable*/) BOOST_NOEXCEPT
+    {
+        return std::memcmp(boost::addressof(lhs), boost::addressof(rhs), sizeof(T)) == 0;
+    }
+
+    template <typename T>
+    static bool equal_impl(const T& lhs, const T& rhs, boost::false_type /*is_bitwise_comparable*/)
+    {
+        return lhs == rhs;
+    }
+
+public: // structors
+
+    bulk_comparer(const bulk_chunk<Variant>& lhs, const bulk_chunk<Variant>& rhs, bool& equal) BOOST_NOEXCEPT
+        : lhs_(lhs)
+        , rhs_(rhs)
+        , equal_(equal)
+    {
+    }
+
+public: // mpl::for_each interface
+
+    template <typename Index>
+    void operator()(Index) const
+    {
+        const int which = Index::value;
+
+        typedef typename variant_alternative<Variant, Index::value>::type alternative_t;
+        typedef typename boost::remove_cv<
+            typename boost::remove_reference<alternative_t>::type
+        >::type value_t;
+        typedef boost::integral_constant<
+            bool, boost::is_bitwise_comparable<value_t>::value
+        > tag_t;
+
+        for (std::size_t j = lhs_.bucket[which]; equal_ && j != lhs_.bucket[which + 1]; ++j) {
+            const std::size_t i = lhs_.order[j];
+            equal_ = bulk_comparer::equal_impl<value_t>(
+                  ::boost::detail::variant::unchecked_get<Index::value>(*lhs_.items[i])
+                , ::boost::detail::variant::unchecked_get<Index::value>(*rhs_.items[i])
+                , tag_t()
+                );
+        }
+    }
+
+private:
+    bulk_comparer& operator=(const bulk_comparer&);
+};
+
+template <typename Iterator>
+struct bulk_value
+{
+    typedef typename boost::remove_cv<
+        typename std::iterator_traits<Iterator>::value_type
+    >::type type;
+};
+
+template <typename Variant, typename ForwardIt>
+inline ForwardIt bulk_fill(bulk_chunk<Variant>& chunk, ForwardIt first, ForwardIt last)
+{
+    chunk.size = 0;
+    for (; first != last && chunk.size != chunk.capacity; ++first, ++chunk.size) {
+        chunk.items[chunk.size] = boost::addressof(*first);
+        chunk.which[chunk.size] = chunk.items[chunk.size]->which();
+    }
+
+    return first;
+}
+
+template <typename ForwardIt, typename Sink>
+inline void bulk_hash(ForwardIt first, ForwardIt last, Sink& sink)
+{
+    typedef typename bulk_value<ForwardIt>::type variant_t;
+    typedef mpl::range_c<int, 0, variant_size<variant_t>::value> indexes_t;
+
+    bulk_chunk<variant_t> chunk;
+    std::size_t hashes[bulk_chunk<variant_t>::capacity];
+    while (first != last) {
+        first = ::boost::detail::variant::bulk_fill(chunk, first, last);
+        chunk.group();
+        mpl::for_each<indexes_t>(bulk_hasher<variant_t>(chunk, hashes));
+        sink(hashes, chunk.size);
+    }
+}
+
+template <typename OutputIt>
+struct bulk_copy_sink
+{
+    OutputIt out;
+
+    void operator()(const std::size_t* hashes, std::size_t size)
+    {
+        for (std::size_t i = 0; i != size; ++i, ++out)
+            *out = hashes[i];
+    }
+};
+
+struct bulk_combine_sink
+{
+    std::size_t& seed;
+
+    void operator()(const std::size_t* hashes, std::size_t size)
+    {
+        for (std::size_t i = 0; i != size; ++i)
+            hash_combine(seed, hashes[i]);
+    }
+};
+
+template <typename ForwardIt1, typename ForwardIt2>
+inline bool bulk_equal_chunks(
+      ForwardIt1& first1, ForwardIt1 last1
+    , ForwardIt2& first2, ForwardIt2 last2
+    , bool bounded_rhs
+    )
+{
+    typedef typename bulk_value<ForwardIt1>::type variant_t;
+    typedef mpl::range_c<int, 0, variant_size<variant_t>::value> indexes_t;
+
+    BOOST_STATIC_ASSERT_MSG(
+        (boost::is_same<variant_t, typename bulk_value<ForwardIt2>::type>::value),
+        "boost::equal_ranges_variants requires both ranges to hold the same variant type"
+    );
+
+    bulk_chunk<variant_t> lhs;
+    bulk_chunk<variant_t> rhs;
+    while (first1 != last1) {
+        first1 = ::boost::detail::variant::bulk_fill(lhs, first1, last1);
+
+        // Without the end of the second range the chunks are filled in lockstep:
+        rhs.size = 0;
+        for (; rhs.size != lhs.size && (!bounded_rhs || first2 != last2); ++first2, ++rhs.size) {
+            rhs.items[rhs.size] = boost::addressof(*first2);
+            rhs.which[rhs.size] = rhs.items[rhs.size]->which();
+        }
+
+        if (rhs.size != lhs.size)
+            return false;
+
+        for (std::size_t i = 0; i != lhs.size; ++i) {
+            if (lhs.which[i] != rhs.which[i])
+                return false;
+        }
+
+        lhs.group();
+
+        bool equal = true;
+        mpl::for_each<indexes_t>(bulk_comparer<variant_t>(lhs, rhs, equal));
+        if (!equal)
+            return false;
+    }
+
+    return !bounded_rhs || first2 == last2;
+}
+
+}} // namespace detail::variant
+
+///////////////////////////////////////////////////////////////////////////////
+// function template hash_range_variants
+//
+// Computes hash_value of each variant in [first, last) processing the
+// elements in blocks grouped by the bounded type they hold. The per-element
+// overload writes the hashes to out, the other overloads produce the same
+// result as boost::hash_range.
+//
+template <typename ForwardIt, typename OutputIt>
+inline OutputIt hash_range_variants(ForwardIt first, ForwardIt last, OutputIt out)
+{
+    detail::variant::bulk_copy_sink<OutputIt> sink = { out };
+    detail::variant::bulk_hash(first, last, sink);
+    return sink.out;
+}
+
+template <typename ForwardIt>
+inline void hash_range_variants(std::size_t& seed, ForwardIt first, ForwardIt last)
+{
+    detail::variant::bulk_combine_sink sink = { seed };
+    detail::variant::bulk_hash(first, last, sink);
+}
+
+template <typename ForwardIt>
+inline std::size_t hash_range_variants(ForwardIt first, ForwardIt last)
+{
+    std::size_t seed = 0;
+    boost::hash_range_variants(seed, first, last);
+    return seed;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// function template equal_ranges_variants
+//
+// Returns true if the given ranges of variants are elementwise equal
+// (in terms of variant::operator==). Discriminators are compared first,
+// contents are then compared in blocks grouped by the bounded type using
+// std::memcmp for the types satisfying is_bitwise_comparable.
+//
+template <typename ForwardIt1, typename ForwardIt2>
+inline bool equal_ranges_variants(ForwardIt1 first1, ForwardIt1 last1, ForwardIt2 first2)
+{
+    return detail::variant::bulk_equal_chunks(first1, last1, first2, first2, false);
+}
+
+template <typename ForwardIt1, typename ForwardIt2>
+inline bool equal_ranges_variants(
+      ForwardIt1 first1, ForwardIt1 last1
+    , ForwardIt2 first2, ForwardIt2 last2
+    )
+{
+    return detail::variant::bulk_equal_chunks(first1, last1, first2, last2, true);
+}
+
+} // namespace boost
+
+#endif // BOOST_VARIANT_BULK_ALGORITHMS_HPP
@@ -0,0 +1,565 @@
+//-----------------------------------------------------------------------------
+// boost variant/charconv.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_CHARCONV_HPP
+#define BOOST_VARIANT_CHARCONV_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <cstddef> // for std::size_t
+#include <cstdio> // for std::snprintf
+#include <cstdlib> // for std::strtod
+#include <cstring> // for std::memcpy
+#include <exception>
+#include <limits>
+#include <string>
+
+#include <boost/blank.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/core/enable_if.hpp>
+#include <boost/utility/string_view.hpp>
+#include <boost/variant/variant.hpp>
+#include <boost/variant/apply_visitor.hpp>
+#include <boost/variant/static_visitor.hpp>
+#include <boost/variant/detail/move.hpp>
+
+#include <boost/mpl/begin_end.hpp>
+#include <boost/mpl/contains.hpp>
+#include <boost/mpl/deref.hpp>
+#include <boost/mpl/next.hpp>
+#include <boost/type_traits/conditional.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/is_signed.hpp>
+#include <boost/type_traits/make_unsigned.hpp>
+
+#if !defined(BOOST_NO_CXX17_HDR_CHARCONV) && defined(__has_include) \
+    && ((defined(_MSVC_LANG) && _MSVC_LANG >= 201703L) || __cplusplus >= 201703L)
+#   if __has_include(<charconv>)
+#       include <charconv>
+#       define BOOST_VARIANT_DETAIL_HAS_CHARCONV
+        // Floating point overloads are provided by the newer standard libraries only:
+#       if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#           define BOOST_VARIANT_DETAIL_HAS_FLOATING_CHARCONV
+#       endif
+#   endif
+#endif
+
+namespace boost {
+
+#if defined(BOOST_CLANG)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wweak-vtables"
+#endif
+//////////////////////////////////////////////////////////////////////////
+// class bad_variant_parse
+//
+// The exception thrown in the event of a text that matches none of the
+// bounded types.
+//
+class BOOST_SYMBOL_VISIBLE bad_variant_parse
+    : public std::exception
+{
+public: // std::exception implementation
+
+    const char * what() const BOOST_NOEXCEPT_OR_NOTHROW BOOST_OVERRIDE
+    {
+        return "boost::bad_variant_parse: "
+               "text does not represent a value of any of the bounded types";
+    }
+
+};
+#if defined(BOOST_CLANG)
+#   pragma clang diagnostic pop
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// class template variant_chars
+//
+// Customization point that provides text representation of T:
+//
+//   static char* to_chars(char* first, char* last, const T& value);
+//      Writes value to [first, last) and returns the end of the written
+//      characters, or nullptr if the range is too small.
+//
+//   static bool from_chars(const char* first, const char* last, T& value);
+//      Returns true and assigns value if the whole [first, last) represents
+//      a value of T, returns false otherwise.
+//
+// Provided for arithmetic types (via std::to_chars and std::from_chars where
+// the standard library provides them, locale independent), char, bool ("true" and "false"),
+// std::string, boost::blank (empty text) and variants.
+//
+template <typename T, typename Enable = void>
+struct variant_chars
+{
+    // NOTE TO USER :
+    // Compile error here indicates that there is no text representation for T.
+    // Specialize boost::variant_chars<T> for it.
+    //
+    BOOST_STATIC_ASSERT_MSG(
+        (false && sizeof(T)),
+        "boost::variant_chars<T> is not specialized for the type T"
+    );
+};
+
+namespace detail { namespace variant {
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) integer conversion functions
+//
+template <typename T>
+struct is_chars_integer
+    : boost::integral_constant<
+          bool
+        , boost::is_integral<T>::value
+            && !boost::is_same<T, bool>::value
+            && !boost::is_same<T, char>::value
+        >
+{
+};
+
+inline char* copy_chars(char* first, char* last, const char* data, std::size_t size) BOOST_NOEXCEPT
+{
+    if (static_cast<std::size_t>(last - first) < size)
+        return nullptr;
+
+    std::memcpy(first, data, size);
+    return first + size;
+}
+
+#ifdef BOOST_VARIANT_DETAIL_HAS_CHARCONV
+
+template <typename T>
+inline char* integer_to_chars(char* first, char* last, T value) BOOST_NOEXCEPT
+{
+    const std::to_chars_result result = std::to_chars(first, last, value);
+    return result.ec == std::errc() ? result.ptr : nullptr;
+}
+
+template <typename T>
+inline bool integer_from_chars(const char* first, const char* last, T& value) BOOST_NOEXCEPT
+{
+    const std::from_chars_result result = std::from_chars(first, last, value);
+    return result.ec == std::errc() && result.ptr == last;
+}
+
+#else // !defined BOOST_VARIANT_DETAIL_HAS_CHARCONV
+
+template <typename T>
+inline char* integer_to_chars(char* first, char* last, T value) BOOST_NOEXCEPT
+{
+    typedef typename boost::make_unsigned<T>::type unsigned_t;
+
+    char digits[std::numeric_limits<unsigned_t>::digits10 + 2];
+    char* const digits_end = digits + sizeof(digits);
+    char* p = digits_end;
+
+    const bool negative = (value < 0);
+    unsigned_t magnitude = static_cast<unsigned_t>(value);
+    if (negative)
+        magnitude = static_cast<unsigned_t>(0u - magnitude);
+
+    do {
+        *--p = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude);
+
+    if (negative)
+        *--p = '-';
+
+    return ::boost::detail::variant::copy_chars(first, last, p, static_cast<std::size_t>(digits_end - p));
+}
+
+template <typename T>
+inline bool integer_from_chars(const char* first, const char* last, T& value) BOOST_NOEXCEPT
+{
+    typedef typename boost::make_unsigned<T>::type unsigned_t;
+
+    const bool negative = (boost::is_signed<T>::value && first != last && *first == '-');
+    if (negative)
+        ++first;
+
+    if (first == last)
+        return false;
+
+    const unsigned_t limit = negative
+        ? static_cast<unsigned_t>(static_cast<unsigned_t>((std::numeric_limits<T>::max)()) + 1u)
+        : static_cast<unsigned_t>((std::numeric_limits<T>::max)());
+
+    unsigned_t magnitude = 0;
+    for (; first != last; ++first) {
+        const unsigned digit = static_cast<unsigned>(static_cast<unsigned char>(*first) - '0');
+        if (digit > 9 || magnitude > (limit - digit) / 10)
+            return false;
+
+        magnitude = static_cast<unsigned_t>(magnitude * 10 + digit);
+    }
+
+    value = negative
+        ? static_cast<T>(0 - static_cast<T>(magnitude - 1) - 1)
+        : static_cast<T>(magnitude);
+    return true;
+}
+
+#endif // BOOST_VARIANT_DETAIL_HAS_CHARCONV
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) floating point conversion functions
+//
+#ifdef BOOST_VARIANT_DETAIL_HAS_FLOATING_CHARCONV
+
+template <typename T>
+inline char* floating_to_chars(char* first, char* last, T value) BOOST_NOEXCEPT
+{
+    const std::to_chars_result result = std::to_chars(first, last, value);
+    return result.ec == std::errc() ? result.ptr : nullptr;
+}
+
+template <typename T>
+inline bool floating_from_chars(const char* first, const char* last, T& value) BOOST_NOEXCEPT
+{
+    const std::from_chars_result result = std::from_chars(first, last, value);
+    return result.ec == std::errc() && result.ptr == last;
+}
+
+#else // !defined BOOST_VARIANT_DETAIL_HAS_FLOATING_CHARCONV
+
+// Fallback on the C library, uses the decimal point of the current C locale.
+inline int format_floating(char* buffer, std::size_t size, int precision, double value) BOOST_NOEXCEPT
+{
+    return std::snprintf(buffer, size, "%.*g", precision, value);
+}
+
+inline int format_floating(char* buffer, std::size_t size, int precision, long double value) BOOST_NOEXCEPT
+{
+    return std::snprintf(buffer, size, "%.*Lg", precision, value);
+}
+
+inline void parse_floating(const char* text, char** end, float& value) BOOST_NOEXCEPT
+{
+    value = std::strtof(text, end);
+}
+
+inline void parse_floating(const char* text, char** end, double& value) BOOST_NOEXCEPT
+{
+    value = std::strtod(text, end);
+}
+
+inline void parse_floating(const char* text, char** end, long double& value) BOOST_NOEXCEPT
+{
+    value = std::strtold(text, end);
+}
+
+template <typename T>
+inline bool floating_from_chars(const char* first, const char* last, T& value) BOOST_NOEXCEPT
+{
+    // strtod requires a null terminated string and skips the leading spaces
+    // that std::from_chars does not accept.
+    char text[128];
+    const std::size_t size = static_cast<std::size_t>(last - first);
+    if (size == 0 || size >= sizeof(text) || *first == '+'
+        || static_cast<unsigned char>(*first) <= ' ')
+    {
+        return false;
+    }
+
+    std::memcpy(text, first, size);
+    text[size] = '\0';
+
+    char* end = nullptr;
+    T result;
+    ::boost::detail::variant::parse_floating(text, &end, result);
+    if (end != text + size)
+        return false;
+
+    value = result;
+    return true;
+}
+
+template <typename T>
+inline char* floating_to_chars(char* first, char* last, T value) BOOST_NOEXCEPT
+{
+    typedef typename boost::conditional<
+        boost::is_same<T, long double>::value, long double, double
+    >::type promoted_t;
+
+    // Round trips, but is not the shortest representation that std::to_chars
+    // produces.
+    char text[64];
+    const int size = ::boost::detail::variant::format_floating(
+        text, sizeof(text), std::numeric_limits<T>::max_digits10, static_cast<promoted_t>(value)
+    );
+
+    if (size <= 0 || static_cast<std::size_t>(size) >= sizeof(text))
+        return nullptr;
+
+    return ::boost::detail::variant::copy_chars(first, last, text, static_cast<std::size_t>(size));
+}
+
+#endif // BOOST_VARIANT_DETAIL_HAS_FLOATING_CHARCONV
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class chars_formatter
+//
+// Visitor that writes the content of a variant to the given range.
+//
+class chars_formatter
+    : public boost::static_visitor<char*>
+{
+private: // representation
+
+    char* first_;
+    char* last_;
+
+public: // structors
+
+    chars_formatter(char* first, char* last) BOOST_NOEXCEPT
+        : first_(first)
+        , last_(last)
+    {
+    }
+
+public: // visitor interface
+
+    template <typename T>
+    char* operator()(const T& operand) const
+    {
+        return variant_chars<T>::to_chars(first_, last_, operand);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template chars_parser
+//
+// Tries to parse the text as each of the types of [Iter, End) in turn.
+//
+template <typename Variant, typename Iter, typename End>
+struct chars_parser
+{
+    typedef typename mpl::deref<Iter>::type value_t;
+
+    BOOST_STATIC_ASSERT_MSG(
+        (mpl::contains<typename Variant::types, value_t>::value),
+        "boost::parse_variant: the order of parsing must consist of the bounded types of the variant"
+    );
+
+    static bool parse(const char* first, const char* last, Variant& result)
+    {
+        value_t value;
+        if (variant_chars<value_t>::from_chars(first, last, value)) {
+            result = ::boost::detail::variant::move(value);
+            return true;
+        }
+
+        return chars_parser<Variant, typename mpl::next<Iter>::type, End>::parse(first, last, result);
+    }
+};
+
+template <typename Variant, typename End>
+struct chars_parser<Variant, End, End>
+{
+    static bool parse(const char*, const char*, Variant&) BOOST_NOEXCEPT
+    {
+        return false;
+    }
+};
+
+template <typename Variant, typename Order>
+inline bool parse_chars(const char* first, const char* last, Variant& result)
+{
+    typedef chars_parser<
+          Variant
+        , typename mpl::begin<Order>::type
+        , typename mpl::end<Order>::type
+        > parser_t;
+
+    return parser_t::parse(first, last, result);
+}
+
+}} // namespace detail::variant
+
+///////////////////////////////////////////////////////////////////////////////
+// class template variant_chars specializations
+//
+template <typename T>
+struct variant_chars<T, typename boost::enable_if<detail::variant::is_chars_integer<T> >::type>
+{
+    static char* to_chars(char* first, char* last, T value) BOOST_NOEXCEPT
+    {
+        return detail::variant::integer_to_chars(first, last, value);
+    }
+
+    static bool from_chars(const char* first, const char* last, T& value) BOOST_NOEXCEPT
+    {
+        return detail::variant::integer_from_chars(first, last, value);
+    }
+};
+
+template <typename T>
+struct variant_chars<T, typename boost::enable_if<boost::is_floating_point<T> >::type>
+{
+    static char* to_chars(char* first, char* last, T value) BOOST_NOEXCEPT
+    {
+        return detail::variant::floating_to_chars(first, last, value);
+    }
+
+    static bool from_chars(const char* first, const char* last, T& value) BOOST_NOEXCEPT
+    {
+        return detail::variant::floating_from_chars(first, last, value);
+    }
+};
+
+template <>
+struct variant_chars<bool>
+{
+    static char* to_chars(char* first, char* last, bool value) BOOST_NOEXCEPT
+    {
+        return value
+            ? detail::variant::copy_chars(first, last, "true", 4)
+            : detail::variant::copy_chars(first, last, "false", 5);
+    }
+
+    static bool from_chars(const char* first, const char* last, bool& value) BOOST_NOEXCEPT
+    {
+        const boost::string_view text(first, static_cast<std::size_t>(last - first));
+        if (text == "true") {
+            value = true;
+            return true;
+        } else if (text == "false") {
+            value = false;
+            return true;
+        }
+
+        return false;
+    }
+};
+
+template <>
+struct variant_chars<char>
+{
+    static char* to_chars(char* first, char* last, char value) BOOST_NOEXCEPT
+    {
+        return detail::variant::copy_chars(first, last, &value, 1);
+    }
+
+    static bool from_chars(const char* first, const char* last, char& value) BOOST_NOEXCEPT
+    {
+        if (last - first != 1)
+            return false;
+
+        value = *first;
+        return true;
+    }
+};
+
+template <>
+struct variant_chars<boost::blank>
+{
+    static char* to_chars(char* first, char*, const boost::blank&) BOOST_NOEXCEPT
+    {
+        return first;
+    }
+
+    static bool from_chars(const char* first, const char* last, boost::blank&) BOOST_NOEXCEPT
+    {
+        return first == last;
+    }
+};
+
+template <typename Traits, typename Allocator>
+struct variant_chars< std::basic_string<char, Traits, Allocator> >
+{
+    typedef std::basic_string<char, Traits, Allocator> string_t;
+
+    static char* to_chars(char* first, char* last, const string_t& value) BOOST_NOEXCEPT
+    {
+        return detail::variant::copy_chars(first, last, value.data(), value.size());
+    }
+
+    static bool from_chars(const char* first, const char* last, string_t& value)
+    {
+        value.assign(first, last);
+        return true;
+    }
+};
+
+template <typename... T>
+struct variant_chars< boost::variant<T...> >
+{
+    typedef boost::variant<T...> variant_t;
+
+    static char* to_chars(char* first, char* last, const variant_t& value)
+    {
+        detail::variant::chars_formatter visitor(first, last);
+        return boost::apply_visitor(visitor, value);
+    }
+
+    static bool from_chars(const char* first, const char* last, variant_t& value)
+    {
+        return detail::variant::parse_chars<variant_t, typename variant_t::types>(first, last, value);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// function template format_to
+//
+// Writes the text representation of the content of the variant to the
+// given buffer without a terminating null character. Returns the end of
+// the written characters, or nullptr if the buffer is too small.
+//
+template <typename... T>
+inline char* format_to(char* first, char* last, const variant<T...>& operand)
+{
+    return variant_chars< variant<T...> >::to_chars(first, last, operand);
+}
+
+template <std::size_t N, typename... T>
+inline char* format_to(char (&buffer)[N], const variant<T...>& operand)
+{
+    return variant_chars< variant<T...> >::to_chars(buffer, buffer + N, operand);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// function template parse_variant
+//
+// Assigns to the variant the first of the types of Order (the bounded
+// types by default) that represents the whole text. The numeric types are
+// parsed without memory allocation.
+//
+// The overload returning bool reports failure without modifying the
+// variant, the overload returning the variant throws bad_variant_parse.
+//
+template <typename Variant, typename Order = typename Variant::types>
+inline bool parse_variant(const char* first, const char* last, Variant& result)
+{
+    return detail::variant::parse_chars<Variant, Order>(first, last, result);
+}
+
+template <typename Variant, typename Order = typename Variant::types>
+inline Variant parse_variant(boost::string_view text)
+{
+    Variant result;
+    if (!detail::variant::parse_chars<Variant, Order>(text.data(), text.data() + text.size(), result))
+        boost::throw_exception(bad_variant_parse());
+
+    return result;
+}
+
+} // namespace boost
+
+#endif // BOOST_VARIANT_CHARCONV_HPP
@@ -0,0 +1,747 @@
+//-----------------------------------------------------------------------------
+// boost variant/columnar.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_COLUMNAR_HPP
+#define BOOST_VARIANT_COLUMNAR_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <cstddef> // for std::size_t
+#include <cstring> // for std::memcpy, std::memcmp
+#include <iterator> // for std::iterator_traits, std::input_iterator_tag
+#include <ostream>
+
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/variant/binary_codec.hpp> // for bad_variant_decode
+#include <boost/variant/variant.hpp>
+#include <boost/variant/detail/index_sequence.hpp>
+#include <boost/variant/detail/variant_access.hpp>
+
+#include <boost/core/addressof.hpp>
+#include <boost/mpl/and.hpp>
+#include <boost/mpl/empty.hpp>
+#include <boost/mpl/for_each.hpp>
+#include <boost/mpl/not.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/mpl/range_c.hpp>
+#include <boost/mpl/remove_if.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/type_traits/is_reference.hpp>
+#include <boost/type_traits/is_trivially_copyable.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Columnar format:
+//
+//   header       := magic[8] byte_order:u32 alternatives:u32 count:u64
+//                   tags_offset:u64 ranks_offset:u64 column...
+//   column       := offset:u64 count:u64 size:u32 align:u32
+//   tags         := u8[count], which() of each element
+//   ranks        := u64[blocks][alternatives], count of the elements of each
+//                   bounded type preceding the block of 64 elements
+//   payload      := for each bounded type, the object representations of all
+//                   the values of that type, 64 bytes aligned
+//
+// All the offsets are relative to the beginning of the data, all the integers
+// are in native byte order. Elements are visited directly in the payload
+// columns, so the data may be memory mapped and is paged in lazily.
+//
+
+namespace boost {
+
+namespace detail { namespace variant {
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) columnar format constants and header
+//
+struct columnar_header
+{
+    BOOST_STATIC_CONSTANT(std::size_t, block = 64);
+    BOOST_STATIC_CONSTANT(std::size_t, column_alignment = 64);
+    BOOST_STATIC_CONSTANT(boost::uint32_t, byte_order_mark = 0x01020304u);
+
+    static const char* magic() BOOST_NOEXCEPT
+    {
+        return "BVCOLMN1";
+    }
+
+    struct column
+    {
+        boost::uint64_t offset;
+        boost::uint64_t count;
+        boost::uint32_t size;
+        boost::uint32_t align;
+    };
+
+    char magic_[8];
+    boost::uint32_t byte_order;
+    boost::uint32_t alternatives;
+    boost::uint64_t count;
+    boost::uint64_t tags_offset;
+    boost::uint64_t ranks_offset;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) metafunction is_columnar_variant
+//
+// True if all the bounded types of Variant may be stored in the columnar
+// format: trivially copyable non-reference types.
+//
+template <typename T>
+struct is_columnar_alternative
+    : mpl::and_<
+          mpl::not_< boost::is_reference<T> >
+        , boost::is_trivially_copyable<T>
+        >
+{
+};
+
+template <typename Variant>
+struct is_columnar_variant
+    : mpl::empty<
+          typename mpl::remove_if<
+              typename Variant::types
+            , is_columnar_alternative<mpl::_1>
+            >::type
+        >
+{
+};
+
+template <typename Variant>
+struct columnar_traits
+{
+    BOOST_STATIC_CONSTANT(int, alternatives = variant_size<Variant>::value);
+
+    BOOST_STATIC_ASSERT_MSG(
+        is_columnar_variant<Variant>::value,
+        "boost::columnar_variants requires all the bounded types to be trivially copyable non-reference types"
+    );
+    BOOST_STATIC_ASSERT_MSG(
+        alternatives <= 256,
+        "boost::columnar_variants supports at most 256 bounded types"
+    );
+
+    static std::size_t header_size() BOOST_NOEXCEPT
+    {
+        return sizeof(columnar_header) + alternatives * sizeof(columnar_header::column);
+    }
+
+    static std::size_t blocks(std::size_t count) BOOST_NOEXCEPT
+    {
+        return (count + columnar_header::block - 1) / columnar_header::block;
+    }
+
+    static std::size_t align_up(std::size_t offset) BOOST_NOEXCEPT
+    {
+        return (offset + columnar_header::column_alignment - 1)
+            & ~static_cast<std::size_t>(columnar_header::column_alignment - 1);
+    }
+
+    static void describe_columns(columnar_header::column* columns) BOOST_NOEXCEPT
+    {
+        columnar_traits::describe_columns(
+              columns
+            , typename make_index_sequence<alternatives>::type()
+            );
+    }
+
+    template <std::size_t... I>
+    static void describe_columns(columnar_header::column* columns, index_sequence<I...>) BOOST_NOEXCEPT
+    {
+        static const boost::uint32_t sizes[] = {
+            sizeof(typename variant_alternative<Variant, static_cast<int>(I)>::type)...
+        };
+        static const boost::uint32_t aligns[] = {
+            boost::alignment_of<typename variant_alternative<Variant, static_cast<int>(I)>::type>::value...
+        };
+
+        for (int k = 0; k != alternatives; ++k) {
+            columns[k].size = sizes[k];
+            columns[k].align = aligns[k];
+        }
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template columnar_visit_table
+//
+// Tables of functions that invoke the visitor on the payload of the bounded
+// type with the given index.
+//
+template <typename Variant, typename Visitor, typename Indexes>
+struct columnar_visit_table;
+
+template <typename Variant, typename Visitor, std::size_t... I>
+struct columnar_visit_table<Variant, Visitor, index_sequence<I...> >
+{
+    typedef typename Visitor::result_type result_type;
+    typedef result_type (*visit_t)(Visitor&, const unsigned char*);
+
+    template <int Index>
+    static result_type visit(Visitor& visitor, const unsigned char* payload)
+    {
+        typedef typename variant_alternative<Variant, Index>::type alternative_t;
+        return visitor(*reinterpret_cast<const alternative_t*>(payload));
+    }
+
+    static const visit_t table[sizeof...(I)];
+};
+
+template <typename Variant, typename Visitor, std::size_t... I>
+const typename columnar_visit_table<Variant, Visitor, index_sequence<I...> >::visit_t
+    columnar_visit_table<Variant, Visitor, index_sequence<I...> >::table[sizeof...(I)]
+        = { &columnar_visit_table::template visit<static_cast<int>(I)>... };
+
+template <typename Variant, typename Visitor>
+inline typename Visitor::result_type
+columnar_visit(int which, const unsigned char* payload, Visitor& visitor)
+{
+    typedef columnar_visit_table<
+          Variant
+        , Visitor
+        , typename make_index_sequence<variant_size<Variant>::value>::type
+        > table_t;
+
+    return table_t::table[which](visitor, payload);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template columnar_writer
+//
+// Buffers the output to write the stream in large blocks.
+//
+class columnar_writer
+{
+private: // representation
+
+    std::ostream& os_;
+    std::size_t size_;
+    std::size_t written_;
+    unsigned char buffer_[4096];
+
+public: // structors
+
+    explicit columnar_writer(std::ostream& os) BOOST_NOEXCEPT
+        : os_(os)
+        , size_(0)
+        , written_(0)
+    {
+    }
+
+    ~columnar_writer()
+    {
+        flush();
+    }
+
+public: // modifiers
+
+    void write(const void* data, std::size_t size)
+    {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        while (size) {
+            if (size_ == sizeof(buffer_))
+                flush();
+
+            std::size_t chunk = sizeof(buffer_) - size_;
+            if (chunk > size)
+                chunk = size;
+
+            std::memcpy(buffer_ + size_, bytes, chunk);
+            size_ += chunk;
+            bytes += chunk;
+            size -= chunk;
+        }
+    }
+
+    void pad_to(std::size_t offset)
+    {
+        static const unsigned char zeros[columnar_header::column_alignment] = {};
+        while (tell() < offset) {
+            std::size_t chunk = offset - tell();
+            if (chunk > sizeof(zeros))
+                chunk = sizeof(zeros);
+
+            write(zeros, chunk);
+        }
+    }
+
+    std::size_t tell() const BOOST_NOEXCEPT
+    {
+        return written_ + size_;
+    }
+
+    void flush()
+    {
+        if (size_) {
+            os_.write(reinterpret_cast<const char*>(buffer_), static_cast<std::streamsize>(size_));
+            written_ += size_;
+            size_ = 0;
+        }
+    }
+
+private:
+    columnar_writer(const columnar_writer&);
+    columnar_writer& operator=(const columnar_writer&);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template columnar_column_writer
+//
+// Writes the payload column of the Index-th bounded type.
+//
+template <typename ForwardIt>
+class columnar_column_writer
+{
+private: // representation
+
+    columnar_writer& writer_;
+    ForwardIt first_;
+    ForwardIt last_;
+    const boost::uint64_t* offsets_;
+
+public: // structors
+
+    columnar_column_writer(columnar_writer& writer, ForwardIt first, ForwardIt last, const boost::uint64_t* offsets) BOOST_NOEXCEPT
+        : writer_(writer)
+        , first_(first)
+        , last_(last)
+        , offsets_(offsets)
+    {
+    }
+
+public: // mpl::for_each interface
+
+    template <typename Index>
+    void operator()(Index) const
+    {
+        writer_.pad_to(static_cast<std::size_t>(offsets_[Index::value]));
+        for (ForwardIt it = first_; it != last_; ++it) {
+            if (it->which() == Index::value) {
+                const typename variant_alternative<
+                    typename std::iterator_traits<ForwardIt>::value_type, Index::value
+                >::type& value = ::boost::detail::variant::unchecked_get<Index::value>(*it);
+
+                writer_.write(boost::addressof(value), sizeof(value));
+            }
+        }
+    }
+
+private:
+    columnar_column_writer& operator=(const columnar_column_writer&);
+};
+
+}} // namespace detail::variant
+
+///////////////////////////////////////////////////////////////////////////////
+// class template columnar_variant_ref
+//
+// Read-only view of an element of columnar_variants. Visitable in place via
+// boost::apply_visitor.
+//
+template <typename Variant>
+class columnar_variant_ref
+{
+public: // typedefs
+
+    typedef typename Variant::types types;
+
+private: // representation
+
+    const unsigned char* payload_;
+    int which_;
+
+public: // structors
+
+    columnar_variant_ref(int which, const unsigned char* payload) BOOST_NOEXCEPT
+        : payload_(payload)
+        , which_(which)
+    {
+    }
+
+public: // queries
+
+    int which() const BOOST_NOEXCEPT
+    {
+        return which_;
+    }
+
+    // Copies the element into a variant.
+    Variant value() const
+    {
+        Variant result;
+        value_assigner assigner = { result };
+        apply_visitor(assigner);
+        return result;
+    }
+
+public: // visitation support
+
+    template <typename Visitor>
+    typename Visitor::result_type
+    apply_visitor(Visitor& visitor) const
+    {
+        return detail::variant::columnar_visit<Variant>(which_, payload_, visitor);
+    }
+
+    template <typename Visitor>
+    typename Visitor::result_type
+    apply_visitor(const Visitor& visitor) const
+    {
+        return detail::variant::columnar_visit<Variant>(which_, payload_, visitor);
+    }
+
+private: // helpers
+
+    struct value_assigner
+    {
+        typedef void result_type;
+
+        Variant& result;
+
+        template <typename T>
+        void operator()(const T& value) const
+        {
+            result = value;
+        }
+    };
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// class template columnar_variants
+//
+// Read-only view of an array of variants stored in the columnar format,
+// typically a memory mapped file written by write_columnar_variants. The
+// data must be aligned at least as strictly as the bounded types and must
+// outlive the view.
+//
+// The constructor validates the header in constant time; the elements are
+// checked for consistency when accessed. Malformed data results in
+// bad_variant_decode.
+//
+template <typename Variant>
+class columnar_variants
+{
+private: // representation
+
+    typedef detail::variant::columnar_traits<Variant> traits_t;
+    typedef detail::variant::columnar_header header_t;
+
+    BOOST_STATIC_CONSTANT(int, alternatives = traits_t::alternatives);
+
+    std::size_t size_;
+    const unsigned char* tags_;
+    const unsigned char* ranks_;
+    const unsigned char* columns_[alternatives];
+    std::size_t column_sizes_[alternatives];
+    std::size_t strides_[alternatives];
+
+public: // typedefs
+
+    typedef columnar_variant_ref<Variant> value_type;
+    typedef columnar_variant_ref<Variant> const_reference;
+    typedef std::size_t size_type;
+
+    class const_iterator;
+
+public: // structors
+
+    columnar_variants(const void* data, std::size_t size)
+    {
+        const unsigned char* const base = static_cast<const unsigned char*>(data);
+        if (size < traits_t::header_size())
+            boost::throw_exception(bad_variant_decode());
+
+        header_t header;
+        std::memcpy(&header, base, sizeof(header));
+        if (std::memcmp(header.magic_, header_t::magic(), sizeof(header.magic_)) != 0
+            || header.byte_order != header_t::byte_order_mark
+            || header.alternatives != static_cast<boost::uint32_t>(alternatives)
+            || header.count > size
+            || header.tags_offset > size - header.count
+            || header.ranks_offset > size
+            || traits_t::blocks(static_cast<std::size_t>(header.count)) * alternatives
+                > (size - header.ranks_offset) / sizeof(boost::uint64_t))
+        {
+            boost::throw_exception(bad_variant_decode());
+        }
+
+        size_ = static_cast<std::size_t>(header.count);
+        tags_ = base + header.tags_offset;
+        ranks_ = base + header.ranks_offset;
+
+        std::size_t total = 0;
+        columnar_variants::init_columns(
+              base, size, total
+            , typename detail::variant::make_index_sequence<alternatives>::type()
+            );
+        if (total != size_)
+            boost::throw_exception(bad_variant_decode());
+    }
+
+public: // queries
+
+    std::size_t size() const BOOST_NOEXCEPT
+    {
+        return size_;
+    }
+
+    bool empty() const BOOST_NOEXCEPT
+    {
+        return size_ == 0;
+    }
+
+    int which(std::size_t i) const BOOST_NOEXCEPT
+    {
+        return tags_[i];
+    }
+
+    // Random access: constant time, scans at most 63 tags.
+    const_reference operator[](std::size_t i) const
+    {
+        const std::size_t block = i / header_t::block;
+        const int tag = tags_[i];
+
+        boost::uint64_t rank = 0;
+        if (tag < alternatives) {
+            std::memcpy(
+                  &rank
+                , ranks_ + (block * alternatives + tag) * sizeof(boost::uint64_t)
+                , sizeof(rank)
+                );
+        }
+
+        const unsigned char* const first = tags_ + block * header_t::block;
+        const std::size_t count = i % header_t::block;
+        std::size_t preceding = 0;
+        for (std::size_t j = 0; j < count; ++j)
+            preceding += (first[j] == tag);
+
+        return element(tag, rank + preceding);
+    }
+
+    const_iterator begin() const BOOST_NOEXCEPT
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const BOOST_NOEXCEPT
+    {
+        return const_iterator(this, size_);
+    }
+
+    // Contiguous values of the I-th bounded type, in the order of the
+    // elements holding them.
+    template <int I>
+    const typename detail::variant::variant_alternative<Variant, I>::type*
+    column_begin() const BOOST_NOEXCEPT
+    {
+        typedef typename detail::variant::variant_alternative<Variant, I>::type alternative_t;
+        return reinterpret_cast<const alternative_t*>(columns_[I]);
+    }
+
+    template <int I>
+    const typename detail::variant::variant_alternative<Variant, I>::type*
+    column_end() const BOOST_NOEXCEPT
+    {
+        return column_begin<I>() + column_sizes_[I];
+    }
+
+private: // helpers
+
+    template <std::size_t... I>
+    void init_columns(const unsigned char* base, std::size_t size, std::size_t& total, detail::variant::index_sequence<I...>)
+    {
+        int expand[] = { 0, (columnar_variants::init_column<static_cast<int>(I)>(base, size, total), 0)... };
+        (void)expand;
+    }
+
+    template <int I>
+    void init_column(const unsigned char* base, std::size_t size, std::size_t& total)
+    {
+        typedef typename detail::variant::variant_alternative<Variant, I>::type alternative_t;
+
+        header_t::column column;
+        std::memcpy(&column, base + sizeof(header_t) + I * sizeof(column), sizeof(column));
+        if (column.size != sizeof(alternative_t)
+            || column.align != boost::alignment_of<alternative_t>::value
+            || column.offset > size
+            || column.count > (size - column.offset) / sizeof(alternative_t)
+            || reinterpret_cast<std::size_t>(base + column.offset) % boost::alignment_of<alternative_t>::value)
+        {
+            boost::throw_exception(bad_variant_decode());
+        }
+
+        columns_[I] = base + column.offset;
+        column_sizes_[I] = static_cast<std::size_t>(column.count);
+        strides_[I] = sizeof(alternative_t);
+        total += column_sizes_[I];
+    }
+
+    const_reference element(int tag, boost::uint64_t rank) const
+    {
+        if (tag >= alternatives || rank >= column_sizes_[tag])
+            boost::throw_exception(bad_variant_decode());
+
+        return const_reference(
+              tag
+            , columns_[tag] + static_cast<std::size_t>(rank) * strides_[tag]
+            );
+    }
+
+public: // iterator
+
+    // Sequential access: keeps the position in each of the columns.
+    class const_iterator
+    {
+    public: // typedefs
+
+        typedef std::input_iterator_tag iterator_category;
+        typedef columnar_variant_ref<Variant> value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const value_type* pointer;
+        typedef value_type reference;
+
+    private: // representation
+
+        const columnar_variants* view_;
+        std::size_t index_;
+        boost::uint64_t ranks_[alternatives];
+
+    public: // structors
+
+        const_iterator() BOOST_NOEXCEPT
+            : view_(nullptr)
+            , index_(0)
+        {
+        }
+
+        const_iterator(const columnar_variants* view, std::size_t index) BOOST_NOEXCEPT
+            : view_(view)
+            , index_(index)
+        {
+            for (int k = 0; k != alternatives; ++k)
+                ranks_[k] = 0;
+        }
+
+    public: // iterator interface
+
+        reference operator*() const
+        {
+            const int tag = view_->tags_[index_];
+            return view_->element(tag, tag < alternatives ? ranks_[tag] : 0);
+        }
+
+        const_iterator& operator++()
+        {
+            const int tag = view_->tags_[index_];
+            if (tag < alternatives)
+                ++ranks_[tag];
+
+            ++index_;
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            const_iterator tmp(*this);
+            ++*this;
+            return tmp;
+        }
+
+        friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) BOOST_NOEXCEPT
+        {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs) BOOST_NOEXCEPT
+        {
+            return lhs.index_ != rhs.index_;
+        }
+    };
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// function template write_columnar_variants
+//
+// Writes the variants of [first, last) to the stream in the columnar format.
+// Makes one pass over the range for the tags and one per bounded type.
+//
+template <typename ForwardIt>
+inline std::ostream& write_columnar_variants(ForwardIt first, ForwardIt last, std::ostream& os)
+{
+    typedef typename boost::remove_cv<
+        typename std::iterator_traits<ForwardIt>::value_type
+    >::type variant_t;
+    typedef detail::variant::columnar_traits<variant_t> traits_t;
+    typedef detail::variant::columnar_header header_t;
+
+    const int alternatives = traits_t::alternatives;
+
+    header_t::column columns[alternatives];
+    for (int k = 0; k != alternatives; ++k)
+        columns[k].count = 0;
+
+    std::size_t count = 0;
+    for (ForwardIt it = first; it != last; ++it, ++count)
+        ++columns[it->which()].count;
+
+    header_t header;
+    std::memcpy(header.magic_, header_t::magic(), sizeof(header.magic_));
+    header.byte_order = header_t::byte_order_mark;
+    header.alternatives = static_cast<boost::uint32_t>(alternatives);
+    header.count = count;
+    header.tags_offset = traits_t::header_size();
+    header.ranks_offset = traits_t::align_up(header.tags_offset + count);
+
+    boost::uint64_t offsets[alternatives];
+    std::size_t offset = static_cast<std::size_t>(header.ranks_offset)
+        + traits_t::blocks(count) * alternatives * sizeof(boost::uint64_t);
+    traits_t::describe_columns(columns);
+    for (int k = 0; k != alternatives; ++k) {
+        offset = traits_t::align_up(offset);
+        columns[k].offset = offsets[k] = offset;
+        offset += static_cast<std::size_t>(columns[k].count) * columns[k].size;
+    }
+
+    detail::variant::columnar_writer writer(os);
+    writer.write(&header, sizeof(header));
+    writer.write(columns, sizeof(columns));
+
+    for (ForwardIt it = first; it != last; ++it) {
+        const unsigned char tag = static_cast<unsigned char>(it->which());
+        writer.write(&tag, 1);
+    }
+
+    writer.pad_to(static_cast<std::size_t>(header.ranks_offset));
+    boost::uint64_t ranks[alternatives] = {};
+    std::size_t i = 0;
+    for (ForwardIt it = first; it != last; ++it, ++i) {
+        if (i % header_t::block == 0)
+            writer.write(ranks, sizeof(ranks));
+
+        ++ranks[it->which()];
+    }
+
+    mpl::for_each< mpl::range_c<int, 0, alternatives> >(
+        detail::variant::columnar_column_writer<ForwardIt>(writer, first, last, offsets)
+    );
+
+    return os;
+}
+
+} // namespace boost
+
+#endif // BOOST_VARIANT_COLUMNAR_HPP
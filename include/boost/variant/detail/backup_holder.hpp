@@ -16,9 +16,62 @@
 #include <boost/config.hpp>
 #include <boost/assert.hpp>
 
+#if defined(BOOST_VARIANT_BACKUP_POOL) || defined(BOOST_VARIANT_BACKUP_ALLOCATOR)
+#   include <boost/variant/backup_pool.hpp>
+#   include <boost/core/no_exceptions_support.hpp>
+#   include <boost/type_traits/alignment_of.hpp>
+#endif
+
 namespace boost {
 namespace detail { namespace variant {
 
+///////////////////////////////////////////////////////////////////////////////
+// (detail) function templates new_backup and delete_backup
+//
+// Allocate and free the heap backups, with the backup allocator of
+// boost/variant/backup_pool.hpp if BOOST_VARIANT_BACKUP_POOL or
+// BOOST_VARIANT_BACKUP_ALLOCATOR is #defined, else with new and delete.
+//
+template <typename T>
+T* new_backup(const T& operand)
+{
+#if defined(BOOST_VARIANT_BACKUP_POOL) || defined(BOOST_VARIANT_BACKUP_ALLOCATOR)
+    void* const storage = backup_allocator::allocate(
+          sizeof(T), ::boost::alignment_of<T>::value
+        );
+
+    BOOST_TRY
+    {
+        return ::new(storage) T(operand);
+    }
+    BOOST_CATCH (...)
+    {
+        backup_allocator::deallocate(
+              storage, sizeof(T), ::boost::alignment_of<T>::value
+            );
+        BOOST_RETHROW;
+    }
+    BOOST_CATCH_END
+#else
+    return new T(operand);
+#endif
+}
+
+template <typename T>
+void delete_backup(T* backup) BOOST_NOEXCEPT
+{
+#if defined(BOOST_VARIANT_BACKUP_POOL) || defined(BOOST_VARIANT_BACKUP_ALLOCATOR)
+    if (backup) {
+        backup->~T();
+        backup_allocator::deallocate(
+              backup, sizeof(T), ::boost::alignment_of<T>::value
+            );
+    }
+#else
+    delete backup;
+#endif
+}
+
 template <typename T>
 class backup_holder
 {
@@ -30,7 +83,7 @@ public: // structors
 
     ~backup_holder() BOOST_NOEXCEPT
     {
-        delete backup_;
+        delete_backup(backup_);
     }
 
     explicit backup_holder(T* backup) BOOST_NOEXCEPT
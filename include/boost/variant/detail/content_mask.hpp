@@ -0,0 +1,172 @@
+//-----------------------------------------------------------------------------
+// boost variant/detail/content_mask.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_DETAIL_CONTENT_MASK_HPP
+#define BOOST_VARIANT_DETAIL_CONTENT_MASK_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <boost/variant/detail/type_pack.hpp>
+
+#include <cstddef> // for std::size_t
+#include <cstring> // for std::memcpy
+
+#include <boost/cstdint.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/not.hpp>
+#include <boost/type_traits/has_trivial_destructor.hpp>
+#include <boost/type_traits/is_empty.hpp>
+#include <boost/type_traits/is_trivially_copyable.hpp>
+
+namespace boost { namespace detail { namespace variant {
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) metafunction class not_pred
+//
+// Negation of the unary metafunction class Pred.
+//
+template <typename Pred>
+struct not_pred
+{
+    template <typename T>
+    struct apply
+        : mpl::not_< typename Pred::template apply<T>::type >
+    {
+    };
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template content_mask
+//
+// Whether the unary metafunction class Pred holds for the internal type of
+// each index, as a bit mask, and whether it holds for all or any of them.
+// Backup is the answer for a heap backup (negative internal which). The
+// indices past 64 are taken as not satisfying Pred.
+//
+template <typename Types, typename Pred, bool Backup>
+struct content_mask
+    : content_mask<typename as_type_pack<Types>::type, Pred, Backup>
+{
+};
+
+template <typename... T, typename Pred, bool Backup>
+struct content_mask< type_pack<T...>, Pred, Backup >
+{
+    typedef mpl::bool_<
+          type_pack_find_if< type_pack<T...>, not_pred<Pred> >::value == -1
+        > all;
+
+    typedef mpl::bool_<
+          type_pack_find_if< type_pack<T...>, Pred >::value != -1
+        > any;
+
+    static constexpr boost::uint64_t value = static_mask<sizeof...(T)>({
+        Pred::template apply<T>::type::value...
+    });
+
+    static bool content(int internal_which) BOOST_NOEXCEPT
+    {
+        return internal_which < 0
+            ? Backup
+            : all::value || (
+                any::value
+                && internal_which < 64
+                && ((value >> internal_which) & 1u) != 0
+            );
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+template <typename... T, typename Pred, bool Backup>
+constexpr boost::uint64_t content_mask< type_pack<T...>, Pred, Backup >::value;
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template content_sizes
+//
+// The number of bytes holding the value of the internal type of each index
+// for which Pred holds (none for an empty class, or if Pred does not hold),
+// and the largest of them.
+//
+template <typename Types, typename Pred>
+struct content_sizes
+    : content_sizes<typename as_type_pack<Types>::type, Pred>
+{
+};
+
+template <typename... T, typename Pred>
+struct content_sizes< type_pack<T...>, Pred >
+{
+    static constexpr std::size_t values[sizeof...(T)] = {
+        (Pred::template apply<T>::type::value && !is_empty<T>::value ? sizeof(T) : 0)...
+    };
+
+    static constexpr std::size_t max = static_max<sizeof...(T)>({
+        (Pred::template apply<T>::type::value && !is_empty<T>::value ? sizeof(T) : 0)...
+    });
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+template <typename... T, typename Pred>
+constexpr std::size_t content_sizes< type_pack<T...>, Pred >::values[sizeof...(T)];
+
+template <typename... T, typename Pred>
+constexpr std::size_t content_sizes< type_pack<T...>, Pred >::max;
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) function template copy_content
+//
+// Copies the size bytes of a content, at most Max (a content_sizes max): the
+// sizes of the common scalars inline, the others by a call.
+//
+template <std::size_t Max>
+inline void copy_content(void* storage, const void* source, std::size_t size) BOOST_NOEXCEPT
+{
+    if (Max >= sizeof(double) && size == sizeof(double))
+        std::memcpy(storage, source, sizeof(double));
+    else if (Max >= sizeof(int) && size == sizeof(int))
+        std::memcpy(storage, source, sizeof(int));
+    else if (size != 0)
+        std::memcpy(storage, source, size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) metafunction classes trivially_destructible_pred and
+// trivially_copyable_pred
+//
+// The contents that variant destroys without visitation, and copies or
+// moves as bytes.
+//
+struct trivially_destructible_pred
+{
+    template <typename T>
+    struct apply
+        : mpl::bool_< has_trivial_destructor<T>::value >
+    {
+    };
+};
+
+struct trivially_copyable_pred
+{
+    template <typename T>
+    struct apply
+        : mpl::bool_< is_trivially_copyable<T>::value >
+    {
+    };
+};
+
+}}} // namespace boost::detail::variant
+
+#endif // BOOST_VARIANT_DETAIL_CONTENT_MASK_HPP
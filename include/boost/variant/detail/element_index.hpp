@@ -18,6 +18,8 @@
 
 #include <boost/type_traits/remove_cv.hpp>
 #include <boost/type_traits/remove_reference.hpp>
+#include <boost/mpl/begin_end.hpp>
+#include <boost/mpl/distance.hpp>
 #include <boost/mpl/find_if.hpp>
 
 namespace boost { namespace detail { namespace variant {
@@ -57,6 +59,14 @@ struct holds_element :
     >
 {};
 
+// Index of T in the bounded types of Variant.
+template <class Variant, class T>
+struct element_position :
+    boost::mpl::distance<
+        typename boost::mpl::begin<typename Variant::types>::type,
+        typename element_iterator<Variant, T>::type
+    >::type
+{};
 
 }}} // namespace boost::detail::variant
 
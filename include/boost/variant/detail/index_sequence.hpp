@@ -0,0 +1,46 @@
+//  Boost.Varaint
+//  Contains C++11 implementation of the C++14 index_sequence
+//
+//  See http://www.boost.org for most recent version, including documentation.
+//
+//  Copyright Antony Polukhin, 2013-2024.
+//  Copyright agent, 2026.
+//
+//  Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt).
+
+#ifndef BOOST_VARIANT_DETAIL_INDEX_SEQUENCE_HPP
+#define BOOST_VARIANT_DETAIL_INDEX_SEQUENCE_HPP
+
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <cstddef> // for std::size_t
+
+namespace boost { 
+
+namespace detail { namespace variant {
+
+    // Implementing some of the C++14 features in C++11
+    template <std::size_t... I> class index_sequence
+    {
+    public:
+        typedef index_sequence type;
+    };
+
+    template <std::size_t N, std::size_t... I> 
+    struct make_index_sequence 
+        : make_index_sequence<N-1, N-1, I...> 
+    {};
+    template <std::size_t... I> 
+    struct make_index_sequence<0, I...> 
+        : index_sequence<I...> 
+    {};
+
+}} // namespace detail::variant
+
+} // namespace boost
+
+#endif // BOOST_VARIANT_DETAIL_INDEX_SEQUENCE_HPP
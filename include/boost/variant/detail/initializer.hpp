@@ -87,6 +87,7 @@ struct make_initializer_node
         public: // static functions
 
             using base::initialize;
+            using base::select;
 
             static int initialize(void* dest, param_T operand)
             {
@@ -108,6 +109,11 @@ struct make_initializer_node
                 new(dest) value_T( boost::detail::variant::move(operand) );
                 return BOOST_MPL_AUX_VALUE_WKND(index)::value; // which
             }
+
+            // Unevaluated counterparts of initialize, whose result type is
+            // the index of the bounded type that overload resolution picks:
+            static index select(param_T);
+            static index select(param2_T);
         };
 
         friend class initializer_node;
@@ -124,14 +130,15 @@ struct make_initializer_node
 
 // (detail) class initializer_root
 //
-// Every level of the initializer hierarchy must expose the name
-// "initialize," so initializer_root provides a dummy function:
+// Every level of the initializer hierarchy must expose the names
+// "initialize" and "select," so initializer_root provides dummy functions:
 //
 class initializer_root
 {
 public: // static functions
 
     static void initialize();
+    static void select();
 
 };
 
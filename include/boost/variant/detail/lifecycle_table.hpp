@@ -0,0 +1,394 @@
+//-----------------------------------------------------------------------------
+// boost variant/detail/lifecycle_table.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_DETAIL_LIFECYCLE_TABLE_HPP
+#define BOOST_VARIANT_DETAIL_LIFECYCLE_TABLE_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <boost/variant/detail/backup_holder.hpp>
+#include <boost/variant/detail/move.hpp>
+#include <boost/variant/detail/type_pack.hpp>
+#include <boost/variant/detail/variant_access.hpp>
+
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/and.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/mpl/not.hpp>
+#include <boost/mpl/or.hpp>
+#include <boost/type_index.hpp>
+#include <boost/type_traits/declval.hpp>
+#include <boost/type_traits/has_nothrow_copy.hpp>
+#include <boost/type_traits/has_trivial_assign.hpp>
+#include <boost/type_traits/has_trivial_copy.hpp>
+#include <boost/type_traits/has_trivial_destructor.hpp>
+#include <boost/type_traits/has_trivial_move_assign.hpp>
+#include <boost/type_traits/has_trivial_move_constructor.hpp>
+#include <boost/type_traits/is_nothrow_move_constructible.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+
+#include <cstddef> // for std::size_t
+#include <cstring> // for std::memcpy
+
+namespace boost { namespace detail { namespace variant {
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template lifecycle_content
+//
+// Access to the internal type T in variant storage, which holds a
+// backup_holder<T> if internal_which is negative.
+//
+// NoBackupFlag must be mpl::true_ or mpl::false_ (not the flag of a
+// particular variant), so that the functions for T are shared by all the
+// variants that have T among their bounded types.
+//
+template <typename T, typename NoBackupFlag>
+struct lifecycle_content
+{
+    // Mirrors the never_uses_backup computation of visitation_impl_invoke:
+    typedef typename mpl::or_<
+          NoBackupFlag
+        , is_nothrow_move_constructible<T>
+        , has_nothrow_copy<T>
+        >::type never_uses_backup;
+
+    static T& get(void* storage, int internal_which) BOOST_NOEXCEPT
+    {
+        return ::boost::detail::variant::unchecked_internal_content<T>(
+            internal_which, storage, never_uses_backup()
+        );
+    }
+
+    static const T& get(const void* storage, int internal_which) BOOST_NOEXCEPT
+    {
+        return ::boost::detail::variant::unchecked_internal_content<const T>(
+            internal_which, storage, never_uses_backup()
+        );
+    }
+
+    static void destroy(void* storage, int, mpl::true_) BOOST_NOEXCEPT
+    {
+        static_cast<T*>(storage)->~T();
+    }
+
+    static void destroy(void* storage, int internal_which, mpl::false_) BOOST_NOEXCEPT
+    {
+        if (internal_which >= 0)
+            static_cast<T*>(storage)->~T();
+        else
+            static_cast<backup_holder<T>*>(storage)->~backup_holder<T>();
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) trivial lifecycle functions
+//
+// Shared by all the types with trivial operations: one function per size
+// instead of one per type.
+//
+struct lifecycle_trivial_destroy
+{
+    static void call(void*, int) BOOST_NOEXCEPT
+    {
+    }
+};
+
+template <std::size_t Size>
+struct lifecycle_trivial_copy
+{
+    static void call(void* storage, const void* source, int) BOOST_NOEXCEPT
+    {
+        std::memcpy(storage, source, Size);
+    }
+
+    static void call(void* storage, void* source, int) BOOST_NOEXCEPT
+    {
+        std::memcpy(storage, source, Size);
+    }
+};
+
+template <typename T, typename NoBackupFlag, typename Trivial>
+struct lifecycle_select_trivial
+    : mpl::and_<
+          typename lifecycle_content<T, NoBackupFlag>::never_uses_backup
+        , Trivial
+        >
+{
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) lifecycle operations
+//
+// Metafunction classes: apply<T>::call performs the operation on storage
+// holding the internal type T, or is a trivial function shared with the
+// other types of the same size. They replace the destroyer, copy_into,
+// move_into, assign_storage, move_storage, swap_with, reflect and comparer
+// visitors when BOOST_VARIANT_MINIMIZE_CODE_SIZE is defined.
+//
+template <typename NoBackupFlag>
+struct lifecycle_destroy
+{
+    typedef void (*function_type)(void*, int);
+
+    template <typename T>
+    struct apply_impl
+    {
+        static void call(void* storage, int internal_which) BOOST_NOEXCEPT
+        {
+            typedef lifecycle_content<T, NoBackupFlag> content;
+            content::destroy(storage, internal_which, typename content::never_uses_backup());
+        }
+    };
+
+    template <typename T>
+    struct apply
+        : mpl::if_<
+              lifecycle_select_trivial<T, NoBackupFlag, has_trivial_destructor<T> >
+            , lifecycle_trivial_destroy
+            , apply_impl<T>
+            >::type
+    {
+    };
+};
+
+template <typename NoBackupFlag>
+struct lifecycle_copy_construct
+{
+    typedef void (*function_type)(void*, const void*, int);
+
+    template <typename T>
+    struct apply_impl
+    {
+        static void call(void* storage, const void* source, int source_internal_which)
+        {
+            new(storage) T( lifecycle_content<T, NoBackupFlag>::get(source, source_internal_which) );
+        }
+    };
+
+    template <typename T>
+    struct apply
+        : mpl::if_<
+              lifecycle_select_trivial<T, NoBackupFlag, has_trivial_copy<T> >
+            , lifecycle_trivial_copy<sizeof(T)>
+            , apply_impl<T>
+            >::type
+    {
+    };
+};
+
+template <typename NoBackupFlag>
+struct lifecycle_move_construct
+{
+    typedef void (*function_type)(void*, void*, int);
+
+    template <typename T>
+    struct apply_impl
+    {
+        static void call(void* storage, void* source, int source_internal_which)
+        {
+            new(storage) T( ::boost::detail::variant::move(
+                lifecycle_content<T, NoBackupFlag>::get(source, source_internal_which)
+            ) );
+        }
+    };
+
+    template <typename T>
+    struct apply
+        : mpl::if_<
+              lifecycle_select_trivial<T, NoBackupFlag, has_trivial_move_constructor<T> >
+            , lifecycle_trivial_copy<sizeof(T)>
+            , apply_impl<T>
+            >::type
+    {
+    };
+};
+
+// Precondition: both storages have the same internal which
+template <typename NoBackupFlag>
+struct lifecycle_copy_assign
+{
+    typedef void (*function_type)(void*, const void*, int);
+
+    template <typename T>
+    struct apply_impl
+    {
+        static void call(void* storage, const void* source, int internal_which)
+        {
+            typedef lifecycle_content<T, NoBackupFlag> content;
+
+            // NOTE TO USER :
+            // Compile error here indicates one of variant's bounded types does
+            // not meet the requirements of the Assignable concept. Thus,
+            // variant is not Assignable.
+            //
+            content::get(storage, internal_which) = content::get(source, internal_which);
+        }
+    };
+
+    template <typename T>
+    struct apply
+        : mpl::if_<
+              lifecycle_select_trivial<T, NoBackupFlag, has_trivial_assign<T> >
+            , lifecycle_trivial_copy<sizeof(T)>
+            , apply_impl<T>
+            >::type
+    {
+    };
+};
+
+// Precondition: both storages have the same internal which
+template <typename NoBackupFlag>
+struct lifecycle_move_assign
+{
+    typedef void (*function_type)(void*, void*, int);
+
+    template <typename T>
+    struct apply_impl
+    {
+        static void call(void* storage, void* source, int internal_which)
+        {
+            typedef lifecycle_content<T, NoBackupFlag> content;
+            content::get(storage, internal_which)
+                = ::boost::detail::variant::move(content::get(source, internal_which));
+        }
+    };
+
+    template <typename T>
+    struct apply
+        : mpl::if_<
+              lifecycle_select_trivial<T, NoBackupFlag, has_trivial_move_assign<T> >
+            , lifecycle_trivial_copy<sizeof(T)>
+            , apply_impl<T>
+            >::type
+    {
+    };
+};
+
+// Precondition: both storages hold the same logical type. Swaps the
+// unwrapped values, as swap_with does.
+template <typename NoBackupFlag>
+struct lifecycle_swap
+{
+    typedef void (*function_type)(void*, int, void*, int);
+
+    template <typename T>
+    struct apply
+    {
+        static void call(void* lhs, int lhs_internal_which, void* rhs, int rhs_internal_which)
+        {
+            typedef lifecycle_content<T, NoBackupFlag> content;
+            ::boost::detail::variant::move_swap(
+                  ::boost::detail::variant::unwrap_internal(content::get(lhs, lhs_internal_which))
+                , ::boost::detail::variant::unwrap_internal(content::get(rhs, rhs_internal_which))
+                );
+        }
+    };
+};
+
+struct lifecycle_type
+{
+    typedef const boost::typeindex::type_info& (*function_type)();
+
+    template <typename T>
+    struct apply
+    {
+        static const boost::typeindex::type_info& call() BOOST_NOEXCEPT
+        {
+            typedef typename boost::remove_reference<
+                  decltype(::boost::detail::variant::unwrap_internal(boost::declval<T&>()))
+                >::type unwrapped_t;
+
+            return boost::typeindex::type_id<unwrapped_t>().type_info();
+        }
+    };
+};
+
+// Precondition: both storages hold the same logical type
+template <typename NoBackupFlag, typename Comp>
+struct lifecycle_compare
+{
+    typedef bool (*function_type)(const void*, int, const void*, int);
+
+    template <typename T>
+    struct apply
+    {
+        static bool call(const void* lhs, int lhs_internal_which, const void* rhs, int rhs_internal_which)
+        {
+            typedef lifecycle_content<T, NoBackupFlag> content;
+            return Comp()(
+                  ::boost::detail::variant::unwrap_internal(content::get(lhs, lhs_internal_which))
+                , ::boost::detail::variant::unwrap_internal(content::get(rhs, rhs_internal_which))
+                );
+        }
+    };
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) metafunction lifecycle_all_nothrow
+//
+// True if the metafunction class ThrowingPred holds for none of the types.
+//
+struct lifecycle_throwing_copy
+{
+    template <typename T>
+    struct apply
+        : mpl::not_< has_nothrow_copy<T> >
+    {
+    };
+};
+
+struct lifecycle_throwing_move
+{
+    template <typename T>
+    struct apply
+        : mpl::not_< is_nothrow_move_constructible<T> >
+    {
+    };
+};
+
+template <typename Types, typename ThrowingPred>
+struct lifecycle_all_nothrow
+    : mpl::bool_<
+          type_pack_find_if<typename as_type_pack<Types>::type, ThrowingPred>::value == -1
+        >
+{
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template lifecycle_table
+//
+// Constant table of the Operation functions of each internal type,
+// indexed by which(). One class per operation: the functions of an
+// operation are instantiated only if the variant uses it.
+//
+template <typename Types, typename Operation>
+struct lifecycle_table;
+
+template <typename... T, typename Operation>
+struct lifecycle_table< type_pack<T...>, Operation >
+{
+    static constexpr typename Operation::function_type functions[sizeof...(T)] = {
+        &Operation::template apply<T>::call...
+    };
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+template <typename... T, typename Operation>
+constexpr typename Operation::function_type
+    lifecycle_table< type_pack<T...>, Operation >::functions[sizeof...(T)];
+#endif
+
+}}} // namespace boost::detail::variant
+
+#endif // BOOST_VARIANT_DETAIL_LIFECYCLE_TABLE_HPP
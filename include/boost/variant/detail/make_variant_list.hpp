@@ -14,10 +14,7 @@
 #define BOOST_VARIANT_DETAIL_MAKE_VARIANT_LIST_HPP
 
 #include <boost/variant/variant_fwd.hpp>
-
-#include <boost/mpl/list.hpp>
-#include <boost/preprocessor/cat.hpp>
-#include <boost/preprocessor/enum.hpp>
+#include <boost/variant/detail/type_pack.hpp>
 
 namespace boost { namespace detail { namespace variant {
 
@@ -34,7 +31,7 @@ namespace boost { namespace detail { namespace variant {
 template < typename... T >
 struct make_variant_list
 {
-    typedef typename mpl::list< T... >::type type;
+    typedef type_pack< T... > type;
 };
 
 }}} // namespace boost::detail::variant
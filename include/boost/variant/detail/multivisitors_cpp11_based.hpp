@@ -17,6 +17,7 @@
 #endif
 
 #include <boost/variant/detail/apply_visitor_unary.hpp>
+#include <boost/variant/detail/index_sequence.hpp>
 #include <boost/variant/variant_fwd.hpp>
 #include <boost/type_traits/is_lvalue_reference.hpp>
 #include <boost/core/enable_if.hpp>
@@ -27,18 +28,6 @@ namespace boost {
 
 namespace detail { namespace variant {
 
-    // Implementing some of the C++14 features in C++11
-    template <std::size_t... I> class index_sequence {};
-
-    template <std::size_t N, std::size_t... I> 
-    struct make_index_sequence 
-        : make_index_sequence<N-1, N-1, I...> 
-    {};
-    template <std::size_t... I> 
-    struct make_index_sequence<0, I...> 
-        : index_sequence<I...> 
-    {};
-
     template <typename T_, bool MoveSemantics_>
     struct MoveableWrapper //Just a reference with some metadata
     {
@@ -0,0 +1,396 @@
+//-----------------------------------------------------------------------------
+// boost variant/detail/type_pack.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_DETAIL_TYPE_PACK_HPP
+#define BOOST_VARIANT_DETAIL_TYPE_PACK_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <boost/variant/detail/index_sequence.hpp>
+
+#include <boost/cstdint.hpp>
+#include <boost/mpl/at_fwd.hpp>
+#include <boost/mpl/begin_end_fwd.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/clear_fwd.hpp>
+#include <boost/mpl/empty_fwd.hpp>
+#include <boost/mpl/fold.hpp>
+#include <boost/mpl/front_fwd.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/iterator_tags.hpp>
+#include <boost/mpl/long.hpp>
+#include <boost/mpl/O1_size_fwd.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/mpl/pop_front_fwd.hpp>
+#include <boost/mpl/push_back.hpp>
+#include <boost/mpl/push_front.hpp>
+#include <boost/mpl/size_fwd.hpp>
+
+#include <cstddef> // for std::size_t
+
+namespace boost { namespace detail { namespace variant {
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template type_pack
+//
+// Parameter pack of the bounded types. Unlike mpl::list, has no limit on
+// the number of types, and the metafunctions of variant expand it directly
+// instead of folding over it. Still a MPL-compatible extensible sequence,
+// as variant::types is documented to be one.
+//
+struct type_pack_tag;
+
+template <typename... T>
+struct type_pack
+{
+    typedef type_pack type;
+    typedef type_pack_tag tag;
+};
+
+template <typename Pack>
+struct type_pack_iterator;
+
+template <typename T0, typename... T>
+struct type_pack_iterator< type_pack<T0, T...> >
+{
+    typedef mpl::forward_iterator_tag category;
+    typedef T0 type;
+    typedef type_pack_iterator< type_pack<T...> > next;
+};
+
+template <>
+struct type_pack_iterator< type_pack<> >
+{
+    typedef mpl::forward_iterator_tag category;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) metafunction type_pack_element
+//
+// Provides the type with the given index, without recursion over the pack.
+//
+template <std::size_t I, typename T>
+struct type_pack_indexed
+{
+    typedef T type;
+};
+
+template <typename Indices, typename... T>
+struct type_pack_index;
+
+template <std::size_t... I, typename... T>
+struct type_pack_index< index_sequence<I...>, T... >
+    : type_pack_indexed<I, T>...
+{
+};
+
+template <std::size_t I, typename T>
+type_pack_indexed<I, T> type_pack_select(const type_pack_indexed<I, T>*);
+
+template <std::size_t I, typename Pack>
+struct type_pack_element;
+
+// The call is qualified: ADL would instantiate the types (possibly still
+// incomplete) looking for their friend functions.
+template <std::size_t I, typename... T>
+struct type_pack_element< I, type_pack<T...> >
+    : decltype(::boost::detail::variant::type_pack_select<I>(
+          static_cast<type_pack_index<
+              typename make_index_sequence<sizeof...(T)>::type, T...
+          >*>(nullptr)
+      ))
+{
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) metafunction type_pack_find_if
+//
+// Index of the first type satisfying the metafunction class Pred, or -1.
+// Stops at the first match, as mpl::find_if does: Pred is not applied to
+// the types after it, which may be incomplete.
+//
+template <typename Pack, typename Pred, int I = 0>
+struct type_pack_find_if;
+
+template <typename Pred, int I>
+struct type_pack_find_if< type_pack<>, Pred, I >
+    : mpl::int_<-1>
+{
+};
+
+template <typename T0, typename... T, typename Pred, int I>
+struct type_pack_find_if< type_pack<T0, T...>, Pred, I >
+    : mpl::if_c<
+          Pred::template apply<T0>::type::value
+        , mpl::int_<I>
+        , type_pack_find_if< type_pack<T...>, Pred, I + 1 >
+        >::type
+{
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) function templates static_max and static_lcm
+//
+// Fold arrays of constants in constant expressions. The arrays are built by
+// a pack expansion: static_max<sizeof...(T)>({ sizeof(T)... }).
+//
+template <std::size_t N>
+BOOST_CONSTEXPR std::size_t static_max(
+      const std::size_t (&values)[N], std::size_t i = 0, std::size_t result = 0
+    )
+{
+    return i == N ? result : static_max(values, i + 1, values[i] > result ? values[i] : result);
+}
+
+BOOST_CONSTEXPR inline std::size_t static_gcd(std::size_t a, std::size_t b)
+{
+    return b == 0 ? a : static_gcd(b, a % b);
+}
+
+template <std::size_t N>
+BOOST_CONSTEXPR std::size_t static_lcm(
+      const std::size_t (&values)[N], std::size_t i = 0, std::size_t result = 1
+    )
+{
+    return i == N
+        ? result
+        : static_lcm(values, i + 1, result / static_gcd(result, values[i]) * values[i]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) function template static_mask
+//
+// Bit i set if values[i], for the first 64 values: static_mask<sizeof...(T)>(
+// { is_pod<T>::value... }).
+//
+template <std::size_t N>
+BOOST_CONSTEXPR boost::uint64_t static_mask(
+      const bool (&values)[N], std::size_t i = 0, boost::uint64_t result = 0
+    )
+{
+    return i == N || i == 64
+        ? result
+        : static_mask(values, i + 1, values[i] ? result | (static_cast<boost::uint64_t>(1) << i) : result);
+}
+
+}}} // namespace boost::detail::variant
+
+///////////////////////////////////////////////////////////////////////////////
+// MPL sequence interface of type_pack
+//
+namespace boost { namespace mpl {
+
+template <>
+struct begin_impl< ::boost::detail::variant::type_pack_tag >
+{
+    template <typename Pack>
+    struct apply
+    {
+        typedef ::boost::detail::variant::type_pack_iterator<typename Pack::type> type;
+    };
+};
+
+template <>
+struct end_impl< ::boost::detail::variant::type_pack_tag >
+{
+    template <typename Pack>
+    struct apply
+    {
+        typedef ::boost::detail::variant::type_pack_iterator<
+            ::boost::detail::variant::type_pack<>
+        > type;
+    };
+};
+
+namespace aux {
+
+template <typename Pack>
+struct type_pack_size;
+
+template <typename... T>
+struct type_pack_size< ::boost::detail::variant::type_pack<T...> >
+    : long_<sizeof...(T)>
+{
+};
+
+template <typename Pack>
+struct type_pack_front;
+
+template <typename T0, typename... T>
+struct type_pack_front< ::boost::detail::variant::type_pack<T0, T...> >
+{
+    typedef T0 type;
+};
+
+template <typename Pack>
+struct type_pack_pop_front;
+
+template <typename T0, typename... T>
+struct type_pack_pop_front< ::boost::detail::variant::type_pack<T0, T...> >
+{
+    typedef ::boost::detail::variant::type_pack<T...> type;
+};
+
+template <typename Pack, typename U>
+struct type_pack_push_front;
+
+template <typename... T, typename U>
+struct type_pack_push_front< ::boost::detail::variant::type_pack<T...>, U >
+{
+    typedef ::boost::detail::variant::type_pack<U, T...> type;
+};
+
+template <typename Pack, typename U>
+struct type_pack_push_back;
+
+template <typename... T, typename U>
+struct type_pack_push_back< ::boost::detail::variant::type_pack<T...>, U >
+{
+    typedef ::boost::detail::variant::type_pack<T..., U> type;
+};
+
+} // namespace aux
+
+template <>
+struct size_impl< ::boost::detail::variant::type_pack_tag >
+{
+    template <typename Pack>
+    struct apply
+        : aux::type_pack_size<typename Pack::type>
+    {
+    };
+};
+
+template <>
+struct O1_size_impl< ::boost::detail::variant::type_pack_tag >
+    : size_impl< ::boost::detail::variant::type_pack_tag >
+{
+};
+
+template <>
+struct empty_impl< ::boost::detail::variant::type_pack_tag >
+{
+    template <typename Pack>
+    struct apply
+        : bool_<aux::type_pack_size<typename Pack::type>::value == 0>
+    {
+    };
+};
+
+template <>
+struct at_impl< ::boost::detail::variant::type_pack_tag >
+{
+    template <typename Pack, typename N>
+    struct apply
+        : ::boost::detail::variant::type_pack_element<N::value, typename Pack::type>
+    {
+    };
+};
+
+template <>
+struct front_impl< ::boost::detail::variant::type_pack_tag >
+{
+    template <typename Pack>
+    struct apply
+        : aux::type_pack_front<typename Pack::type>
+    {
+    };
+};
+
+template <>
+struct clear_impl< ::boost::detail::variant::type_pack_tag >
+{
+    template <typename Pack>
+    struct apply
+    {
+        typedef ::boost::detail::variant::type_pack<> type;
+    };
+};
+
+template <>
+struct pop_front_impl< ::boost::detail::variant::type_pack_tag >
+{
+    template <typename Pack>
+    struct apply
+        : aux::type_pack_pop_front<typename Pack::type>
+    {
+    };
+};
+
+template <>
+struct push_front_impl< ::boost::detail::variant::type_pack_tag >
+{
+    template <typename Pack, typename T>
+    struct apply
+        : aux::type_pack_push_front<typename Pack::type, T>
+    {
+    };
+};
+
+template <>
+struct has_push_front_impl< ::boost::detail::variant::type_pack_tag >
+{
+    template <typename Pack>
+    struct apply
+        : true_
+    {
+    };
+};
+
+template <>
+struct push_back_impl< ::boost::detail::variant::type_pack_tag >
+{
+    template <typename Pack, typename T>
+    struct apply
+        : aux::type_pack_push_back<typename Pack::type, T>
+    {
+    };
+};
+
+template <>
+struct has_push_back_impl< ::boost::detail::variant::type_pack_tag >
+{
+    template <typename Pack>
+    struct apply
+        : true_
+    {
+    };
+};
+
+}} // namespace boost::mpl
+
+namespace boost { namespace detail { namespace variant {
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) metafunction as_type_pack
+//
+// Copies the internal types of variants made by make_variant_over into a
+// type_pack.
+//
+template <typename Types>
+struct as_type_pack
+    : mpl::fold< Types, type_pack<>, mpl::push_back<mpl::_1, mpl::_2> >
+{
+};
+
+template <typename... T>
+struct as_type_pack< type_pack<T...> >
+{
+    typedef type_pack<T...> type;
+};
+
+}}} // namespace boost::detail::variant
+
+#endif // BOOST_VARIANT_DETAIL_TYPE_PACK_HPP
@@ -0,0 +1,131 @@
+//-----------------------------------------------------------------------------
+// boost variant/detail/uses_allocator.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_DETAIL_USES_ALLOCATOR_HPP
+#define BOOST_VARIANT_DETAIL_USES_ALLOCATOR_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <memory> // for std::allocator_arg_t, std::uses_allocator
+#include <new> // for placement new
+#include <type_traits> // for std::is_constructible, std::integral_constant
+#include <utility> // for std::forward
+
+#include <boost/mpl/int.hpp>
+#include <boost/variant/variant_fwd.hpp>
+#include <boost/variant/detail/type_pack.hpp>
+
+namespace boost { namespace detail { namespace variant {
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) function template uses_allocator_construct
+//
+// Constructs a T from args in storage by uses-allocator construction: with
+// allocator after std::allocator_arg or as trailing argument if T uses
+// Allocator, else without allocator.
+//
+template <typename T, typename Allocator, typename... Args>
+struct uses_allocator_form
+    : mpl::int_<
+          !std::uses_allocator<T, Allocator>::value
+            ? 0
+        : std::is_constructible<T, std::allocator_arg_t, const Allocator&, Args...>::value
+            ? 1
+            : 2
+      >
+{
+};
+
+template <typename T, typename Allocator, typename... Args>
+inline void uses_allocator_construct_impl(
+      mpl::int_<0>, void* storage, const Allocator&, Args&&... args
+    )
+{
+    new(storage) T(std::forward<Args>(args)...);
+}
+
+template <typename T, typename Allocator, typename... Args>
+inline void uses_allocator_construct_impl(
+      mpl::int_<1>, void* storage, const Allocator& allocator, Args&&... args
+    )
+{
+    new(storage) T(std::allocator_arg, allocator, std::forward<Args>(args)...);
+}
+
+template <typename T, typename Allocator, typename... Args>
+inline void uses_allocator_construct_impl(
+      mpl::int_<2>, void* storage, const Allocator& allocator, Args&&... args
+    )
+{
+    new(storage) T(std::forward<Args>(args)..., allocator);
+}
+
+template <typename T, typename Allocator, typename... Args>
+inline void uses_allocator_construct(
+      void* storage, const Allocator& allocator, Args&&... args
+    )
+{
+    ::boost::detail::variant::uses_allocator_construct_impl<T>(
+          uses_allocator_form<T, Allocator, Args&&...>()
+        , storage, allocator, std::forward<Args>(args)...
+        );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) metafunction any_uses_allocator
+//
+// Whether any of the bounded types T uses Allocator.
+//
+template <typename Allocator>
+struct uses_allocator_pred
+{
+    template <typename T>
+    struct apply
+        : std::uses_allocator<T, Allocator>
+    {
+    };
+};
+
+template <typename Allocator, typename... T>
+struct any_uses_allocator
+    : std::integral_constant<
+          bool
+        , type_pack_find_if< type_pack<T...>, uses_allocator_pred<Allocator> >::value != -1
+        >
+{
+};
+
+}}} // namespace boost::detail::variant
+
+///////////////////////////////////////////////////////////////////////////////
+// macro BOOST_VARIANT_DO_NOT_SPECIALIZE_STD_USES_ALLOCATOR
+//
+// Define this macro if you do not wish to have a std::uses_allocator
+// specialization for boost::variant. With it, the allocator aware
+// containers construct their variant elements with their allocator.
+//
+
+#if !defined(BOOST_VARIANT_DO_NOT_SPECIALIZE_STD_USES_ALLOCATOR)
+
+namespace std {
+    template < BOOST_VARIANT_ENUM_PARAMS(typename T), typename Allocator >
+    struct uses_allocator< boost::variant< BOOST_VARIANT_ENUM_PARAMS(T) >, Allocator >
+        : boost::detail::variant::any_uses_allocator< Allocator, BOOST_VARIANT_ENUM_PARAMS(T) >
+    {
+    };
+}
+
+#endif // #if !defined(BOOST_VARIANT_DO_NOT_SPECIALIZE_STD_USES_ALLOCATOR)
+
+#endif // BOOST_VARIANT_DETAIL_USES_ALLOCATOR_HPP
@@ -0,0 +1,241 @@
+//-----------------------------------------------------------------------------
+// boost variant/detail/variant_access.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_DETAIL_VARIANT_ACCESS_HPP
+#define BOOST_VARIANT_DETAIL_VARIANT_ACCESS_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <boost/variant/variant_fwd.hpp>
+#include <boost/variant/boxed_fwd.hpp>
+#include <boost/variant/recursive_wrapper_fwd.hpp>
+#include <boost/variant/detail/backup_holder.hpp>
+
+#include <boost/detail/reference_content.hpp>
+#include <boost/mpl/at.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/mpl/or.hpp>
+#include <boost/mpl/size.hpp>
+#include <boost/type_traits/add_const.hpp>
+#include <boost/type_traits/add_reference.hpp>
+#include <boost/type_traits/has_nothrow_copy.hpp>
+#include <boost/type_traits/is_const.hpp>
+#include <boost/type_traits/is_nothrow_move_constructible.hpp>
+#include <boost/type_traits/remove_const.hpp>
+
+namespace boost { namespace detail { namespace variant {
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class variant_access
+//
+// Grants library components direct access to the discriminator and the
+// storage of a variant, so that they may skip visitation when the type of
+// the content is already known.
+//
+struct variant_access
+{
+    template <typename Variant>
+    struct internal_types
+    {
+        typedef typename boost::remove_const<Variant>::type variant_t;
+        typedef typename variant_t::internal_types type;
+    };
+
+    template <typename Variant>
+    struct never_uses_backup_flag
+    {
+        typedef typename boost::remove_const<Variant>::type variant_t;
+        typedef typename variant_t::never_uses_backup_flag type;
+    };
+
+    template <typename Variant>
+    static int internal_which(const Variant& operand) BOOST_NOEXCEPT
+    {
+        return operand.which_;
+    }
+
+    // Precondition: the storage holds the content of the given index
+    template <typename Variant>
+    static void indicate_which(Variant& operand, int which) BOOST_NOEXCEPT
+    {
+        operand.indicate_which(which);
+    }
+
+    template <typename Variant>
+    static void* storage(Variant& operand) BOOST_NOEXCEPT
+    {
+        return operand.storage_.address();
+    }
+
+    template <typename Variant>
+    static const void* storage(const Variant& operand) BOOST_NOEXCEPT
+    {
+        return operand.storage_.address();
+    }
+
+    template <typename Variant, typename Visitor>
+    static typename Visitor::result_type
+    internal_apply_visitor(Variant& operand, Visitor& visitor)
+    {
+        return operand.internal_apply_visitor(visitor);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) metafunction variant_alternative
+//
+// Provides the bounded type with the given index and its internal (possibly
+// wrapped) representation.
+//
+template <typename Variant, int I>
+struct variant_alternative
+{
+    typedef typename boost::remove_const<Variant>::type variant_t;
+
+    typedef typename mpl::at_c<typename variant_t::types, I>::type type;
+    typedef typename mpl::at_c<
+          typename variant_access::internal_types<variant_t>::type, I
+        >::type internal_type;
+
+    // Mirrors the never_uses_backup computation of visitation_impl_invoke:
+    typedef typename mpl::or_<
+          typename variant_access::never_uses_backup_flag<variant_t>::type
+        , is_nothrow_move_constructible<internal_type>
+        , has_nothrow_copy<internal_type>
+        >::type never_uses_backup;
+};
+
+template <typename Variant>
+struct variant_size
+    : mpl::size<typename boost::remove_const<Variant>::type::types>
+{
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) function template unwrap_internal
+//
+// Strips the internal wrappers (recursive_wrapper, boxed and
+// reference_content)
+// from the content of variant storage.
+//
+template <typename T>
+inline T& unwrap_internal(T& operand) BOOST_NOEXCEPT
+{
+    return operand;
+}
+
+template <typename T>
+inline T& unwrap_internal(boost::recursive_wrapper<T>& operand) BOOST_NOEXCEPT
+{
+    return operand.get();
+}
+
+template <typename T>
+inline const T& unwrap_internal(const boost::recursive_wrapper<T>& operand) BOOST_NOEXCEPT
+{
+    return operand.get();
+}
+
+template <typename T, typename Allocator>
+inline T& unwrap_internal(boost::boxed<T, Allocator>& operand) BOOST_NOEXCEPT
+{
+    return operand.get();
+}
+
+template <typename T, typename Allocator>
+inline const T& unwrap_internal(const boost::boxed<T, Allocator>& operand) BOOST_NOEXCEPT
+{
+    return operand.get();
+}
+
+template <typename T>
+inline T& unwrap_internal(boost::detail::reference_content<T&>& operand) BOOST_NOEXCEPT
+{
+    return operand.get();
+}
+
+template <typename T>
+inline T& unwrap_internal(const boost::detail::reference_content<T&>& operand) BOOST_NOEXCEPT
+{
+    return operand.get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) function template unchecked_get
+//
+// Returns a reference to the content of the given variant.
+//
+// Precondition: operand.which() == I
+//
+template <typename InternalT, typename VoidPtrCV>
+inline InternalT& unchecked_internal_content(int, VoidPtrCV storage, mpl::true_ /*never_uses_backup*/) BOOST_NOEXCEPT
+{
+    return *static_cast<InternalT*>(storage);
+}
+
+template <typename InternalT, typename VoidPtrCV>
+inline InternalT& unchecked_internal_content(int internal_which, VoidPtrCV storage, mpl::false_ /*never_uses_backup*/) BOOST_NOEXCEPT
+{
+    typedef typename boost::remove_const<InternalT>::type internal_t;
+    typedef typename boost::add_const<backup_holder<internal_t> >::type const_holder_t;
+    typedef typename mpl::if_<
+          boost::is_const<InternalT>, const_holder_t, backup_holder<internal_t>
+        >::type holder_t;
+
+    if (internal_which >= 0)
+        return *static_cast<InternalT*>(storage);
+
+    return static_cast<holder_t*>(storage)->get();
+}
+
+template <int I, typename Variant>
+inline typename add_reference<
+      typename variant_alternative<Variant, I>::type
+    >::type
+unchecked_get(Variant& operand) BOOST_NOEXCEPT
+{
+    typedef variant_alternative<Variant, I> alternative_t;
+    typedef typename alternative_t::internal_type internal_t;
+
+    return ::boost::detail::variant::unwrap_internal(
+        ::boost::detail::variant::unchecked_internal_content<internal_t>(
+              variant_access::internal_which(operand)
+            , variant_access::storage(operand)
+            , typename alternative_t::never_uses_backup()
+            )
+        );
+}
+
+template <int I, typename Variant>
+inline typename add_reference<
+      typename add_const<typename variant_alternative<Variant, I>::type>::type
+    >::type
+unchecked_get(const Variant& operand) BOOST_NOEXCEPT
+{
+    typedef variant_alternative<Variant, I> alternative_t;
+    typedef typename alternative_t::internal_type internal_t;
+
+    return ::boost::detail::variant::unwrap_internal(
+        ::boost::detail::variant::unchecked_internal_content<const internal_t>(
+              variant_access::internal_which(operand)
+            , variant_access::storage(operand)
+            , typename alternative_t::never_uses_backup()
+            )
+        );
+}
+
+}}} // namespace boost::detail::variant
+
+#endif // BOOST_VARIANT_DETAIL_VARIANT_ACCESS_HPP
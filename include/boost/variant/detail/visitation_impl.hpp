@@ -18,6 +18,7 @@
 #include <boost/variant/detail/backup_holder.hpp>
 #include <boost/variant/detail/cast_storage.hpp>
 #include <boost/variant/detail/forced_return.hpp>
+#include <boost/variant/detail/type_pack.hpp>
 #include <boost/variant/variant_fwd.hpp>
 
 #include <boost/mpl/eval_if.hpp>
@@ -88,6 +89,17 @@ struct visitation_impl_step< LastIter,LastIter >
     typedef visitation_impl_step next;
 };
 
+// Walks a type_pack without mpl::deref and mpl::next
+template <typename T0, typename... T, typename LastIter>
+struct visitation_impl_step< type_pack_iterator< type_pack<T0, T...> >, LastIter >
+{
+    typedef T0 type;
+
+    typedef visitation_impl_step<
+          type_pack_iterator< type_pack<T...> >, LastIter
+        > next;
+};
+
 
 ///////////////////////////////////////////////////////////////////////////////
 // (detail) function template visitation_impl_invoke
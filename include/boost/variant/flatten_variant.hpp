@@ -0,0 +1,353 @@
+//-----------------------------------------------------------------------------
+// boost variant/flatten_variant.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_FLATTEN_VARIANT_HPP
+#define BOOST_VARIANT_FLATTEN_VARIANT_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <boost/variant/variant.hpp>
+#include <boost/variant/static_visitor.hpp>
+#include <boost/variant/detail/move.hpp>
+#include <boost/variant/detail/type_pack.hpp>
+
+#include <boost/mpl/deref.hpp>
+#include <boost/mpl/find_if.hpp>
+#include <boost/mpl/fold.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/type_traits/is_lvalue_reference.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_const.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+#include <boost/utility/enable_if.hpp>
+
+#include <utility> // for std::forward
+
+namespace boost {
+
+namespace detail { namespace variant {
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) metafunction flat_leaves
+//
+// Appends to the type_pack Pack the leaves of T: T itself, or the leaves of
+// the bounded types of T if it is a variant. The types already in Pack are
+// not appended again.
+//
+template <typename T>
+struct same_as
+{
+    template <typename U>
+    struct apply
+        : is_same<U, T>
+    {
+    };
+};
+
+template <typename Pack, typename T>
+struct flat_append;
+
+template <typename... U, typename T>
+struct flat_append< type_pack<U...>, T >
+    : mpl::if_c<
+          type_pack_find_if< type_pack<U...>, same_as<T> >::value == -1
+        , type_pack<U..., T>
+        , type_pack<U...>
+        >
+{
+};
+
+template <typename Pack, typename T>
+struct flat_leaves
+    : flat_append<Pack, T>
+{
+};
+
+template <typename Pack, BOOST_VARIANT_ENUM_PARAMS(typename T)>
+struct flat_leaves< Pack, boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)> >
+    : mpl::fold<
+          typename boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)>::types
+        , Pack
+        , flat_leaves<mpl::_1, mpl::_2>
+        >
+{
+};
+
+template <typename Pack>
+struct make_flat_variant;
+
+template <typename... T>
+struct make_flat_variant< type_pack<T...> >
+{
+    typedef boost::variant<T...> type;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) metafunction has_flat_leaf
+//
+// Whether T is Leaf, or is a variant with the leaf Leaf.
+//
+template <typename Leaf>
+struct has_flat_leaf
+{
+    template <typename T>
+    struct apply
+        : mpl::bool_<
+              type_pack_find_if<
+                  typename flat_leaves<type_pack<>, T>::type, same_as<Leaf>
+              >::value != -1
+          >
+    {
+    };
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template flat_visitor
+//
+// Visits the leaves of a variant with Visitor, visiting the nested variants
+// in turn.
+//
+template <typename Visitor>
+class flat_visitor
+    : public static_visitor<typename Visitor::result_type>
+{
+private: // representation
+
+    Visitor& visitor_;
+
+public: // structors
+
+    explicit flat_visitor(Visitor& visitor) BOOST_NOEXCEPT
+        : visitor_(visitor)
+    {
+    }
+
+public: // visitor interfaces
+
+    typedef typename Visitor::result_type result_type;
+
+    template <BOOST_VARIANT_ENUM_PARAMS(typename U)>
+    result_type operator()(boost::variant<BOOST_VARIANT_ENUM_PARAMS(U)>& operand) const
+    {
+        return operand.apply_visitor(*this);
+    }
+
+    template <BOOST_VARIANT_ENUM_PARAMS(typename U)>
+    result_type operator()(const boost::variant<BOOST_VARIANT_ENUM_PARAMS(U)>& operand) const
+    {
+        return operand.apply_visitor(*this);
+    }
+
+    template <typename T>
+    result_type operator()(T& operand) const
+    {
+        return visitor_(operand);
+    }
+
+private:
+    flat_visitor& operator=(const flat_visitor&);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class templates flat_copier and flat_mover
+//
+// Construct the flat variant Flat from a leaf.
+//
+template <typename Flat>
+struct flat_copier
+    : static_visitor<Flat>
+{
+    template <typename T>
+    Flat operator()(const T& operand) const
+    {
+        return Flat(operand);
+    }
+};
+
+template <typename Flat>
+struct flat_mover
+    : static_visitor<Flat>
+{
+    template <typename T>
+    Flat operator()(T& operand) const
+    {
+        return Flat(::boost::detail::variant::move(operand));
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template nested_constructor
+//
+// Constructs the nested variant Variant from one of its leaves, through the
+// first of its bounded types that is or holds the leaf.
+//
+template <typename Variant>
+struct nested_constructor
+{
+    template <typename Leaf>
+    struct alternative
+        : mpl::deref<
+              typename mpl::find_if<
+                  typename Variant::types, has_flat_leaf<Leaf>
+              >::type
+          >
+    {
+    };
+
+    template <typename Leaf>
+    static Variant construct(Leaf&& operand, mpl::true_) // leaf of Variant
+    {
+        return Variant(std::forward<Leaf>(operand));
+    }
+
+    template <typename Leaf>
+    static Variant construct(Leaf&& operand, mpl::false_) // leaf of a nested variant
+    {
+        typedef typename alternative<
+            typename remove_const<typename remove_reference<Leaf>::type>::type
+        >::type nested_t;
+
+        return Variant(
+            nested_constructor<nested_t>::apply(std::forward<Leaf>(operand))
+        );
+    }
+
+    template <typename Leaf>
+    static Variant apply(Leaf&& operand)
+    {
+        typedef typename remove_const<typename remove_reference<Leaf>::type>::type leaf_t;
+        typedef typename is_same<
+              typename alternative<leaf_t>::type, leaf_t
+            >::type is_direct;
+
+        return construct(std::forward<Leaf>(operand), is_direct());
+    }
+};
+
+template <typename Variant>
+struct nested_copier
+    : static_visitor<Variant>
+{
+    template <typename T>
+    Variant operator()(const T& operand) const
+    {
+        return nested_constructor<Variant>::apply(operand);
+    }
+};
+
+template <typename Variant>
+struct nested_mover
+    : static_visitor<Variant>
+{
+    template <typename T>
+    Variant operator()(T& operand) const
+    {
+        return nested_constructor<Variant>::apply(::boost::detail::variant::move(operand));
+    }
+};
+
+}} // namespace detail::variant
+
+///////////////////////////////////////////////////////////////////////////////
+// metafunction flatten_variant
+//
+// The variant of the leaves of Variant: its bounded types, with the nested
+// variants replaced by their own leaves, recursively, and the repeated
+// leaves removed, e.g.
+//
+//   flatten_variant< variant<A, variant<B, C>, variant<A, D>> >::type
+//
+// is variant<A, B, C, D>. The flat variant has a single discriminator and
+// a single storage, and is visited with a single dispatch. The nested
+// variants must not be recursive.
+//
+template <typename Variant>
+struct flatten_variant
+    : detail::variant::make_flat_variant<
+          typename detail::variant::flat_leaves<
+              detail::variant::type_pack<>, Variant
+          >::type
+      >
+{
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// function template flat_visit
+//
+// Visits the leaf held by operand, i.e. its content or, if the content is a
+// variant, the leaf held by the content. Visitor needs only to handle the
+// leaves. For a flat operand this is apply_visitor.
+//
+template <typename Visitor, typename Variant>
+inline typename Visitor::result_type
+flat_visit(Visitor& visitor, Variant& operand)
+{
+    detail::variant::flat_visitor<Visitor> flat(visitor);
+    return operand.apply_visitor(flat);
+}
+
+template <typename Visitor, typename Variant>
+inline typename Visitor::result_type
+flat_visit(const Visitor& visitor, Variant& operand)
+{
+    detail::variant::flat_visitor<const Visitor> flat(visitor);
+    return operand.apply_visitor(flat);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// function templates to_flat_variant and from_flat_variant
+//
+// Convert between a nested variant and its flat variant. The leaf is
+// copied, or moved from an rvalue operand; no other copy is made. A leaf
+// that appears at several places of Variant is converted back into the
+// first of them.
+//
+template <typename Variant>
+inline typename flatten_variant<Variant>::type
+to_flat_variant(const Variant& operand)
+{
+    typedef typename flatten_variant<Variant>::type flat_t;
+    return flat_visit(detail::variant::flat_copier<flat_t>(), operand);
+}
+
+template <typename Variant>
+inline typename lazy_disable_if<
+      is_lvalue_reference<Variant>
+    , flatten_variant<Variant>
+    >::type
+to_flat_variant(Variant&& operand)
+{
+    typedef typename flatten_variant<Variant>::type flat_t;
+    return flat_visit(detail::variant::flat_mover<flat_t>(), operand);
+}
+
+template <typename Variant, typename Flat>
+inline Variant from_flat_variant(const Flat& operand)
+{
+    detail::variant::nested_copier<Variant> copier;
+    return operand.apply_visitor(copier);
+}
+
+template <typename Variant, typename Flat>
+inline typename disable_if<is_lvalue_reference<Flat>, Variant>::type
+from_flat_variant(Flat&& operand)
+{
+    detail::variant::nested_mover<Variant> mover;
+    return operand.apply_visitor(mover);
+}
+
+} // namespace boost
+
+#endif // BOOST_VARIANT_FLATTEN_VARIANT_HPP
@@ -0,0 +1,401 @@
+//-----------------------------------------------------------------------------
+// boost variant/instrumentation.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_INSTRUMENTATION_HPP
+#define BOOST_VARIANT_INSTRUMENTATION_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <atomic>
+#include <cstddef> // for std::size_t
+#include <cstdlib> // for std::atexit
+#include <iostream>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/type_index.hpp>
+#include <boost/mpl/size.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Instrumentation of boost::variant
+//
+// When BOOST_VARIANT_INSTRUMENTATION is #defined (consistently in all the
+// translation units), boost::variant reports its constructions, the paths
+// taken by its assignments and its visitations to the user supplied hooks
+// or, if there are none, to built-in thread local counters. Otherwise
+// variant is not instrumented at all.
+//
+// When BOOST_VARIANT_INSTRUMENTATION_REPORT_AT_EXIT is #defined, the report
+// of the counters is printed to std::cerr at exit.
+//
+
+namespace boost {
+
+enum variant_event
+{
+    variant_copy_construct,
+    variant_move_construct,
+    variant_same_type_assign,   // assign_storage or move_storage of the content
+    variant_cross_type_assign,  // destroy and construct a content of other type
+    variant_fallback_assign,    // cross type assignment that may leave the fallback type
+    variant_heap_backup,        // cross type assignment that backs up the content on heap
+    variant_event_count
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// struct variant_instrumentation_hooks
+//
+// User supplied hooks, installed with set_variant_instrumentation_hooks.
+// Called on the thread of the instrumented operation.
+//
+struct variant_instrumentation_hooks
+{
+    void (*on_event)(const boost::typeindex::type_info& variant_type, variant_event event, int which);
+    void (*on_visit)(const boost::typeindex::type_info& variant_type, int which);
+    void (*on_transition)(const boost::typeindex::type_info& variant_type, int from, int to);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// struct variant_instrumentation_stats
+//
+// Counters of a variant type summed over all the threads.
+//
+struct variant_instrumentation_stats
+{
+    std::string type_name;
+    std::size_t alternatives;
+    boost::uint64_t events[variant_event_count];
+    std::vector<boost::uint64_t> visits;        // per which()
+    std::vector<boost::uint64_t> transitions;   // alternatives x alternatives, from row to column
+
+    boost::uint64_t transition(int from, int to) const
+    {
+        return transitions[static_cast<std::size_t>(from) * alternatives + static_cast<std::size_t>(to)];
+    }
+};
+
+namespace detail { namespace variant {
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class instrumentation_block
+//
+// Counters of one variant type updated by one thread: the events, then the
+// visits per which() and then the transition matrix.
+//
+struct instrumentation_block
+{
+    boost::typeindex::type_index type;
+    std::size_t alternatives;
+    std::atomic<boost::uint64_t>* counters;
+    instrumentation_block* next;
+
+    instrumentation_block(boost::typeindex::type_index t, std::size_t n)
+        : type(t)
+        , alternatives(n)
+        , counters(new std::atomic<boost::uint64_t>[variant_event_count + n + n * n]())
+        , next(nullptr)
+    {
+    }
+
+    static void increment(std::atomic<boost::uint64_t>& counter) BOOST_NOEXCEPT
+    {
+        counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void count_event(variant_event event) BOOST_NOEXCEPT
+    {
+        increment(counters[event]);
+    }
+
+    void count_visit(int which) BOOST_NOEXCEPT
+    {
+        increment(counters[variant_event_count + which]);
+    }
+
+    void count_transition(int from, int to) BOOST_NOEXCEPT
+    {
+        increment(counters[variant_event_count + alternatives
+            + static_cast<std::size_t>(from) * alternatives + static_cast<std::size_t>(to)]);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class instrumentation_registry
+//
+// All the instrumentation blocks of the program. The blocks are never freed,
+// so the counters of the exited threads are still reported.
+//
+class instrumentation_registry
+{
+private: // representation
+
+    std::mutex mutex_;
+    instrumentation_block* head_;
+
+    instrumentation_registry()
+        : head_(nullptr)
+    {
+#if defined(BOOST_VARIANT_INSTRUMENTATION_REPORT_AT_EXIT)
+        std::atexit(&instrumentation_registry::report_at_exit);
+#endif
+    }
+
+    instrumentation_registry(const instrumentation_registry&);
+    instrumentation_registry& operator=(const instrumentation_registry&);
+
+    static void report_at_exit();
+
+public: // queries and modifiers
+
+    // Never destroyed, so that it is still usable by the handlers called at
+    // exit.
+    static instrumentation_registry& instance()
+    {
+        static instrumentation_registry* const registry = new instrumentation_registry();
+        return *registry;
+    }
+
+    static std::atomic<const variant_instrumentation_hooks*>& hooks() BOOST_NOEXCEPT
+    {
+        static std::atomic<const variant_instrumentation_hooks*> current(nullptr);
+        return current;
+    }
+
+    instrumentation_block* create(boost::typeindex::type_index type, std::size_t alternatives)
+    {
+        instrumentation_block* const block = new instrumentation_block(type, alternatives);
+        std::lock_guard<std::mutex> lock(mutex_);
+        block->next = head_;
+        head_ = block;
+        return block;
+    }
+
+    // Sums the counters per variant type in the order of first use.
+    std::vector<variant_instrumentation_stats> collect()
+    {
+        std::vector<boost::typeindex::type_index> types;
+        std::vector<variant_instrumentation_stats> result;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<const instrumentation_block*> blocks;
+        for (const instrumentation_block* block = head_; block; block = block->next)
+            blocks.push_back(block);
+
+        for (std::size_t i = blocks.size(); i-- > 0;) {
+            const instrumentation_block& block = *blocks[i];
+            std::size_t index = 0;
+            while (index != types.size() && types[index] != block.type)
+                ++index;
+
+            if (index == types.size()) {
+                types.push_back(block.type);
+                variant_instrumentation_stats stats;
+                stats.type_name = block.type.pretty_name();
+                stats.alternatives = block.alternatives;
+                for (int e = 0; e != variant_event_count; ++e)
+                    stats.events[e] = 0;
+                stats.visits.resize(block.alternatives);
+                stats.transitions.resize(block.alternatives * block.alternatives);
+                result.push_back(stats);
+            }
+
+            variant_instrumentation_stats& stats = result[index];
+            const std::atomic<boost::uint64_t>* counter = block.counters;
+            for (int e = 0; e != variant_event_count; ++e)
+                stats.events[e] += (counter++)->load(std::memory_order_relaxed);
+            for (std::size_t w = 0; w != stats.visits.size(); ++w)
+                stats.visits[w] += (counter++)->load(std::memory_order_relaxed);
+            for (std::size_t t = 0; t != stats.transitions.size(); ++t)
+                stats.transitions[t] += (counter++)->load(std::memory_order_relaxed);
+        }
+
+        return result;
+    }
+
+    void reset()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (instrumentation_block* block = head_; block; block = block->next) {
+            const std::size_t size = variant_event_count + block->alternatives
+                + block->alternatives * block->alternatives;
+            for (std::size_t i = 0; i != size; ++i)
+                block->counters[i].store(0, std::memory_order_relaxed);
+        }
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template instrument
+//
+// Entry points of the instrumentation used by variant.
+//
+template <typename Variant>
+struct instrument
+{
+    static const boost::typeindex::type_info& type() BOOST_NOEXCEPT
+    {
+        return boost::typeindex::type_id<Variant>().type_info();
+    }
+
+    static instrumentation_block& block()
+    {
+#if !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+        static thread_local instrumentation_block* const current
+#else
+        static instrumentation_block* const current
+#endif
+            = instrumentation_registry::instance().create(
+                  boost::typeindex::type_id<Variant>()
+                , mpl::size<typename Variant::types>::value
+                );
+
+        return *current;
+    }
+
+    static void event(variant_event e, int which)
+    {
+        const variant_instrumentation_hooks* const hooks
+            = instrumentation_registry::hooks().load(std::memory_order_acquire);
+        if (hooks) {
+            if (hooks->on_event)
+                hooks->on_event(instrument::type(), e, which);
+        } else {
+            block().count_event(e);
+        }
+    }
+
+    static void visit(int which)
+    {
+        const variant_instrumentation_hooks* const hooks
+            = instrumentation_registry::hooks().load(std::memory_order_acquire);
+        if (hooks) {
+            if (hooks->on_visit)
+                hooks->on_visit(instrument::type(), which);
+        } else {
+            block().count_visit(which);
+        }
+    }
+
+    static void assignment(variant_event e, int from, int to)
+    {
+        instrument::event(e, to);
+
+        const variant_instrumentation_hooks* const hooks
+            = instrumentation_registry::hooks().load(std::memory_order_acquire);
+        if (hooks) {
+            if (hooks->on_transition)
+                hooks->on_transition(instrument::type(), from, to);
+        } else {
+            block().count_transition(from, to);
+        }
+    }
+};
+
+}} // namespace detail::variant
+
+///////////////////////////////////////////////////////////////////////////////
+// function set_variant_instrumentation_hooks
+//
+// Installs the hooks; null restores the built-in counters. The hooks must
+// outlive their use.
+//
+inline void set_variant_instrumentation_hooks(const variant_instrumentation_hooks* hooks) BOOST_NOEXCEPT
+{
+    detail::variant::instrumentation_registry::hooks().store(hooks, std::memory_order_release);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// function template variant_instrumentation_snapshot
+//
+// Returns the built-in counters of Variant summed over all the threads.
+//
+template <typename Variant>
+variant_instrumentation_stats variant_instrumentation_snapshot()
+{
+    const std::vector<variant_instrumentation_stats> all
+        = detail::variant::instrumentation_registry::instance().collect();
+
+    const std::string name = boost::typeindex::type_id<Variant>().pretty_name();
+    for (std::size_t i = 0; i != all.size(); ++i) {
+        if (all[i].type_name == name)
+            return all[i];
+    }
+
+    variant_instrumentation_stats empty;
+    empty.type_name = name;
+    empty.alternatives = mpl::size<typename Variant::types>::value;
+    for (int e = 0; e != variant_event_count; ++e)
+        empty.events[e] = 0;
+    empty.visits.resize(empty.alternatives);
+    empty.transitions.resize(empty.alternatives * empty.alternatives);
+    return empty;
+}
+
+inline void reset_variant_instrumentation()
+{
+    detail::variant::instrumentation_registry::instance().reset();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// function report_variant_instrumentation
+//
+// Prints the built-in counters of all the instrumented variant types.
+//
+inline void report_variant_instrumentation(std::ostream& out)
+{
+    static const char* const event_names[variant_event_count] = {
+          "copy constructions"
+        , "move constructions"
+        , "same type assignments"
+        , "cross type assignments"
+        , "fallback type assignments"
+        , "heap backups"
+    };
+
+    const std::vector<variant_instrumentation_stats> all
+        = detail::variant::instrumentation_registry::instance().collect();
+
+    out << "boost::variant instrumentation: " << all.size() << " types\n";
+    for (std::size_t i = 0; i != all.size(); ++i) {
+        const variant_instrumentation_stats& stats = all[i];
+        out << '\n' << stats.type_name << '\n';
+        for (int e = 0; e != variant_event_count; ++e)
+            out << "  " << event_names[e] << ": " << stats.events[e] << '\n';
+
+        out << "  visits by which():";
+        for (std::size_t w = 0; w != stats.visits.size(); ++w)
+            out << ' ' << stats.visits[w];
+
+        out << "\n  which() transitions (row: from, column: to):\n";
+        for (std::size_t from = 0; from != stats.alternatives; ++from) {
+            out << "   ";
+            for (std::size_t to = 0; to != stats.alternatives; ++to)
+                out << ' ' << stats.transitions[from * stats.alternatives + to];
+            out << '\n';
+        }
+    }
+    out.flush();
+}
+
+inline void detail::variant::instrumentation_registry::report_at_exit()
+{
+    report_variant_instrumentation(std::cerr);
+}
+
+} // namespace boost
+
+#endif // BOOST_VARIANT_INSTRUMENTATION_HPP
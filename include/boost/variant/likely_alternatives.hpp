@@ -0,0 +1,112 @@
+//-----------------------------------------------------------------------------
+// boost variant/likely_alternatives.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_LIKELY_ALTERNATIVES_HPP
+#define BOOST_VARIANT_LIKELY_ALTERNATIVES_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <boost/static_assert.hpp>
+#include <boost/variant/detail/element_index.hpp>
+#include <boost/variant/detail/variant_access.hpp>
+
+namespace boost {
+
+///////////////////////////////////////////////////////////////////////////////
+// class template likely_alternatives
+//
+// Lists the bounded types of Variant that hold the value most of the time,
+// the most likely first.
+//
+template <typename Variant, typename... Likely>
+struct likely_alternatives
+{
+    typedef likely_alternatives type;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// metafunction variant_likely_alternatives
+//
+// Customization point for the visitation of Variant: the alternatives listed
+// by a specialization, e.g.
+//
+//   namespace boost {
+//   template <> struct variant_likely_alternatives<message>
+//       : likely_alternatives<message, data, ack> {};
+//   }
+//
+// are tested with branch hints, in order, before the dispatch on which() by
+// variant::apply_visitor. The specialization must be visible before the
+// first visitation of Variant, so it is usually placed next to its typedef
+// or in a header generated by boost/variant/visitation_profile.hpp.
+//
+template <typename Variant>
+struct variant_likely_alternatives
+    : likely_alternatives<Variant>
+{
+};
+
+namespace detail { namespace variant {
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template likely_visitation
+//
+// Tests the likely alternatives one by one and falls back to the generic
+// visitation.
+//
+template <typename Likely>
+struct likely_visitation;
+
+template <typename Variant>
+struct likely_visitation< likely_alternatives<Variant> >
+{
+    template <typename VariantCV, typename Visitor>
+    static BOOST_FORCEINLINE typename Visitor::result_type
+    apply(VariantCV& operand, Visitor& visitor)
+    {
+        return variant_access::internal_apply_visitor(operand, visitor);
+    }
+};
+
+template <typename Variant, typename First, typename... Rest>
+struct likely_visitation< likely_alternatives<Variant, First, Rest...> >
+{
+    BOOST_STATIC_ASSERT_MSG(
+        (holds_element<Variant, First>::value),
+        "boost::likely_alternatives: the likely alternatives must be bounded types of the variant"
+    );
+
+    typedef element_position<Variant, First> index_t;
+
+    template <typename VariantCV, typename Visitor>
+    static BOOST_FORCEINLINE typename Visitor::result_type
+    apply(VariantCV& operand, Visitor& visitor)
+    {
+        // A negative which_ indicates the backup content, which is left to
+        // the generic visitation.
+        if (BOOST_LIKELY(variant_access::internal_which(operand) == index_t::value)) {
+            return visitor.internal_visit(
+                ::boost::detail::variant::unchecked_get<index_t::value>(operand), 1L
+            );
+        }
+
+        return likely_visitation< likely_alternatives<Variant, Rest...> >::apply(operand, visitor);
+    }
+};
+
+}} // namespace detail::variant
+
+} // namespace boost
+
+#endif // BOOST_VARIANT_LIKELY_ALTERNATIVES_HPP
@@ -12,6 +12,9 @@
 #ifndef BOOST_VARIANT_POLYMORPHIC_GET_HPP
 #define BOOST_VARIANT_POLYMORPHIC_GET_HPP
 
+#include <atomic>
+#include <cstddef> // for std::size_t, std::ptrdiff_t
+#include <cstdint> // for PTRDIFF_MIN
 #include <exception>
 
 #include <boost/config.hpp>
@@ -21,11 +24,19 @@
 #include <boost/throw_exception.hpp>
 #include <boost/variant/variant_fwd.hpp>
 #include <boost/variant/get.hpp>
+#include <boost/variant/detail/index_sequence.hpp>
+#include <boost/variant/detail/variant_access.hpp>
 
 #include <boost/type_traits/add_reference.hpp>
 #include <boost/type_traits/add_pointer.hpp>
+#include <boost/type_traits/declval.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 #include <boost/type_traits/is_base_of.hpp>
 #include <boost/type_traits/is_const.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+#include <boost/mpl/if.hpp>
 
 namespace boost {
 
@@ -83,52 +94,155 @@ struct holds_element_polymorphic :
     >
 {};
 
-// (detail) class template get_polymorphic_visitor
+// (detail) class template polymorphic_get_table
 //
-// Generic static visitor that: if the value is of the specified
-// type or of a type derived from specified, returns a pointer
-// to the value it visits; else a null pointer.
+// Per bounded type of Variant, how to get a pointer to the content as
+// Base: not at all, if the bounded type is neither Base nor derived from
+// Base; else by the offset of the Base subobject from the storage, once
+// known; else by a function that unwraps the content (recursive_wrapper,
+// boxed, reference or heap backup) and converts the pointer.
 //
-template <typename Base>
-struct get_polymorphic_visitor
+// A content stored in place and never backed up is a complete object at
+// the storage, so its Base subobject is always at the same offset, even
+// for a virtual base. The function records that offset on the first get,
+// and the next gets are one table lookup and an addition, without
+// visitation. The table is constant initialized.
+//
+template <typename Base, typename Content>
+struct polymorphic_get_converts
 {
-private: // private typedefs
-    typedef get_polymorphic_visitor<Base>       this_type;
-    typedef typename add_pointer<Base>::type    pointer;
-    typedef typename add_reference<Base>::type  reference;
+    typedef typename boost::remove_reference<Base>::type base_t;
+
+    typedef boost::integral_constant<
+        bool,
+        (
+            boost::is_base_of<base_t, Content>::value &&
+            (boost::is_const<base_t>::value || !boost::is_const<Content>::value)
+        )
+        || boost::is_same<base_t, Content>::value
+        || boost::is_same<typename boost::remove_cv<base_t>::type, Content>::value
+    > type;
+};
 
-    pointer get(reference operand, boost::true_type) const BOOST_NOEXCEPT
-    {
-        return boost::addressof(operand);
-    }
+template <typename Base, typename Variant, typename Indexes>
+struct polymorphic_get_table;
 
-    template <class T>
-    pointer get(T&, boost::false_type) const BOOST_NOEXCEPT
+template <typename Base, typename Variant, std::size_t... I>
+struct polymorphic_get_table<Base, Variant, index_sequence<I...> >
+{
+    typedef typename add_pointer<Base>::type pointer;
+    typedef pointer (*getter_t)(Variant&);
+    typedef typename boost::mpl::if_<
+        boost::is_const<Variant>, const char, char
+    >::type byte_t;
+
+    static const std::ptrdiff_t no_base = PTRDIFF_MIN;
+    static const std::ptrdiff_t unknown_offset = PTRDIFF_MIN + 1;
+
+    static byte_t* storage(Variant& operand) BOOST_NOEXCEPT
     {
-        return static_cast<pointer>(0);
+        return static_cast<byte_t*>(variant_access::storage(operand));
     }
 
-public: // visitor interfaces
-    typedef pointer result_type;
-
-    template <typename U>
-    pointer operator()(U& operand) const BOOST_NOEXCEPT
+    template <int J>
+    struct converter
     {
-        typedef typename boost::remove_reference<Base>::type base_t;
+        typedef variant_alternative<Variant, J> alternative_t;
+
         typedef boost::integral_constant<
             bool,
-            (
-                boost::is_base_of<base_t, U>::value &&
-                (boost::is_const<base_t>::value || !boost::is_const<U>::value)
-            )
-            || boost::is_same<base_t, U>::value
-            || boost::is_same<typename boost::remove_cv<base_t>::type, U >::value
-        > tag_t;
-
-        return this_type::get(operand, tag_t());
+            boost::is_same<
+                typename alternative_t::type, typename alternative_t::internal_type
+            >::value
+            && alternative_t::never_uses_backup::value
+        > in_place;
+
+        static pointer get(Variant& operand) BOOST_NOEXCEPT
+        {
+            const pointer result = boost::addressof(unchecked_get<J>(operand));
+            record(operand, result, in_place());
+            return result;
+        }
+
+        static void record(Variant& operand, pointer result, boost::true_type) BOOST_NOEXCEPT
+        {
+            const volatile char* const base = static_cast<const volatile char*>(
+                static_cast<const volatile void*>(result)
+            );
+            offsets[J].store(base - storage(operand), std::memory_order_relaxed);
+        }
+
+        static void record(Variant&, pointer, boost::false_type) BOOST_NOEXCEPT
+        {
+        }
+
+        static const std::ptrdiff_t initial_offset = unknown_offset;
+    };
+
+    struct no_converter
+    {
+        static pointer get(Variant&) BOOST_NOEXCEPT
+        {
+            return static_cast<pointer>(0);
+        }
+
+        static const std::ptrdiff_t initial_offset = no_base;
+    };
+
+    template <int J>
+    struct entry
+        : boost::mpl::if_<
+              typename polymorphic_get_converts<
+                  Base,
+                  typename boost::remove_reference<
+                      decltype(unchecked_get<J>(boost::declval<Variant&>()))
+                  >::type
+              >::type,
+              converter<J>,
+              no_converter
+          >::type
+    {};
+
+    static std::atomic<std::ptrdiff_t> offsets[sizeof...(I)];
+    static const getter_t getters[sizeof...(I)];
+
+    static pointer get(Variant& operand) BOOST_NOEXCEPT
+    {
+        const int which = operand.which();
+        const std::ptrdiff_t offset = offsets[which].load(std::memory_order_relaxed);
+
+        // The entries of the contents that may not be got as Base (e.g., of
+        // a const variant as non-const Base) are no_base:
+        if (offset > unknown_offset)
+            return static_cast<pointer>(const_cast<void*>(
+                static_cast<const void*>(storage(operand) + offset)
+            ));
+        if (offset == no_base)
+            return static_cast<pointer>(0);
+        return getters[which](operand);
     }
 };
 
+template <typename Base, typename Variant, std::size_t... I>
+std::atomic<std::ptrdiff_t>
+    polymorphic_get_table<Base, Variant, index_sequence<I...> >::offsets[sizeof...(I)]
+        = { { polymorphic_get_table::template entry<static_cast<int>(I)>::initial_offset }... };
+
+template <typename Base, typename Variant, std::size_t... I>
+const typename polymorphic_get_table<Base, Variant, index_sequence<I...> >::getter_t
+    polymorphic_get_table<Base, Variant, index_sequence<I...> >::getters[sizeof...(I)]
+        = { &polymorphic_get_table::template entry<static_cast<int>(I)>::get... };
+
+template <typename Base, typename Variant>
+inline typename add_pointer<Base>::type polymorphic_get_pointer(Variant& operand) BOOST_NOEXCEPT
+{
+    return polymorphic_get_table<
+          Base
+        , Variant
+        , typename make_index_sequence<variant_size<Variant>::value>::type
+        >::get(operand);
+}
+
 }} // namespace detail::variant
 
 #ifndef BOOST_VARIANT_AUX_GET_EXPLICIT_TEMPLATE_TYPE
@@ -160,8 +274,7 @@ polymorphic_relaxed_get(
     typedef typename add_pointer<U>::type U_ptr;
     if (!operand) return static_cast<U_ptr>(0);
 
-    detail::variant::get_polymorphic_visitor<U> v;
-    return operand->apply_visitor(v);
+    return detail::variant::polymorphic_get_pointer<U>(*operand);
 }
 
 template <typename U, BOOST_VARIANT_ENUM_PARAMS(typename T) >
@@ -175,8 +288,7 @@ polymorphic_relaxed_get(
     typedef typename add_pointer<const U>::type U_ptr;
     if (!operand) return static_cast<U_ptr>(0);
 
-    detail::variant::get_polymorphic_visitor<const U> v;
-    return operand->apply_visitor(v);
+    return detail::variant::polymorphic_get_pointer<const U>(*operand);
 }
 
 template <typename U, BOOST_VARIANT_ENUM_PARAMS(typename T) >
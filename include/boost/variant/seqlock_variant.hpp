@@ -0,0 +1,231 @@
+//-----------------------------------------------------------------------------
+// boost variant/seqlock_variant.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_SEQLOCK_VARIANT_HPP
+#define BOOST_VARIANT_SEQLOCK_VARIANT_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <atomic>
+#include <cstddef> // for std::size_t
+#include <cstring> // for std::memcpy
+
+#include <boost/static_assert.hpp>
+#include <boost/variant/variant.hpp>
+#include <boost/variant/atomic_variant.hpp> // for atomic_* representation helpers
+#include <boost/variant/detail/index_sequence.hpp>
+
+namespace boost {
+
+namespace detail { namespace variant {
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template seqlock_buffer
+//
+// Local copy of the seqlock_variant representation: the object
+// representation of the value followed by the which() in the last word.
+//
+template <std::size_t Words, std::size_t Align>
+struct seqlock_buffer
+{
+    BOOST_STATIC_CONSTANT(std::size_t, words = Words);
+
+    alignas(Align) unsigned char bytes[Words * sizeof(std::size_t)];
+
+    std::size_t word(std::size_t i) const BOOST_NOEXCEPT
+    {
+        std::size_t result;
+        std::memcpy(&result, bytes + i * sizeof(std::size_t), sizeof(result));
+        return result;
+    }
+
+    void set_word(std::size_t i, std::size_t value) BOOST_NOEXCEPT
+    {
+        std::memcpy(bytes + i * sizeof(std::size_t), &value, sizeof(value));
+    }
+
+    int which() const BOOST_NOEXCEPT
+    {
+        return static_cast<int>(word(Words - 1));
+    }
+};
+
+}} // namespace detail::variant
+
+///////////////////////////////////////////////////////////////////////////////
+// class template seqlock_variant
+//
+// Shared value of one of the trivially copyable bounded types for read-mostly
+// data. Readers copy the representation optimistically and retry if a
+// writer modified it meanwhile, so readers never block writers and do not
+// write to shared memory. Writers are serialized with each other.
+//
+// The representation is accessed as relaxed word-sized atomics ordered by
+// fences, so the concurrent reads are not data races.
+//
+template <typename... T>
+class seqlock_variant
+{
+public: // typedefs
+
+    typedef boost::variant<T...> value_type;
+    typedef typename value_type::types types;
+
+private: // representation
+
+    BOOST_STATIC_ASSERT_MSG(
+        detail::variant::atomic_all_trivial<T...>::value,
+        "boost::seqlock_variant requires all the bounded types to be trivially copyable non-reference types"
+    );
+
+    typedef detail::variant::seqlock_buffer<
+          (detail::variant::atomic_max_size<T...>::value + sizeof(std::size_t) - 1) / sizeof(std::size_t) + 1
+        , detail::variant::atomic_max_alignment<T...>::value
+        > buffer_t;
+
+    typedef detail::variant::atomic_unpack_table<
+          buffer_t
+        , value_type
+        , typename detail::variant::make_index_sequence<sizeof...(T)>::type
+        > unpack_table_t;
+
+    std::atomic<std::size_t> sequence_;
+    std::atomic<std::size_t> words_[buffer_t::words];
+
+    static buffer_t pack(const value_type& operand) BOOST_NOEXCEPT
+    {
+        buffer_t buffer = {};
+        detail::variant::atomic_packer<buffer_t> visitor(buffer);
+        operand.apply_visitor(visitor);
+        buffer.set_word(buffer_t::words - 1, static_cast<std::size_t>(operand.which()));
+        return buffer;
+    }
+
+    void publish(const buffer_t& buffer) BOOST_NOEXCEPT
+    {
+        // Odd sequence number marks the update in progress.
+        std::size_t sequence = sequence_.load(std::memory_order_relaxed);
+        for (;;) {
+            if ((sequence & 1u) == 0 && sequence_.compare_exchange_weak(
+                    sequence, sequence + 1, std::memory_order_relaxed, std::memory_order_relaxed))
+            {
+                break;
+            }
+
+            sequence = sequence_.load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (std::size_t i = 0; i != buffer_t::words; ++i)
+            words_[i].store(buffer.word(i), std::memory_order_relaxed);
+
+        sequence_.store(sequence + 2, std::memory_order_release);
+    }
+
+    buffer_t snapshot() const BOOST_NOEXCEPT
+    {
+        buffer_t buffer;
+        for (;;) {
+            const std::size_t before = sequence_.load(std::memory_order_acquire);
+            if (before & 1u)
+                continue;
+
+            for (std::size_t i = 0; i != buffer_t::words; ++i)
+                buffer.set_word(i, words_[i].load(std::memory_order_relaxed));
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence_.load(std::memory_order_relaxed) == before)
+                return buffer;
+        }
+    }
+
+public: // structors
+
+    seqlock_variant() BOOST_NOEXCEPT
+        : sequence_(0)
+    {
+        seqlock_variant::init(seqlock_variant::pack(value_type()));
+    }
+
+    seqlock_variant(const value_type& operand) BOOST_NOEXCEPT
+        : sequence_(0)
+    {
+        seqlock_variant::init(seqlock_variant::pack(operand));
+    }
+
+private:
+    seqlock_variant(const seqlock_variant&);
+    seqlock_variant& operator=(const seqlock_variant&);
+
+    void init(const buffer_t& buffer) BOOST_NOEXCEPT
+    {
+        for (std::size_t i = 0; i != buffer_t::words; ++i)
+            words_[i].store(buffer.word(i), std::memory_order_relaxed);
+    }
+
+public: // queries
+
+    // Returns a consistent copy of the value.
+    value_type load() const BOOST_NOEXCEPT
+    {
+        const buffer_t buffer = snapshot();
+        return unpack_table_t::table[buffer.which()](buffer);
+    }
+
+    int which() const BOOST_NOEXCEPT
+    {
+        return snapshot().which();
+    }
+
+    operator value_type() const BOOST_NOEXCEPT
+    {
+        return load();
+    }
+
+public: // modifiers
+
+    void store(const value_type& operand) BOOST_NOEXCEPT
+    {
+        publish(seqlock_variant::pack(operand));
+    }
+
+    seqlock_variant& operator=(const value_type& operand) BOOST_NOEXCEPT
+    {
+        store(operand);
+        return *this;
+    }
+
+public: // visitation support
+
+    // Visits a consistent copy of the value.
+    template <typename Visitor>
+    typename Visitor::result_type
+    apply_visitor(Visitor& visitor) const
+    {
+        const value_type copy = load();
+        return copy.apply_visitor(visitor);
+    }
+
+    template <typename Visitor>
+    typename Visitor::result_type
+    apply_visitor(const Visitor& visitor) const
+    {
+        const value_type copy = load();
+        return copy.apply_visitor(visitor);
+    }
+};
+
+} // namespace boost
+
+#endif // BOOST_VARIANT_SEQLOCK_VARIANT_HPP
@@ -0,0 +1,296 @@
+//-----------------------------------------------------------------------------
+// boost variant/shared_variant.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_SHARED_VARIANT_HPP
+#define BOOST_VARIANT_SHARED_VARIANT_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <atomic>
+#include <cstddef> // for std::size_t
+#include <functional> // for std::hash
+#include <memory> // for std::unique_ptr
+#include <mutex>
+#include <thread> // for std::this_thread::yield
+
+#include <boost/variant/variant.hpp>
+#include <boost/variant/detail/move.hpp>
+
+namespace boost {
+
+namespace detail { namespace variant {
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class rcu_counter
+//
+// Count of the readers of one parity and stripe, on its own cache line to
+// avoid false sharing between the readers of different stripes, and with
+// the other members of shared_variant.
+//
+struct alignas(64) rcu_counter
+{
+    std::atomic<std::size_t> readers;
+};
+
+BOOST_STATIC_CONSTANT(std::size_t, rcu_stripes = 16);
+
+// Spreads the threads over the counter stripes.
+inline std::size_t rcu_stripe() BOOST_NOEXCEPT
+{
+#ifndef BOOST_NO_CXX11_THREAD_LOCAL
+    static std::atomic<std::size_t> next_stripe(0);
+    static thread_local const std::size_t stripe
+        = next_stripe.fetch_add(1, std::memory_order_relaxed) % rcu_stripes;
+
+    return stripe;
+#else
+    return std::hash<std::thread::id>()(std::this_thread::get_id()) % rcu_stripes;
+#endif
+}
+
+}} // namespace detail::variant
+
+///////////////////////////////////////////////////////////////////////////////
+// class template shared_variant
+//
+// Shared read-mostly variant for bounded types that are expensive to copy.
+// The value is an immutable heap allocated variant behind an atomically
+// swapped pointer: readers visit it in place under a read_guard, writers
+// publish a new version and destroy the previous one after a grace period,
+// i.e. after all the readers that could see it left their guards.
+//
+// Readers do not block each other and are never blocked by writers; a
+// writer waits for the readers of the previous version. A thread must not
+// modify a shared_variant while holding a read_guard of it.
+//
+template <typename... T>
+class shared_variant
+{
+public: // typedefs
+
+    typedef boost::variant<T...> value_type;
+    typedef typename value_type::types types;
+
+private: // representation
+
+    std::atomic<const value_type*> current_;
+    std::atomic<std::size_t> epoch_;
+    mutable detail::variant::rcu_counter counters_[2][detail::variant::rcu_stripes];
+    std::mutex writer_;
+
+public: // read_guard
+
+    // Keeps the value that was current at construction alive.
+    class read_guard
+    {
+    private: // representation
+
+        detail::variant::rcu_counter* counter_;
+        const value_type* value_;
+
+    public: // structors
+
+        explicit read_guard(const shared_variant& owner) BOOST_NOEXCEPT
+            : counter_(nullptr)
+            , value_(nullptr)
+        {
+            const std::size_t stripe = detail::variant::rcu_stripe();
+            for (;;) {
+                const std::size_t epoch = owner.epoch_.load(std::memory_order_seq_cst);
+                counter_ = &owner.counters_[epoch & 1u][stripe];
+                counter_->readers.fetch_add(1, std::memory_order_seq_cst);
+
+                // The writer may have started waiting for the readers of this
+                // parity before the increment: retry with the new parity.
+                if (owner.epoch_.load(std::memory_order_seq_cst) == epoch)
+                    break;
+
+                counter_->readers.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            value_ = owner.current_.load(std::memory_order_seq_cst);
+        }
+
+        ~read_guard()
+        {
+            counter_->readers.fetch_sub(1, std::memory_order_release);
+        }
+
+    private:
+        read_guard(const read_guard&);
+        read_guard& operator=(const read_guard&);
+
+    public: // queries
+
+        const value_type& get() const BOOST_NOEXCEPT
+        {
+            return *value_;
+        }
+
+        const value_type& operator*() const BOOST_NOEXCEPT
+        {
+            return *value_;
+        }
+
+        const value_type* operator->() const BOOST_NOEXCEPT
+        {
+            return value_;
+        }
+    };
+
+private: // helpers
+
+    void wait_for_readers(std::size_t parity) BOOST_NOEXCEPT
+    {
+        for (std::size_t i = 0; i != detail::variant::rcu_stripes; ++i) {
+            while (counters_[parity][i].readers.load(std::memory_order_seq_cst) != 0)
+                std::this_thread::yield();
+        }
+    }
+
+    // Precondition: writer_ is locked.
+    void publish(const value_type* value) BOOST_NOEXCEPT
+    {
+        const value_type* const previous = current_.exchange(value, std::memory_order_seq_cst);
+
+        // Grace period: after the epoch flip new readers see the new value,
+        // the readers that could see the previous one are all counted with
+        // the old parity.
+        const std::size_t epoch = epoch_.load(std::memory_order_relaxed);
+        epoch_.store(epoch + 1, std::memory_order_seq_cst);
+        wait_for_readers(epoch & 1u);
+
+        delete previous;
+    }
+
+public: // structors
+
+    shared_variant()
+        : current_(new value_type())
+        , epoch_(0)
+    {
+        init_counters();
+    }
+
+    shared_variant(const value_type& operand)
+        : current_(new value_type(operand))
+        , epoch_(0)
+    {
+        init_counters();
+    }
+
+    shared_variant(value_type&& operand)
+        : current_(new value_type(detail::variant::move(operand)))
+        , epoch_(0)
+    {
+        init_counters();
+    }
+
+    ~shared_variant()
+    {
+        delete current_.load(std::memory_order_relaxed);
+    }
+
+private:
+    shared_variant(const shared_variant&);
+    shared_variant& operator=(const shared_variant&);
+
+    void init_counters() BOOST_NOEXCEPT
+    {
+        for (std::size_t parity = 0; parity != 2; ++parity) {
+            for (std::size_t i = 0; i != detail::variant::rcu_stripes; ++i)
+                counters_[parity][i].readers.store(0, std::memory_order_relaxed);
+        }
+    }
+
+public: // queries
+
+    // Returns a copy of the current value.
+    value_type load() const
+    {
+        read_guard guard(*this);
+        return guard.get();
+    }
+
+    int which() const BOOST_NOEXCEPT
+    {
+        read_guard guard(*this);
+        return guard->which();
+    }
+
+public: // modifiers
+
+    // Publishes a new version and destroys the previous one after the grace
+    // period.
+    void store(const value_type& operand)
+    {
+        std::unique_ptr<const value_type> value(new value_type(operand));
+        std::lock_guard<std::mutex> lock(writer_);
+        publish(value.release());
+    }
+
+    void store(value_type&& operand)
+    {
+        std::unique_ptr<const value_type> value(new value_type(detail::variant::move(operand)));
+        std::lock_guard<std::mutex> lock(writer_);
+        publish(value.release());
+    }
+
+    shared_variant& operator=(const value_type& operand)
+    {
+        store(operand);
+        return *this;
+    }
+
+    shared_variant& operator=(value_type&& operand)
+    {
+        store(detail::variant::move(operand));
+        return *this;
+    }
+
+    // Read-copy-update: publishes a copy of the current value modified by
+    // the given function. Writers are serialized, so no concurrent
+    // modification is lost.
+    template <typename Function>
+    void update(Function f)
+    {
+        std::lock_guard<std::mutex> lock(writer_);
+        std::unique_ptr<value_type> value(new value_type(*current_.load(std::memory_order_relaxed)));
+        f(*value);
+        publish(value.release());
+    }
+
+public: // visitation support
+
+    // Visits the current value in place.
+    template <typename Visitor>
+    typename Visitor::result_type
+    apply_visitor(Visitor& visitor) const
+    {
+        read_guard guard(*this);
+        return guard->apply_visitor(visitor);
+    }
+
+    template <typename Visitor>
+    typename Visitor::result_type
+    apply_visitor(const Visitor& visitor) const
+    {
+        read_guard guard(*this);
+        return guard->apply_visitor(visitor);
+    }
+};
+
+} // namespace boost
+
+#endif // BOOST_VARIANT_SHARED_VARIANT_HPP
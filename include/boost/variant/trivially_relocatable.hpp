@@ -0,0 +1,188 @@
+//-----------------------------------------------------------------------------
+// boost variant/trivially_relocatable.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_TRIVIALLY_RELOCATABLE_HPP
+#define BOOST_VARIANT_TRIVIALLY_RELOCATABLE_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <cstring> // for std::memmove
+#include <memory> // for std::allocator
+#include <new>
+
+#include <boost/variant/variant_fwd.hpp>
+#include <boost/variant/boxed_fwd.hpp>
+#include <boost/variant/recursive_wrapper_fwd.hpp>
+#include <boost/variant/detail/content_mask.hpp>
+#include <boost/variant/detail/move.hpp>
+#include <boost/variant/detail/variant_access.hpp>
+
+#include <boost/core/no_exceptions_support.hpp>
+#include <boost/detail/reference_content.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_nothrow_move_constructible.hpp>
+#include <boost/type_traits/is_trivially_copyable.hpp>
+
+namespace boost {
+
+///////////////////////////////////////////////////////////////////////////////
+// metafunction is_trivially_relocatable
+//
+// Whether an object of type T may be moved to another address by copying
+// its bytes, its old storage then being reused or freed without running
+// the destructor. Holds for the trivially copyable types, recursive_wrapper,
+// boxed with such an allocator, and variant of such types.
+//
+// Specialize it as mpl::true_ for a type that does not point into itself
+// and is not registered anywhere by address, such as std::unique_ptr or
+// the containers of most standard libraries. Not std::string of libstdc++,
+// which points into its own small buffer.
+//
+template <typename T>
+struct is_trivially_relocatable
+    : mpl::bool_< is_trivially_copyable<T>::value >
+{
+};
+
+template <typename T>
+struct is_trivially_relocatable< recursive_wrapper<T> >
+    : mpl::true_
+{
+};
+
+template <typename T, typename Allocator>
+struct is_trivially_relocatable< boxed<T, Allocator> >
+    : is_trivially_relocatable<Allocator>
+{
+};
+
+template <typename T>
+struct is_trivially_relocatable< std::allocator<T> >
+    : mpl::true_
+{
+};
+
+namespace detail { namespace variant {
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) metafunction relocatable_content
+//
+// is_trivially_relocatable of an internal type of variant. A reference is
+// held as a pointer.
+//
+template <typename T>
+struct relocatable_content
+    : is_trivially_relocatable<T>
+{
+};
+
+template <typename T>
+struct relocatable_content< ::boost::detail::reference_content<T> >
+    : mpl::true_
+{
+};
+
+struct relocatable_content_pred
+{
+    template <typename T>
+    struct apply
+        : relocatable_content<T>
+    {
+    };
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template relocatable_flags
+//
+// Whether the internal type of each index is trivially relocatable. The
+// heap backup of any content is a pointer, thus always relocatable.
+//
+template <typename Types>
+struct relocatable_flags
+    : content_mask<Types, relocatable_content_pred, true>
+{
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) function template relocate_range_impl
+//
+// Implements relocate_range (below).
+//
+template <typename T>
+inline T* relocate_range_impl(T* first, T* last, T* result, mpl::true_) BOOST_NOEXCEPT
+{
+    if (first != last)
+        std::memmove(static_cast<void*>(result), static_cast<const void*>(first), (last - first) * sizeof(T));
+    return result + (last - first);
+}
+
+template <typename T>
+inline T* relocate_range_impl(T* first, T* last, T* result, mpl::false_)
+{
+    T* constructed = result;
+
+    BOOST_TRY
+    {
+        for (T* it = first; it != last; ++it, ++constructed)
+            new(static_cast<void*>(constructed)) T( ::boost::detail::variant::move(*it) );
+    }
+    BOOST_CATCH (...)
+    {
+        while (constructed != result)
+            (--constructed)->~T();
+
+        BOOST_RETHROW;
+    }
+    BOOST_CATCH_END
+
+    for (T* it = first; it != last; ++it)
+        it->~T();
+    return constructed;
+}
+
+}} // namespace detail::variant
+
+template < BOOST_VARIANT_ENUM_PARAMS(typename T) >
+struct is_trivially_relocatable< variant< BOOST_VARIANT_ENUM_PARAMS(T) > >
+    : detail::variant::relocatable_flags<
+          typename detail::variant::variant_access::internal_types<
+              variant< BOOST_VARIANT_ENUM_PARAMS(T) >
+            >::type
+        >::all
+{
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// function template relocate_range
+//
+// Moves the objects of [first, last) into the uninitialized storage at
+// result, and ends their lifetime in [first, last), as a container does on
+// growth or erasure. A bytewise copy if is_trivially_relocatable<T>, in
+// which case the ranges may overlap, else move constructions followed by
+// destructions (if one of the constructions throws, the objects
+// constructed are destroyed and those of [first, last) stay alive, maybe
+// moved from). Returns the end of the relocated range.
+//
+template <typename T>
+inline T* relocate_range(T* first, T* last, T* result)
+    BOOST_NOEXCEPT_IF(is_trivially_relocatable<T>::value || is_nothrow_move_constructible<T>::value)
+{
+    return detail::variant::relocate_range_impl(
+          first, last, result, mpl::bool_< is_trivially_relocatable<T>::value >()
+        );
+}
+
+} // namespace boost
+
+#endif // BOOST_VARIANT_TRIVIALLY_RELOCATABLE_HPP
@@ -16,7 +16,10 @@
 #define BOOST_VARIANT_VARIANT_HPP
 
 #include <cstddef> // for std::size_t
+#include <cstring> // for std::memcpy
+#include <memory> // for std::allocator_arg_t
 #include <new> // for placement new
+#include <utility> // for std::forward, std::declval
 
 #include <boost/type_index.hpp>
 
@@ -25,16 +28,21 @@
 
 #include <boost/variant/variant_fwd.hpp>
 #include <boost/variant/detail/backup_holder.hpp>
+#include <boost/variant/detail/content_mask.hpp>
 #include <boost/variant/detail/enable_recursive_fwd.hpp>
 #include <boost/variant/detail/forced_return.hpp>
 #include <boost/variant/detail/initializer.hpp>
 #include <boost/variant/detail/make_variant_list.hpp>
+#include <boost/variant/detail/type_pack.hpp>
 #include <boost/variant/detail/over_sequence.hpp>
 #include <boost/variant/detail/visitation_impl.hpp>
 #include <boost/variant/detail/hash_variant.hpp>
 #include <boost/variant/detail/std_hash.hpp>
+#include <boost/variant/detail/uses_allocator.hpp>
 
 #include <boost/variant/detail/move.hpp>
+#include <boost/variant/likely_alternatives.hpp>
+#include <boost/variant/trivially_relocatable.hpp>
 
 #include <boost/detail/reference_content.hpp>
 #include <boost/blank.hpp>
@@ -50,15 +58,19 @@
 #include <boost/type_traits/is_const.hpp>
 #include <boost/type_traits/is_same.hpp>
 #include <boost/type_traits/is_rvalue_reference.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/type_traits/remove_reference.hpp>
 #include <boost/type_traits/is_constructible.hpp>
 #include <boost/type_traits/add_lvalue_reference.hpp>
 #include <boost/type_traits/declval.hpp>
 #include <boost/core/no_exceptions_support.hpp>
 #include <boost/core/enable_if.hpp>
+#include <boost/variant/boxed_fwd.hpp>
 #include <boost/variant/recursive_wrapper_fwd.hpp>
 #include <boost/variant/static_visitor.hpp>
 
 #include <boost/mpl/assert.hpp>
+#include <boost/mpl/at.hpp>
 #include <boost/mpl/begin_end.hpp>
 #include <boost/mpl/bool.hpp>
 #include <boost/mpl/deref.hpp>
@@ -98,6 +110,48 @@
 //   size of variant obje   cts. However, often unsuccessful due to alignment
 //   issues, and potentially harmful to runtime speed, so not enabled by
 //   default. (TODO: Investigate further.)
+//
+// BOOST_VARIANT_INSTRUMENTATION
+//   When #defined, variant reports its constructions, assignment paths,
+//   visitations and which() transitions to the hooks or the counters of
+//   boost/variant/instrumentation.hpp. Must be #defined consistently in all
+//   the translation units. Not enabled by default.
+//
+// BOOST_VARIANT_MINIMIZE_CODE_SIZE
+//   When #defined, destruction, copy and move construction, same type
+//   assignment, swap, type() and comparison go through constant tables of
+//   per-type functions (see boost/variant/detail/lifecycle_table.hpp)
+//   instead of a switch over all the types per operation and per variant.
+//   The functions of a type are shared by all the variants holding it.
+//   Smaller binaries for an indirect call per operation, so not enabled by
+//   default.
+//
+// BOOST_VARIANT_NO_HEAP
+//   When #defined, variants never allocate: a bounded type held through
+//   recursive_wrapper or boxed with std::allocator, or an assignment that
+//   could need the heap backup, fails to compile with a static assertion
+//   on no_heap_violation<T, Operation>, naming the offending bounded type
+//   and operation. The assignments back up bounded types that have a
+//   nothrow copy constructor (but not a nothrow move constructor) on the
+//   stack instead. Not enabled by default.
+//
+// BOOST_VARIANT_BACKUP_POOL
+//   When #defined, the heap backups of the cross type assignments come from
+//   per thread free lists instead of operator new. Their allocator may be
+//   replaced with BOOST_VARIANT_BACKUP_ALLOCATOR, with or without the pool.
+//   See boost/variant/backup_pool.hpp. Not enabled by default.
+
+#if defined(BOOST_VARIANT_MINIMIZE_CODE_SIZE)
+#   include <boost/variant/detail/lifecycle_table.hpp>
+#endif
+
+#if defined(BOOST_VARIANT_INSTRUMENTATION)
+#   include <boost/variant/instrumentation.hpp>
+#   define BOOST_VARIANT_AUX_INSTRUMENT(Variant, hook, args) \
+        ::boost::detail::variant::instrument< Variant >::hook args
+#else
+#   define BOOST_VARIANT_AUX_INSTRUMENT(Variant, hook, args) ((void)0)
+#endif
 
 #if defined(BOOST_VARIANT_MINIMIZE_SIZE)
 #   include <climits> // for SCHAR_MAX
@@ -204,17 +258,81 @@ private: // helpers, for metafunction result (below)
 
     typedef typename second_result_::second second_result_it;
 
+    // [...the results hold iterators, the fallback type is what they point to:]
+    template <typename Result>
+    struct deref_result
+    {
+        typedef mpl::pair<
+              typename Result::first
+            , typename mpl::deref<typename Result::second>::type
+            > type;
+    };
+
 public: // metafunction result
 
     // [...and return the results of the search:]
     typedef typename mpl::eval_if<
           is_same< second_result_it,end_it >
-        , mpl::if_<
+        , mpl::eval_if<
               is_same< first_result_it,end_it >
-            , mpl::pair< no_fallback_type,no_fallback_type >
-            , first_result_
+            , mpl::identity< mpl::pair< no_fallback_type,no_fallback_type > >
+            , deref_result< first_result_ >
             >
-        , mpl::identity< second_result_ >
+        , deref_result< second_result_ >
+        >::type type;
+
+};
+
+template <int Index, typename Types>
+struct fallback_type_at
+{
+    typedef mpl::pair<
+          mpl::int_<Index>
+        , typename mpl::at_c<Types, Index>::type
+        > type;
+};
+
+template <typename Types>
+struct fallback_type_at<-1, Types>
+{
+    typedef mpl::pair< no_fallback_type,no_fallback_type > type;
+};
+
+template <typename... T>
+struct find_fallback_type< type_pack<T...> >
+{
+private: // helpers, for metafunction result (below)
+
+    struct is_blank
+    {
+        template <typename U>
+        struct apply
+            : is_same<U, boost::blank>
+        {
+        };
+    };
+
+    struct is_fallback
+    {
+        template <typename U>
+        struct apply
+            : has_nothrow_constructor<U>
+        {
+        };
+    };
+
+    static const int blank_index = type_pack_find_if<
+          type_pack<T...>, is_blank
+        >::value;
+    static const int first_index = type_pack_find_if<
+          type_pack<T...>, is_fallback
+        >::value;
+
+public: // metafunction result
+
+    typedef typename fallback_type_at<
+          (blank_index != -1 ? blank_index : first_index)
+        , type_pack<T...>
         >::type type;
 
 };
@@ -236,6 +354,22 @@ struct is_variant_move_noexcept_constructible {
     >::type type;
 };
 
+template <class... T>
+struct is_variant_move_noexcept_constructible< type_pack<T...> > {
+    struct throwing_move
+    {
+        template <class U>
+        struct apply
+            : mpl::not_< boost::is_nothrow_move_constructible<U> >
+        {
+        };
+    };
+
+    typedef mpl::bool_<
+        type_pack_find_if< type_pack<T...>, throwing_move >::value == -1
+    > type;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // (detail) metafunction is_variant_move_noexcept_assignable
 //
@@ -253,6 +387,22 @@ struct is_variant_move_noexcept_assignable {
     >::type type;
 };
 
+template <class... T>
+struct is_variant_move_noexcept_assignable< type_pack<T...> > {
+    struct throwing_move
+    {
+        template <class U>
+        struct apply
+            : mpl::not_< boost::is_nothrow_move_assignable<U> >
+        {
+        };
+    };
+
+    typedef mpl::bool_<
+        type_pack_find_if< type_pack<T...>, throwing_move >::value == -1
+    > type;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // (detail) metafunction is_variant_constructible_from
 //
@@ -273,7 +423,7 @@ struct is_constructible_ext:
 {};
 
 template <class T, class Types>
-struct is_variant_constructible_from:
+struct is_any_constructible_from:
     boost::mpl::not_< boost::is_same<
         typename boost::mpl::find_if<
             Types,
@@ -283,6 +433,28 @@ struct is_variant_constructible_from:
     > >
 {};
 
+template <class T>
+struct is_constructible_ext_from
+{
+    template <class U>
+    struct apply
+        : is_constructible_ext<U, T>
+    {
+    };
+};
+
+template <class T, class... U>
+struct is_any_constructible_from< T, type_pack<U...> >:
+    boost::mpl::bool_<
+        type_pack_find_if< type_pack<U...>, is_constructible_ext_from<T> >::value != -1
+    >
+{};
+
+template <class T, class Types>
+struct is_variant_constructible_from:
+    is_any_constructible_from<T, Types>
+{};
+
 template <BOOST_VARIANT_ENUM_PARAMS(typename T), class Types>
 struct is_variant_constructible_from< boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)>, Types >:
     boost::is_same<
@@ -362,6 +534,57 @@ public: // metafunction result
         > type;
 };
 
+template <typename... T, typename NeverUsesBackupFlag>
+struct make_storage< type_pack<T...>, NeverUsesBackupFlag >
+{
+private: // helpers, for metafunction result (below)
+
+    // [the backup_holder<void*> counts only if the backup may be used:]
+    static const std::size_t backup_size = NeverUsesBackupFlag::value
+        ? 1 : sizeof(backup_holder<void*>);
+    static const std::size_t backup_alignment = NeverUsesBackupFlag::value
+        ? 1 : ::boost::alignment_of< backup_holder<void*> >::value;
+
+public: // metafunction result
+
+    typedef ::boost::aligned_storage<
+          static_max<sizeof...(T) + 1>({ backup_size, sizeof(T)... })
+        , static_lcm<sizeof...(T) + 1>({
+              backup_alignment, ::boost::alignment_of<T>::value...
+          })
+        > type;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) metafunction transform_types
+//
+// Applies the metafunction class F to each of the Types. Expands the pack
+// of a type_pack, leaving mpl::transform to the sequences of
+// make_variant_over.
+//
+template <typename Types, typename F>
+struct transform_types
+    : mpl::transform< Types, mpl::protect<F> >
+{
+};
+
+template <typename... T, typename F>
+struct transform_types< type_pack<T...>, F >
+{
+    typedef type_pack<
+          typename F::template apply<T>::type...
+        > type;
+};
+
+struct quoted_unwrap_recursive
+{
+    template <typename T>
+    struct apply
+        : unwrap_recursive<T>
+    {
+    };
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // (detail) class destroyer
 //
@@ -487,6 +710,86 @@ public: // internal visitor interface
     }
 };
 
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class templates uses_allocator_copy_into and uses_allocator_move_into
+//
+// Internal visitors that copy or move the value they visit into the given
+// buffer, by uses-allocator construction with the given allocator.
+//
+template <typename Allocator>
+class uses_allocator_copy_into
+    : public static_visitor<>
+{
+private: // representation
+
+    void* storage_;
+    const Allocator& allocator_;
+
+public: // structors
+
+    uses_allocator_copy_into(void* storage, const Allocator& allocator) BOOST_NOEXCEPT
+        : storage_(storage)
+        , allocator_(allocator)
+    {
+    }
+
+public: // internal visitor interface
+
+    template <typename T>
+    void internal_visit(const boost::detail::variant::backup_holder<T>& operand, long) const
+    {
+        uses_allocator_construct<T>(storage_, allocator_, operand.get());
+    }
+
+    template <typename T>
+    void internal_visit(const T& operand, int) const
+    {
+        uses_allocator_construct<T>(storage_, allocator_, operand);
+    }
+
+private:
+    uses_allocator_copy_into& operator=(const uses_allocator_copy_into&);
+};
+
+template <typename Allocator>
+class uses_allocator_move_into
+    : public static_visitor<>
+{
+private: // representation
+
+    void* storage_;
+    const Allocator& allocator_;
+
+public: // structors
+
+    uses_allocator_move_into(void* storage, const Allocator& allocator) BOOST_NOEXCEPT
+        : storage_(storage)
+        , allocator_(allocator)
+    {
+    }
+
+public: // internal visitor interface
+
+    template <typename T>
+    void internal_visit(boost::detail::variant::backup_holder<T>& operand, long) const
+    {
+        uses_allocator_construct<T>(
+              storage_, allocator_, ::boost::detail::variant::move(operand.get())
+            );
+    }
+
+    template <typename T>
+    void internal_visit(T& operand, int) const
+    {
+        uses_allocator_construct<T>(
+              storage_, allocator_, ::boost::detail::variant::move(operand)
+            );
+    }
+
+private:
+    uses_allocator_move_into& operator=(const uses_allocator_move_into&);
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // (detail) class assign_storage
 //
@@ -676,6 +979,147 @@ private:
 };
 
 
+#if defined(BOOST_VARIANT_NO_HEAP)
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template no_heap_violation
+//
+// Fails to compile if Operation is not void: Operation on the bounded type
+// T could allocate, which BOOST_VARIANT_NO_HEAP forbids.
+//
+template <typename T, typename Operation>
+struct no_heap_violation
+{
+    BOOST_STATIC_ASSERT_MSG(
+          false && sizeof(T)
+        , "boost::variant: BOOST_VARIANT_NO_HEAP is defined, but the Operation on the bounded type T may allocate"
+        );
+
+    typedef void type;
+};
+
+template <typename T>
+struct no_heap_violation<T, void>
+{
+    typedef void type;
+};
+
+// Operations that allocate:
+struct recursive_wrapper_allocation;
+struct boxed_allocation;
+template <typename RhsT> struct heap_backup_on_assignment_from;
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) metafunction no_heap_check
+//
+// Instantiates no_heap_violation for the first of the Types for which the
+// metafunction class OperationOf gives an allocating operation.
+//
+template <typename First, typename Last, typename OperationOf>
+struct no_heap_check_impl
+{
+    typedef typename mpl::deref<First>::type t;
+    typedef typename OperationOf::template apply<t>::type operation;
+
+    typedef typename mpl::eval_if<
+          is_same<operation, void>
+        , no_heap_check_impl<typename mpl::next<First>::type, Last, OperationOf>
+        , no_heap_violation<t, operation>
+        >::type type;
+};
+
+template <typename Last, typename OperationOf>
+struct no_heap_check_impl<Last, Last, OperationOf>
+{
+    typedef void type;
+};
+
+template <typename Types, typename OperationOf>
+struct no_heap_check
+    : no_heap_check_impl<
+          typename mpl::begin<Types>::type
+        , typename mpl::end<Types>::type
+        , OperationOf
+        >
+{
+};
+
+// The internal types that allocate on construction:
+struct heap_wrapper_allocation
+{
+    template <typename T>
+    struct apply
+    {
+        typedef void type;
+    };
+
+    template <typename T>
+    struct apply< boost::recursive_wrapper<T> >
+    {
+        typedef recursive_wrapper_allocation type;
+    };
+
+    template <typename T>
+    struct apply< boost::boxed<T, std::allocator<T> > >
+    {
+        typedef boxed_allocation type;
+    };
+};
+
+// The internal types that backup_assigner backs up on the heap, when
+// assigning a RhsT:
+template <typename RhsT>
+struct heap_backup_allocation
+{
+    template <typename T>
+    struct apply
+        : mpl::if_<
+              mpl::or_<
+                  is_same<T, RhsT>
+                , is_nothrow_move_constructible<T>
+                , has_nothrow_copy<T>
+                >
+            , void
+            , heap_backup_on_assignment_from<RhsT>
+            >
+    {
+    };
+};
+
+// No content is ever in a heap backup, though the assignment from it is
+// instantiated:
+template <typename T>
+struct heap_backup_allocation< backup_holder<T> >
+{
+    template <typename U>
+    struct apply
+    {
+        typedef void type;
+    };
+};
+
+#endif // BOOST_VARIANT_NO_HEAP
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) function template nothrow_backup_source
+//
+// The source for a backup of T on the stack: an rvalue if T is nothrow
+// move constructible, else (nothrow copy constructible) an lvalue.
+//
+template <typename T>
+inline typename boost::enable_if_c<is_nothrow_move_constructible<T>::value, T&&>::type
+nothrow_backup_source(T& operand) BOOST_NOEXCEPT
+{
+    return ::boost::detail::variant::move(operand);
+}
+
+template <typename T>
+inline typename boost::disable_if_c<is_nothrow_move_constructible<T>::value, const T&>::type
+nothrow_backup_source(T& operand) BOOST_NOEXCEPT
+{
+    return operand;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // (detail) class backup_assigner
 //
@@ -755,13 +1199,13 @@ private: // helpers, for visitor interface (below)
     template <typename LhsT>
     void backup_assign_impl(
           LhsT& lhs_content
-        , mpl::true_ // is_nothrow_move_constructible
+        , mpl::true_ // is_nothrow_move_constructible (or has_nothrow_copy)
         , int
         )
     {
         // Move lhs content to backup...
         LhsT backup_lhs_content(
-              ::boost::detail::variant::move(lhs_content)
+              ::boost::detail::variant::nothrow_backup_source(lhs_content)
             ); // nothrow
 
         // ...destroy lhs content...
@@ -777,7 +1221,7 @@ private: // helpers, for visitor interface (below)
             // In case of failure, restore backup content to lhs storage...
             new(lhs_.storage_.address())
                 LhsT(
-                      ::boost::detail::variant::move(backup_lhs_content)
+                      ::boost::detail::variant::nothrow_backup_source(backup_lhs_content)
                     ); // nothrow
 
             // ...and rethrow:
@@ -796,8 +1240,10 @@ private: // helpers, for visitor interface (below)
         , int
         )
     {
+        BOOST_VARIANT_AUX_INSTRUMENT(Variant, event, (variant_heap_backup, lhs_.which()));
+
         // Backup lhs content...
-        LhsT* backup_lhs_ptr = new LhsT(lhs_content);
+        LhsT* backup_lhs_ptr = detail::variant::new_backup(lhs_content);
 
         // ...destroy lhs content...
         lhs_content.~LhsT(); // nothrow
@@ -825,7 +1271,7 @@ private: // helpers, for visitor interface (below)
         lhs_.indicate_which(rhs_which_); // nothrow
 
         // ...and delete backup:
-        delete backup_lhs_ptr; // nothrow
+        detail::variant::delete_backup(backup_lhs_ptr); // nothrow
     }
 
 public: // visitor interface
@@ -833,8 +1279,12 @@ public: // visitor interface
     template <typename LhsT>
     void internal_visit(LhsT& lhs_content, int)
     {
-        typedef typename is_nothrow_move_constructible<LhsT>::type
-            nothrow_move;
+        // (A nothrow copy backs up on the stack as well as a nothrow move.
+        // Visitation relies on it: such types are never in a heap backup.)
+        typedef typename mpl::or_<
+              is_nothrow_move_constructible<LhsT>
+            , has_nothrow_copy<LhsT>
+            >::type nothrow_move;
 
         backup_assign_impl( lhs_content, nothrow_move(), 1L);
     }
@@ -846,6 +1296,14 @@ private:
 #endif
 };
 
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template invoke_visitor
+//
+// Defined below.
+//
+template <typename Visitor, bool MoveSemantics>
+class invoke_visitor;
+
 ///////////////////////////////////////////////////////////////////////////////
 // (detail) class swap_with
 //
@@ -875,7 +1333,8 @@ public: // internal visitor interfaces
     {
         // Since the precondition ensures types are same, get T...
         known_get<T> getter;
-        T& other = toswap_.apply_visitor(getter);
+        invoke_visitor<known_get<T>, false> invoker(getter);
+        T& other = variant_access::internal_apply_visitor(toswap_, invoker);
 
         // ...and swap:
         ::boost::detail::variant::move_swap( operand, other );
@@ -935,7 +1394,8 @@ public: // visitor interfaces
     {
         // Since the precondition ensures lhs and rhs types are same, get T...
         known_get<T> getter;
-        const T& lhs_content = lhs_.apply_visitor(getter);
+        invoke_visitor<known_get<T>, false> invoker(getter);
+        const T& lhs_content = variant_access::internal_apply_visitor(lhs_, invoker);
 
         // ...and compare lhs and rhs contents:
         return Comp()(lhs_content, rhs_content);
@@ -1030,6 +1490,18 @@ public: // internal visitor interfaces, cont.
         return internal_visit( operand.get(), 1L );
     }
 
+    template <typename T, typename Allocator>
+    result_type internal_visit(boost::boxed<T, Allocator>& operand, long)
+    {
+        return internal_visit( operand.get(), 1L );
+    }
+
+    template <typename T, typename Allocator>
+    result_type internal_visit(const boost::boxed<T, Allocator>& operand, long)
+    {
+        return internal_visit( operand.get(), 1L );
+    }
+
     template <typename T>
     result_type internal_visit(boost::detail::reference_content<T>& operand, long)
     {
@@ -1061,6 +1533,13 @@ private:
 #endif
 };
 
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class variant_access
+//
+// Defined in boost/variant/detail/variant_access.hpp.
+//
+struct variant_access;
+
 }} // namespace detail::variant
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1112,31 +1591,38 @@ private: // helpers, for typedefs (below)
 public: // public typedefs
     typedef typename mpl::eval_if<
           is_recursive_
-        , mpl::transform<
+        , detail::variant::transform_types<
               specified_types
-            , mpl::protect<
-                  detail::variant::quoted_enable_recursive<wknd_self_t>
-                >
+            , detail::variant::quoted_enable_recursive<wknd_self_t>
             >
         , mpl::identity< specified_types >
         >::type recursive_enabled_types;    // used by is_variant_constructible_from<> trait
 
-    typedef typename mpl::transform<
+    typedef typename detail::variant::transform_types<
           recursive_enabled_types
-        , unwrap_recursive<mpl::_1>
+        , detail::variant::quoted_unwrap_recursive
         >::type types;
 
 private: // internal typedefs
 
-    typedef typename mpl::transform<
+    typedef typename detail::variant::transform_types<
           recursive_enabled_types
-        , mpl::protect< detail::make_reference_content<> >
+        , detail::make_reference_content<>
         >::type internal_types;
 
     typedef typename mpl::front<
           internal_types
         >::type internal_T0;
 
+#if defined(BOOST_VARIANT_NO_HEAP)
+    BOOST_STATIC_ASSERT((is_same<
+          typename detail::variant::no_heap_check<
+              internal_types, detail::variant::heap_wrapper_allocation
+            >::type
+        , void
+        >::value));
+#endif
+
 private: // helpers, for representation (below)
 
     typedef typename detail::variant::find_fallback_type<
@@ -1248,10 +1734,59 @@ private: // helpers, for structors (below)
     {
     };
 
+#if defined(BOOST_VARIANT_MINIMIZE_CODE_SIZE)
+    typedef mpl::bool_<never_uses_backup_flag::value> lifecycle_no_backup;
+
+    template <typename Operation>
+    struct lifecycle
+        : detail::variant::lifecycle_table<
+              typename detail::variant::as_type_pack<internal_types>::type
+            , Operation
+            >
+    {
+    };
+#endif
+
+    // Contents destroyed without visitation, and copied or moved as bytes,
+    // if active: a mixed variant pays the dispatch for the others only.
+    typedef detail::variant::content_mask<
+          internal_types, detail::variant::trivially_destructible_pred, false
+        > trivially_destructible_;
+
+    typedef detail::variant::content_mask<
+          internal_types, detail::variant::trivially_copyable_pred, false
+        > trivially_copyable_;
+
+    typedef detail::variant::content_sizes<
+          internal_types, detail::variant::trivially_copyable_pred
+        > trivially_copyable_sizes_;
+
+    // Copies the bytes of a trivially copyable content only, not the whole
+    // storage, most of which may be uninitialized.
+    void copy_trivial_content(const void* source, int internal_which) BOOST_NOEXCEPT
+    {
+        void* const storage = storage_.address();
+        if (storage == source)
+            return;
+
+        detail::variant::copy_content<trivially_copyable_sizes_::max>(
+              storage, source, trivially_copyable_sizes_::values[internal_which]
+            );
+    }
+
     void destroy_content() BOOST_NOEXCEPT
     {
+        if (trivially_destructible_::content(which_))
+            return;
+
+#if defined(BOOST_VARIANT_MINIMIZE_CODE_SIZE)
+        lifecycle<
+              detail::variant::lifecycle_destroy<lifecycle_no_backup>
+            >::functions[which()](storage_.address(), which_);
+#else
         detail::variant::destroyer visitor;
         this->internal_apply_visitor(visitor);
+#endif
     }
 
 public: // structors
@@ -1356,6 +1891,18 @@ private: // helpers, for structors, cont. (below)
             return internal_visit( operand.get(), 1L );
         }
 
+        template <typename T, typename Allocator>
+        int internal_visit(boost::boxed<T, Allocator>& operand, long) const
+        {
+            return internal_visit( operand.get(), 1L );
+        }
+
+        template <typename T, typename Allocator>
+        int internal_visit(const boost::boxed<T, Allocator>& operand, long) const
+        {
+            return internal_visit( operand.get(), 1L );
+        }
+
     };
 
     friend class convert_copy_into;
@@ -1422,6 +1969,18 @@ private: // helpers, for structors, cont. (below)
         {
             return internal_visit( operand.get(), 1L );
         }
+
+        template <typename T, typename Allocator>
+        int internal_visit(boost::boxed<T, Allocator>& operand, long) const
+        {
+            return internal_visit( operand.get(), 1L );
+        }
+
+        template <typename T, typename Allocator>
+        int internal_visit(const boost::boxed<T, Allocator>& operand, long) const
+        {
+            return internal_visit( operand.get(), 1L );
+        }
     };
 
     friend class convert_move_into;
@@ -1635,9 +2194,24 @@ public: // structors, cont.
     // [MSVC6 requires copy constructor appear after template constructors]
     variant(const variant& operand)
     {
+        BOOST_VARIANT_AUX_INSTRUMENT(variant, event, (variant_copy_construct, operand.which()));
+
         // Copy the value of operand into *this...
-        detail::variant::copy_into visitor( storage_.address() );
-        operand.internal_apply_visitor(visitor);
+        if (trivially_copyable_::content(operand.which_))
+        {
+            copy_trivial_content(operand.storage_.address(), operand.which_);
+        }
+        else
+        {
+#if defined(BOOST_VARIANT_MINIMIZE_CODE_SIZE)
+            lifecycle<
+                  detail::variant::lifecycle_copy_construct<lifecycle_no_backup>
+                >::functions[operand.which()](storage_.address(), operand.storage_.address(), operand.which_);
+#else
+            detail::variant::copy_into visitor( storage_.address() );
+            operand.internal_apply_visitor(visitor);
+#endif
+        }
 
         // ...and activate the *this's primary storage on success:
         indicate_which(operand.which());
@@ -1645,19 +2219,122 @@ public: // structors, cont.
 
     variant(variant&& operand) BOOST_NOEXCEPT_IF(variant_move_noexcept_constructible::type::value)
     {
+        BOOST_VARIANT_AUX_INSTRUMENT(variant, event, (variant_move_construct, operand.which()));
+
         // Move the value of operand into *this...
-        detail::variant::move_into visitor( storage_.address() );
-        operand.internal_apply_visitor(visitor);
+        if (trivially_copyable_::content(operand.which_))
+        {
+            copy_trivial_content(operand.storage_.address(), operand.which_);
+        }
+        else
+        {
+#if defined(BOOST_VARIANT_MINIMIZE_CODE_SIZE)
+            lifecycle<
+                  detail::variant::lifecycle_move_construct<lifecycle_no_backup>
+                >::functions[operand.which()](storage_.address(), operand.storage_.address(), operand.which_);
+#else
+            detail::variant::move_into visitor( storage_.address() );
+            operand.internal_apply_visitor(visitor);
+#endif
+        }
 
         // ...and activate the *this's primary storage on success:
         indicate_which(operand.which());
     }
 
+public: // structors, allocator-extended
+
+    // The content is constructed by uses-allocator construction: with the
+    // allocator, if its type uses Allocator. (The allocator is not kept:
+    // the contents of the later assignments are constructed without it.)
+
+    template <typename Allocator>
+    variant(std::allocator_arg_t, const Allocator& allocator)
+    {
+        // NOTE TO USER :
+        // Compile error from here indicates that the first bound
+        // type is not default-constructible.
+        //
+        detail::variant::uses_allocator_construct<internal_T0>(
+              storage_.address(), allocator
+            );
+        indicate_which(0);
+    }
+
+    template <typename Allocator>
+    variant(std::allocator_arg_t, const Allocator& allocator, const variant& operand)
+    {
+        detail::variant::uses_allocator_copy_into<Allocator> visitor(
+              storage_.address(), allocator
+            );
+        operand.internal_apply_visitor(visitor);
+        indicate_which(operand.which());
+    }
+
+    template <typename Allocator>
+    variant(std::allocator_arg_t, const Allocator& allocator, variant&& operand)
+    {
+        detail::variant::uses_allocator_move_into<Allocator> visitor(
+              storage_.address(), allocator
+            );
+        operand.internal_apply_visitor(visitor);
+        indicate_which(operand.which());
+    }
+
+    template <typename Allocator, typename T>
+    variant(
+          std::allocator_arg_t
+        , const Allocator& allocator
+        , T&& operand
+        , typename boost::disable_if<
+              boost::is_same<
+                  typename boost::remove_cv<typename boost::remove_reference<T>::type>::type
+                , variant
+                >
+            , bool
+            >::type = true
+        )
+    {
+        allocator_convert_construct(allocator, std::forward<T>(operand), 1);
+    }
+
+private: // helpers, for allocator-extended structors (above)
+
+    template <typename Allocator, typename T>
+    auto allocator_convert_construct(const Allocator& allocator, T&& operand, int)
+        -> decltype(initializer::select(std::declval<T>()), void())
+    {
+        // Constructs the bounded type that the converting constructors
+        // would pick, with the allocator:
+        typedef decltype(initializer::select(std::declval<T>())) index_t;
+        typedef typename mpl::at<internal_types, index_t>::type internal_t;
+
+        detail::variant::uses_allocator_construct<internal_t>(
+              storage_.address(), allocator, std::forward<T>(operand)
+            );
+        indicate_which(index_t::value);
+    }
+
+    template <typename Allocator, typename T>
+    void allocator_convert_construct(const Allocator& allocator, T&& operand, long)
+    {
+        // Converts as the converting constructors do (e.g., from another
+        // variant), then moves the content into *this with the allocator:
+        variant temp(std::forward<T>(operand));
+        detail::variant::uses_allocator_move_into<Allocator> visitor(
+              storage_.address(), allocator
+            );
+        temp.internal_apply_visitor(visitor);
+        indicate_which(temp.which());
+    }
+
 private: // helpers, for modifiers (below)
 
     template <typename Variant>
     friend class detail::variant::backup_assigner;
 
+    friend struct detail::variant::variant_access;
+
     // class assigner
     //
     // Internal visitor that "assigns" the visited value to the given variant
@@ -1742,6 +2419,8 @@ private: // helpers, for modifiers (below)
             , mpl::true_ // has_fallback_type
             ) const
         {
+            BOOST_VARIANT_AUX_INSTRUMENT(variant, event, (variant_fallback_assign, rhs_which_));
+
             // Destroy lhs's content...
             lhs_.destroy_content(); // nothrow
 
@@ -1772,6 +2451,62 @@ private: // helpers, for modifiers (below)
             , mpl::false_ // has_fallback_type
             ) const
         {
+#if defined(BOOST_GCC) && (BOOST_GCC >= 110000)
+#   pragma GCC diagnostic push
+// Once the lifecycle tables are inlined, GCC takes the padding or the unset
+// members of rhs_content for uninitialized reads of the temporary it came from.
+#   pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+            assign_without_fallback(
+                  rhs_content
+                , mpl::bool_< detail::variant::relocatable_content<RhsT>::value >()
+                );
+#if defined(BOOST_GCC) && (BOOST_GCC >= 110000)
+#   pragma GCC diagnostic pop
+#endif
+        }
+
+        template <typename RhsT, typename Source>
+        void assign_relocated(Source&& rhs_content) const
+        {
+            // Make a temporary copy on the stack (lhs is unchanged if this throws)...
+            alignas(RhsT) unsigned char temp[sizeof(RhsT)];
+            new(temp) RhsT( std::forward<Source>(rhs_content) );
+
+            // ...and upon success destroy lhs's content...
+            lhs_.destroy_content(); // nothrow
+
+            // ...relocate the copy into lhs's storage, without a backup...
+            std::memcpy(lhs_.storage_.address(), temp, sizeof(RhsT)); // nothrow
+
+            // ...and indicate new content type:
+            lhs_.indicate_which(rhs_which_); // nothrow
+        }
+
+        template <typename RhsT>
+        void assign_without_fallback(
+              const RhsT& rhs_content
+            , mpl::true_ // is_trivially_relocatable
+            ) const
+        {
+            assign_relocated<RhsT>(rhs_content);
+        }
+
+        template <typename RhsT>
+        void assign_without_fallback(
+              const RhsT& rhs_content
+            , mpl::false_ // is_trivially_relocatable
+            ) const
+        {
+#if defined(BOOST_VARIANT_NO_HEAP)
+            BOOST_STATIC_ASSERT((is_same<
+                  typename detail::variant::no_heap_check<
+                      internal_types, detail::variant::heap_backup_allocation<RhsT>
+                    >::type
+                , void
+                >::value));
+#endif
+
             detail::variant::backup_assigner<wknd_self_t>
                 visitor(lhs_, rhs_which_, rhs_content);
             lhs_.internal_apply_visitor(visitor);
@@ -1862,6 +2597,8 @@ private: // helpers, for modifiers (below)
             , mpl::true_ // has_fallback_type
             ) const
         {
+            BOOST_VARIANT_AUX_INSTRUMENT(variant, event, (variant_fallback_assign, assigner::rhs_which_));
+
             // Destroy lhs's content...
             assigner::lhs_.destroy_content(); // nothrow
 
@@ -1891,6 +2628,27 @@ private: // helpers, for modifiers (below)
             , mpl::false_ // is_nothrow_move_constructible
             , mpl::false_ // has_fallback_type
             ) const
+        {
+            move_without_fallback(
+                  rhs_content
+                , mpl::bool_< detail::variant::relocatable_content<RhsT>::value >()
+                );
+        }
+
+        template <typename RhsT>
+        void move_without_fallback(
+              RhsT& rhs_content
+            , mpl::true_ // is_trivially_relocatable
+            ) const
+        {
+            assigner::template assign_relocated<RhsT>(detail::variant::move(rhs_content));
+        }
+
+        template <typename RhsT>
+        void move_without_fallback(
+              RhsT& rhs_content
+            , mpl::false_ // is_trivially_relocatable
+            ) const
         {
             assigner::assign_impl(rhs_content, mpl::false_(), mpl::false_(), mpl::false_());
         }
@@ -1924,20 +2682,86 @@ private: // helpers, for modifiers (below)
 
     friend class move_assigner;
 
+#if defined(BOOST_VARIANT_MINIMIZE_CODE_SIZE)
+    // Without throwing constructors the assigners reduce to destruction and
+    // construction, both of which are in the tables:
+    void cross_type_assign(const variant& rhs, mpl::true_) BOOST_NOEXCEPT
+    {
+        destroy_content();
+        lifecycle<
+              detail::variant::lifecycle_copy_construct<lifecycle_no_backup>
+            >::functions[rhs.which()](storage_.address(), rhs.storage_.address(), rhs.which_);
+        indicate_which(rhs.which());
+    }
+
+    void cross_type_assign(const variant& rhs, mpl::false_)
+    {
+        assigner visitor(*this, rhs.which());
+        rhs.internal_apply_visitor(visitor);
+    }
+
+    void cross_type_assign(variant&& rhs, mpl::true_) BOOST_NOEXCEPT
+    {
+        destroy_content();
+        lifecycle<
+              detail::variant::lifecycle_move_construct<lifecycle_no_backup>
+            >::functions[rhs.which()](storage_.address(), rhs.storage_.address(), rhs.which_);
+        indicate_which(rhs.which());
+    }
+
+    void cross_type_assign(variant&& rhs, mpl::false_)
+    {
+        move_assigner visitor(*this, rhs.which());
+        rhs.internal_apply_visitor(visitor);
+    }
+#endif
+
     void variant_assign(const variant& rhs)
     {
         // If the contained types are EXACTLY the same...
         if (which_ == rhs.which_)
         {
+            BOOST_VARIANT_AUX_INSTRUMENT(variant, assignment, (variant_same_type_assign, which(), which()));
+
             // ...then assign rhs's storage to lhs's content:
-            detail::variant::assign_storage visitor(rhs.storage_.address());
-            this->internal_apply_visitor(visitor);
+            if (trivially_copyable_::content(which_))
+            {
+                copy_trivial_content(rhs.storage_.address(), which_);
+            }
+            else
+            {
+#if defined(BOOST_VARIANT_MINIMIZE_CODE_SIZE)
+                lifecycle<
+                      detail::variant::lifecycle_copy_assign<lifecycle_no_backup>
+                    >::functions[which()](storage_.address(), rhs.storage_.address(), which_);
+#else
+                detail::variant::assign_storage visitor(rhs.storage_.address());
+                this->internal_apply_visitor(visitor);
+#endif
+            }
         }
         else
         {
-            // Otherwise, perform general (copy-based) variant assignment:
-            assigner visitor(*this, rhs.which());
-            rhs.internal_apply_visitor(visitor);
+            BOOST_VARIANT_AUX_INSTRUMENT(variant, assignment, (variant_cross_type_assign, which(), rhs.which()));
+
+            // Otherwise, perform general (copy-based) variant assignment,
+            // as bytes if both contents are trivially copyable:
+            if (trivially_copyable_::content(which_) && trivially_copyable_::content(rhs.which_))
+            {
+                copy_trivial_content(rhs.storage_.address(), rhs.which_);
+                indicate_which(rhs.which_);
+            }
+            else
+            {
+#if defined(BOOST_VARIANT_MINIMIZE_CODE_SIZE)
+                cross_type_assign(rhs, detail::variant::lifecycle_all_nothrow<
+                      internal_types, detail::variant::lifecycle_throwing_copy
+                    >());
+#else
+                assigner visitor(*this, rhs.which());
+                rhs.internal_apply_visitor(visitor);
+#endif
+            }
         }
     }
 
@@ -1946,15 +2770,47 @@ private: // helpers, for modifiers (below)
         // If the contained types are EXACTLY the same...
         if (which_ == rhs.which_)
         {
+            BOOST_VARIANT_AUX_INSTRUMENT(variant, assignment, (variant_same_type_assign, which(), which()));
+
             // ...then move rhs's storage to lhs's content:
-            detail::variant::move_storage visitor(rhs.storage_.address());
-            this->internal_apply_visitor(visitor);
+            if (trivially_copyable_::content(which_))
+            {
+                copy_trivial_content(rhs.storage_.address(), which_);
+            }
+            else
+            {
+#if defined(BOOST_VARIANT_MINIMIZE_CODE_SIZE)
+                lifecycle<
+                      detail::variant::lifecycle_move_assign<lifecycle_no_backup>
+                    >::functions[which()](storage_.address(), rhs.storage_.address(), which_);
+#else
+                detail::variant::move_storage visitor(rhs.storage_.address());
+                this->internal_apply_visitor(visitor);
+#endif
+            }
         }
         else
         {
-            // Otherwise, perform general (move-based) variant assignment:
-            move_assigner visitor(*this, rhs.which());
-            rhs.internal_apply_visitor(visitor);
+            BOOST_VARIANT_AUX_INSTRUMENT(variant, assignment, (variant_cross_type_assign, which(), rhs.which()));
+
+            // Otherwise, perform general (move-based) variant assignment,
+            // as bytes if both contents are trivially copyable:
+            if (trivially_copyable_::content(which_) && trivially_copyable_::content(rhs.which_))
+            {
+                copy_trivial_content(rhs.storage_.address(), rhs.which_);
+                indicate_which(rhs.which_);
+            }
+            else
+            {
+#if defined(BOOST_VARIANT_MINIMIZE_CODE_SIZE)
+                cross_type_assign(detail::variant::move(rhs), detail::variant::lifecycle_all_nothrow<
+                      internal_types, detail::variant::lifecycle_throwing_move
+                    >());
+#else
+                move_assigner visitor(*this, rhs.which());
+                rhs.internal_apply_visitor(visitor);
+#endif
+            }
         }
     }
 
@@ -1963,11 +2819,17 @@ private: // helpers, for modifiers (below)
     template <typename T>
     void assign(const T& rhs)
     {
-        // If direct T-to-T assignment is not possible...
+        // Attempt direct T-to-T assignment (internally, so that it is not
+        // instrumented as a visitation)...
         detail::variant::direct_assigner<T> direct_assign(rhs);
-        if (this->apply_visitor(direct_assign) == false)
+        detail::variant::invoke_visitor<detail::variant::direct_assigner<T>, false> invoker(direct_assign);
+        if (this->internal_apply_visitor(invoker))
         {
-            // ...then convert rhs to variant and assign:
+            BOOST_VARIANT_AUX_INSTRUMENT(variant, assignment, (variant_same_type_assign, which(), which()));
+        }
+        else
+        {
+            // ...and if it is not possible, convert rhs to variant and assign:
             //
             // While potentially inefficient, the following construction of a
             // variant allows T as any type convertible to one of the bounded
@@ -1981,11 +2843,17 @@ private: // helpers, for modifiers (below)
     template <typename T>
     void move_assign(T&& rhs)
     {
-        // If direct T-to-T move assignment is not possible...
+        // Attempt direct T-to-T move assignment (internally, so that it is not
+        // instrumented as a visitation)...
         detail::variant::direct_mover<T> direct_move(rhs);
-        if (this->apply_visitor(direct_move) == false)
+        detail::variant::invoke_visitor<detail::variant::direct_mover<T>, false> invoker(direct_move);
+        if (this->internal_apply_visitor(invoker))
         {
-            // ...then convert rhs to variant and assign:
+            BOOST_VARIANT_AUX_INSTRUMENT(variant, assignment, (variant_same_type_assign, which(), which()));
+        }
+        else
+        {
+            // ...and if it is not possible, convert rhs to variant and assign:
             //
             // While potentially inefficient, the following construction of a
             // variant allows T as any type convertible to one of the bounded
@@ -1996,6 +2864,92 @@ private: // helpers, for modifiers (below)
         }
     }
 
+    typedef detail::variant::relocatable_flags<internal_types> relocatable_flags_;
+
+    typedef detail::variant::content_sizes<
+          internal_types, detail::variant::relocatable_content_pred
+        > relocatable_sizes_;
+
+    // Relocates the bytes of a trivially relocatable content only, not the
+    // whole storage (see copy_trivial_content).
+    static void relocate_content(void* storage, const void* source, int internal_which) BOOST_NOEXCEPT
+    {
+        detail::variant::copy_content<relocatable_sizes_::max>(
+              storage, source
+            , internal_which < 0
+                ? (never_uses_backup_flag::value ? 0 : sizeof(void*)) // backup_holder holds a pointer
+                : relocatable_sizes_::values[internal_which]
+            );
+    }
+
+    void swap_cross_type(variant& rhs, mpl::true_ /*all*/, mpl::true_ /*any*/) BOOST_NOEXCEPT
+    {
+        // Exchange the bytes of the contents...
+        storage_t temp;
+        relocate_content(temp.address(), storage_.address(), which_);
+        relocate_content(storage_.address(), rhs.storage_.address(), rhs.which_);
+        relocate_content(rhs.storage_.address(), temp.address(), which_);
+
+        // ...and the internal indices (and with them the backup states):
+        const which_t which = which_;
+        which_ = rhs.which_;
+        rhs.which_ = which;
+    }
+
+    void swap_cross_type(variant& rhs, mpl::false_ /*all*/, mpl::true_ /*any*/)
+    {
+        if (relocatable_flags_::content(which_))
+            relocate_swap(rhs);
+        else if (relocatable_flags_::content(rhs.which_))
+            rhs.relocate_swap(*this);
+        else
+            swap_cross_type(rhs, mpl::false_(), mpl::false_());
+    }
+
+    void swap_cross_type(variant& rhs, mpl::false_ /*all*/, mpl::false_ /*any*/)
+    {
+        variant tmp( detail::variant::move(rhs) );
+        rhs = detail::variant::move(*this);
+        *this = detail::variant::move(tmp);
+    }
+
+    // Precondition: the content of *this is trivially relocatable
+    void relocate_swap(variant& rhs)
+    {
+        // Relocate lhs's content aside...
+        storage_t temp;
+        relocate_content(temp.address(), storage_.address(), which_); // nothrow
+        const which_t which = which_;
+
+        BOOST_TRY
+        {
+            // ...move rhs's content into lhs's storage...
+#if defined(BOOST_VARIANT_MINIMIZE_CODE_SIZE)
+            lifecycle<
+                  detail::variant::lifecycle_move_construct<lifecycle_no_backup>
+                >::functions[rhs.which()](storage_.address(), rhs.storage_.address(), rhs.which_);
+#else
+            detail::variant::move_into visitor( storage_.address() );
+            rhs.internal_apply_visitor(visitor);
+#endif
+        }
+        BOOST_CATCH (...)
+        {
+            // ...or, in the event of failure, put lhs's content back:
+            relocate_content(storage_.address(), temp.address(), which); // nothrow
+
+            BOOST_RETHROW;
+        }
+        BOOST_CATCH_END
+
+        indicate_which(rhs.which()); // nothrow
+
+        // ...and relocate lhs's old content into rhs's storage:
+        rhs.destroy_content(); // nothrow
+        relocate_content(rhs.storage_.address(), temp.address(), which); // nothrow
+        rhs.which_ = which;
+    }
+
 public: // modifiers
 
 #if !BOOST_WORKAROUND(BOOST_CLANG_VERSION, BOOST_TESTED_AT(150000)) || BOOST_CXX_VERSION <= 202002L
@@ -2049,15 +3003,24 @@ public: // modifiers
         if (which() == rhs.which())
         {
             // ...then swap the values directly:
+#if defined(BOOST_VARIANT_MINIMIZE_CODE_SIZE)
+            lifecycle<
+                  detail::variant::lifecycle_swap<lifecycle_no_backup>
+                >::functions[which()](storage_.address(), which_, rhs.storage_.address(), rhs.which_);
+#else
             detail::variant::swap_with<variant> visitor(rhs);
-            this->apply_visitor(visitor);
+            detail::variant::invoke_visitor<detail::variant::swap_with<variant>, false> invoker(visitor);
+            this->internal_apply_visitor(invoker);
+#endif
         }
         else
         {
-            // ...otherwise, perform general variant swap:
-            variant tmp( detail::variant::move(rhs) );
-            rhs = detail::variant::move(*this);
-            *this = detail::variant::move(tmp);
+            // ...otherwise, relocate the contents that allow it:
+            swap_cross_type(
+                  rhs
+                , typename relocatable_flags_::all()
+                , typename relocatable_flags_::any()
+                );
         }
     }
 
@@ -2074,8 +3037,13 @@ public: // queries
 
     const boost::typeindex::type_info& type() const
     {
+#if defined(BOOST_VARIANT_MINIMIZE_CODE_SIZE)
+        return lifecycle< detail::variant::lifecycle_type >::functions[which()]();
+#else
         detail::variant::reflect visitor;
-        return this->apply_visitor(visitor);
+        detail::variant::invoke_visitor<detail::variant::reflect, false> invoker(visitor);
+        return this->internal_apply_visitor(invoker);
+#endif
     }
 
 public: // prevent comparison with foreign types
@@ -2125,10 +3093,18 @@ public: // comparison operators
         if (this->which() != rhs.which())
             return false;
 
-        detail::variant::comparer<
+#if defined(BOOST_VARIANT_MINIMIZE_CODE_SIZE)
+        return lifecycle<
+              detail::variant::lifecycle_compare<lifecycle_no_backup, detail::variant::equal_comp>
+            >::functions[which()](storage_.address(), which_, rhs.storage_.address(), rhs.which_);
+#else
+        typedef detail::variant::comparer<
               variant, detail::variant::equal_comp
-            > visitor(*this);
-        return rhs.apply_visitor(visitor);
+            > comparer_t;
+        comparer_t visitor(*this);
+        detail::variant::invoke_visitor<comparer_t, false> invoker(visitor);
+        return rhs.internal_apply_visitor(invoker);
+#endif
     }
 
     bool operator<(const variant& rhs) const
@@ -2140,10 +3116,18 @@ public: // comparison operators
         if (this->which() != rhs.which())
             return this->which() < rhs.which();
 
-        detail::variant::comparer<
+#if defined(BOOST_VARIANT_MINIMIZE_CODE_SIZE)
+        return lifecycle<
+              detail::variant::lifecycle_compare<lifecycle_no_backup, detail::variant::less_comp>
+            >::functions[which()](storage_.address(), which_, rhs.storage_.address(), rhs.which_);
+#else
+        typedef detail::variant::comparer<
               variant, detail::variant::less_comp
-            > visitor(*this);
-        return rhs.apply_visitor(visitor);
+            > comparer_t;
+        comparer_t visitor(*this);
+        detail::variant::invoke_visitor<comparer_t, false> invoker(visitor);
+        return rhs.internal_apply_visitor(invoker);
+#endif
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -2225,38 +3209,66 @@ public:
             );
     }
 
+    // Tests the variant_likely_alternatives of this variant type, if any,
+    // before the generic visitation.
+    template <typename Visitor>
+    BOOST_FORCEINLINE typename Visitor::result_type
+    likely_apply_visitor(Visitor& visitor)
+    {
+        return detail::variant::likely_visitation<
+              typename variant_likely_alternatives<variant>::type
+            >::apply(*this, visitor);
+    }
+
+    template <typename Visitor>
+    BOOST_FORCEINLINE typename Visitor::result_type
+    likely_apply_visitor(Visitor& visitor) const
+    {
+        return detail::variant::likely_visitation<
+              typename variant_likely_alternatives<variant>::type
+            >::apply(*this, visitor);
+    }
+
 public: // visitation support
 
     template <typename Visitor>
     typename Visitor::result_type
     apply_visitor(Visitor& visitor) &&
     {
+        BOOST_VARIANT_AUX_INSTRUMENT(variant, visit, (which()));
+
         detail::variant::invoke_visitor<Visitor, true> invoker(visitor);
-        return this->internal_apply_visitor(invoker);
+        return this->likely_apply_visitor(invoker);
     }
 
     template <typename Visitor>
     typename Visitor::result_type
     apply_visitor(Visitor& visitor) const&&
     {
+        BOOST_VARIANT_AUX_INSTRUMENT(variant, visit, (which()));
+
         detail::variant::invoke_visitor<Visitor, true> invoker(visitor);
-        return this->internal_apply_visitor(invoker);
+        return this->likely_apply_visitor(invoker);
     }
 
     template <typename Visitor>
     typename Visitor::result_type
     apply_visitor(Visitor& visitor) &
     {
+        BOOST_VARIANT_AUX_INSTRUMENT(variant, visit, (which()));
+
         detail::variant::invoke_visitor<Visitor, false> invoker(visitor);
-        return this->internal_apply_visitor(invoker);
+        return this->likely_apply_visitor(invoker);
     }
 
     template <typename Visitor>
     typename Visitor::result_type
     apply_visitor(Visitor& visitor) const &
     {
+        BOOST_VARIANT_AUX_INSTRUMENT(variant, visit, (which()));
+
         detail::variant::invoke_visitor<Visitor, false> invoker(visitor);
-        return this->internal_apply_visitor(invoker);
+        return this->likely_apply_visitor(invoker);
     }
 
 }; // class variant
@@ -0,0 +1,312 @@
+//-----------------------------------------------------------------------------
+// boost variant/variant_dispatcher.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_VARIANT_DISPATCHER_HPP
+#define BOOST_VARIANT_VARIANT_DISPATCHER_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <cstddef> // for std::size_t
+#include <new> // for placement new
+
+#include <boost/static_assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/variant/variant.hpp>
+#include <boost/variant/bad_visit.hpp>
+#include <boost/variant/detail/element_index.hpp>
+#include <boost/variant/detail/variant_access.hpp>
+
+#include <boost/type_traits/aligned_storage.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/type_traits/decay.hpp>
+
+namespace boost {
+
+namespace detail { namespace variant {
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template dispatch_handler
+//
+// Small buffer handler of variant_dispatcher: the callable is stored in place,
+// invoke is the entry of the dispatch table and destroy destroys the callable
+// (null if the slot is empty).
+//
+template <typename Variant, typename R, std::size_t Capacity>
+struct dispatch_handler
+{
+    typedef typename boost::aligned_storage<Capacity>::type storage_t;
+    typedef R (*invoke_t)(const dispatch_handler* handlers, const Variant& operand);
+    typedef void (*destroy_t)(dispatch_handler& handler);
+
+    invoke_t invoke;
+    destroy_t destroy;
+    mutable storage_t storage;
+
+    template <typename F>
+    F& callable() const BOOST_NOEXCEPT
+    {
+        return *static_cast<F*>(static_cast<void*>(&storage));
+    }
+
+    template <typename F>
+    static void destroy_callable(dispatch_handler& handler) BOOST_NOEXCEPT
+    {
+        handler.template callable<F>().~F();
+    }
+};
+
+}} // namespace detail::variant
+
+///////////////////////////////////////////////////////////////////////////////
+// class template variant_dispatcher
+//
+// Dispatches values of Variant to handlers registered at runtime for the
+// bounded types. The handlers are kept in a flat array indexed by which(),
+// so dispatch is a single indirect call. The values of the bounded types
+// without a handler go to the default handler.
+//
+// The handlers are stored in place and must fit into Capacity bytes; the
+// dispatcher never allocates.
+//
+template <typename Variant, typename R = void, std::size_t Capacity = 4 * sizeof(void*)>
+class variant_dispatcher
+{
+public: // typedefs
+
+    typedef R result_type;
+    typedef Variant variant_type;
+
+    BOOST_STATIC_CONSTANT(std::size_t, handler_capacity = Capacity);
+
+private: // representation
+
+    typedef detail::variant::dispatch_handler<Variant, R, Capacity> handler_t;
+
+    BOOST_STATIC_CONSTANT(int, size = detail::variant::variant_size<Variant>::value);
+
+    // handlers_[size] is the default handler
+    handler_t handlers_[size + 1];
+
+private: // dispatch table entries
+
+    template <int I, typename F>
+    static R invoke_handler(const handler_t* handlers, const Variant& operand)
+    {
+        return static_cast<R>(
+            handlers[I].template callable<F>()(detail::variant::unchecked_get<I>(operand))
+        );
+    }
+
+    static R invoke_default_slot(const handler_t* handlers, const Variant& operand)
+    {
+        return handlers[size].invoke(handlers, operand);
+    }
+
+    template <typename F>
+    static R invoke_default(const handler_t* handlers, const Variant& operand)
+    {
+        return static_cast<R>(handlers[size].template callable<F>()(operand));
+    }
+
+    static R invoke_unhandled(const handler_t*, const Variant&)
+    {
+        boost::throw_exception(boost::bad_visit());
+    }
+
+    template <typename F>
+    static void check_callable() BOOST_NOEXCEPT
+    {
+        BOOST_STATIC_ASSERT_MSG(
+            sizeof(F) <= Capacity,
+            "boost::variant_dispatcher: the handler does not fit into the handler_capacity"
+        );
+        BOOST_STATIC_ASSERT_MSG(
+            boost::alignment_of<F>::value <= boost::alignment_of<typename handler_t::storage_t>::value,
+            "boost::variant_dispatcher: the handler is overaligned"
+        );
+    }
+
+    void clear(handler_t& handler, typename handler_t::invoke_t empty_invoke) BOOST_NOEXCEPT
+    {
+        if (handler.destroy) {
+            handler.destroy(handler);
+            handler.destroy = nullptr;
+        }
+        handler.invoke = empty_invoke;
+    }
+
+    template <typename F>
+    void assign(handler_t& handler, F&& f, typename handler_t::invoke_t invoke, typename handler_t::invoke_t empty_invoke)
+    {
+        typedef typename boost::decay<F>::type callable_t;
+        variant_dispatcher::check_callable<callable_t>();
+
+        // If the construction throws, the slot stays empty
+        clear(handler, empty_invoke);
+        ::new (static_cast<void*>(&handler.storage)) callable_t(static_cast<F&&>(f));
+        handler.destroy = &handler_t::template destroy_callable<callable_t>;
+        handler.invoke = invoke;
+    }
+
+public: // structors
+
+    variant_dispatcher() BOOST_NOEXCEPT
+    {
+        for (int i = 0; i < size; ++i) {
+            handlers_[i].invoke = &variant_dispatcher::invoke_default_slot;
+            handlers_[i].destroy = nullptr;
+        }
+        handlers_[size].invoke = &variant_dispatcher::invoke_unhandled;
+        handlers_[size].destroy = nullptr;
+    }
+
+    ~variant_dispatcher()
+    {
+        for (int i = 0; i <= size; ++i) {
+            if (handlers_[i].destroy)
+                handlers_[i].destroy(handlers_[i]);
+        }
+    }
+
+private:
+    variant_dispatcher(const variant_dispatcher&);
+    variant_dispatcher& operator=(const variant_dispatcher&);
+
+public: // modifiers
+
+    // Registers f(const T&) as the handler of T, replacing the previous one.
+    template <typename T, typename F>
+    void on(F&& f)
+    {
+        BOOST_STATIC_ASSERT_MSG(
+            (detail::variant::holds_element<Variant, T>::value),
+            "boost::variant_dispatcher::on<T>: T must be one of the bounded types"
+        );
+        typedef detail::variant::element_position<Variant, T> index_t;
+
+        assign(
+              handlers_[index_t::value]
+            , static_cast<F&&>(f)
+            , &variant_dispatcher::template invoke_handler<index_t::value, typename boost::decay<F>::type>
+            , &variant_dispatcher::invoke_default_slot
+            );
+    }
+
+    // Registers f(const Variant&) as the handler of the bounded types without
+    // their own handler. Without it such values are rejected with bad_visit.
+    template <typename F>
+    void on_default(F&& f)
+    {
+        assign(
+              handlers_[size]
+            , static_cast<F&&>(f)
+            , &variant_dispatcher::template invoke_default<typename boost::decay<F>::type>
+            , &variant_dispatcher::invoke_unhandled
+            );
+    }
+
+    // Removes the handler of T: its values go to the default handler.
+    template <typename T>
+    void reset() BOOST_NOEXCEPT
+    {
+        BOOST_STATIC_ASSERT_MSG(
+            (detail::variant::holds_element<Variant, T>::value),
+            "boost::variant_dispatcher::reset<T>: T must be one of the bounded types"
+        );
+
+        clear(
+              handlers_[detail::variant::element_position<Variant, T>::value]
+            , &variant_dispatcher::invoke_default_slot
+            );
+    }
+
+public: // queries
+
+    template <typename T>
+    bool has_handler() const BOOST_NOEXCEPT
+    {
+        BOOST_STATIC_ASSERT_MSG(
+            (detail::variant::holds_element<Variant, T>::value),
+            "boost::variant_dispatcher::has_handler<T>: T must be one of the bounded types"
+        );
+
+        return handlers_[detail::variant::element_position<Variant, T>::value].destroy != nullptr;
+    }
+
+    bool has_default() const BOOST_NOEXCEPT
+    {
+        return handlers_[size].destroy != nullptr;
+    }
+
+public: // dispatch
+
+    // Calls the handler of operand.which(), or the default handler.
+    //
+    // Throws bad_visit if there is no handler for the value.
+    R dispatch(const Variant& operand) const
+    {
+        return handlers_[operand.which()].invoke(handlers_, operand);
+    }
+
+    R operator()(const Variant& operand) const
+    {
+        return dispatch(operand);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// function template apply_dispatcher(dispatcher)
+//
+// Returns a copyable function object that dispatches its argument using
+// the given dispatcher, for use with algorithms over ranges of variants
+// as the result of apply_visitor(visitor) is used.
+//
+// NOTE: The dispatcher is kept by reference and must outlive the result.
+//
+template <typename Dispatcher>
+class apply_dispatcher_delayed_t
+{
+public: // typedefs
+
+    typedef typename Dispatcher::result_type result_type;
+
+private: // representation
+
+    const Dispatcher* dispatcher_;
+
+public: // structors
+
+    explicit apply_dispatcher_delayed_t(const Dispatcher& dispatcher) BOOST_NOEXCEPT
+        : dispatcher_(&dispatcher)
+    {
+    }
+
+public: // function object interface
+
+    result_type operator()(const typename Dispatcher::variant_type& operand) const
+    {
+        return dispatcher_->dispatch(operand);
+    }
+};
+
+template <typename Variant, typename R, std::size_t Capacity>
+inline apply_dispatcher_delayed_t<variant_dispatcher<Variant, R, Capacity> >
+apply_dispatcher(const variant_dispatcher<Variant, R, Capacity>& dispatcher) BOOST_NOEXCEPT
+{
+    return apply_dispatcher_delayed_t<variant_dispatcher<Variant, R, Capacity> >(dispatcher);
+}
+
+} // namespace boost
+
+#endif // BOOST_VARIANT_VARIANT_DISPATCHER_HPP
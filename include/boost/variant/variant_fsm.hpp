@@ -0,0 +1,390 @@
+//-----------------------------------------------------------------------------
+// boost variant/variant_fsm.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_VARIANT_FSM_HPP
+#define BOOST_VARIANT_VARIANT_FSM_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <cstddef> // for std::size_t
+#include <new> // for placement new
+#include <utility> // for std::declval
+
+#include <boost/static_assert.hpp>
+#include <boost/core/no_exceptions_support.hpp>
+#include <boost/variant/variant.hpp>
+#include <boost/variant/detail/element_index.hpp>
+#include <boost/variant/detail/index_sequence.hpp>
+#include <boost/variant/detail/move.hpp>
+#include <boost/variant/detail/variant_access.hpp>
+
+#include <boost/blank.hpp>
+#include <boost/mpl/begin_end.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/deref.hpp>
+#include <boost/mpl/distance.hpp>
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/find.hpp>
+#include <boost/mpl/find_if.hpp>
+#include <boost/mpl/identity.hpp>
+#include <boost/type_traits/has_nothrow_constructor.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+namespace boost {
+
+namespace detail { namespace variant {
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) metafunction fsm_transition_result
+//
+// The state returned by transitions(State&&, const Event&), or
+// fsm_no_transition if there is no such transition.
+//
+struct fsm_no_transition {};
+
+template <typename Transitions, typename State, typename Event>
+struct fsm_transition_result
+{
+private: // helpers, for metafunction result (below)
+
+    template <typename U>
+    static decltype(std::declval<U&>()(std::declval<State&&>(), std::declval<const Event&>()))
+    test(int);
+
+    template <typename U>
+    static fsm_no_transition test(...);
+
+public: // metafunction result
+
+    typedef decltype(fsm_transition_result::test<Transitions>(0)) type;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) metafunction fsm_fallback_state
+//
+// The state to leave the machine in if a transition throws: boost::blank or
+// the first nothrow default constructible state, fsm_no_transition if there
+// is none.
+//
+template <typename Types>
+struct fsm_fallback_state
+{
+private: // helpers, for metafunction result (below)
+
+    typedef typename mpl::find<Types, boost::blank>::type blank_it;
+    typedef typename mpl::eval_if<
+          boost::is_same<blank_it, typename mpl::end<Types>::type>
+        , mpl::find_if<Types, boost::has_nothrow_constructor<mpl::_1> >
+        , mpl::identity<blank_it>
+        >::type iterator;
+
+public: // metafunction result
+
+    typedef typename mpl::eval_if<
+          boost::is_same<iterator, typename mpl::end<Types>::type>
+        , mpl::identity<fsm_no_transition>
+        , mpl::deref<iterator>
+        >::type type;
+
+    typedef typename mpl::distance<typename mpl::begin<Types>::type, iterator>::type index;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template fsm_counters
+//
+// Per-transition counters of variant_fsm, empty if not enabled.
+//
+template <bool Enabled, std::size_t States, std::size_t Events>
+struct fsm_counters
+{
+    void count(std::size_t, std::size_t) BOOST_NOEXCEPT
+    {
+    }
+};
+
+template <std::size_t States, std::size_t Events>
+struct fsm_counters<true, States, Events>
+{
+    std::size_t counts[States * Events];
+
+    fsm_counters() BOOST_NOEXCEPT
+        : counts()
+    {
+    }
+
+    void count(std::size_t state, std::size_t event) BOOST_NOEXCEPT
+    {
+        ++counts[state * Events + event];
+    }
+};
+
+template <typename Fsm, typename Indexes>
+struct fsm_dispatch_table;
+
+template <typename Fsm, std::size_t... I>
+struct fsm_dispatch_table<Fsm, index_sequence<I...> >
+{
+    typedef bool (*transit_t)(Fsm&, const typename Fsm::event_type&);
+
+    static const transit_t table[sizeof...(I)];
+};
+
+template <typename Fsm, std::size_t... I>
+const typename fsm_dispatch_table<Fsm, index_sequence<I...> >::transit_t
+    fsm_dispatch_table<Fsm, index_sequence<I...> >::table[sizeof...(I)]
+        = { &Fsm::template transit_event<
+              static_cast<int>(I / Fsm::events_count)
+            , static_cast<int>(I % Fsm::events_count)
+          >... };
+
+template <typename Fsm, typename Event, typename Indexes>
+struct fsm_state_table;
+
+template <typename Fsm, typename Event, std::size_t... I>
+struct fsm_state_table<Fsm, Event, index_sequence<I...> >
+{
+    typedef bool (*transit_t)(Fsm&, const Event&);
+
+    static const transit_t table[sizeof...(I)];
+};
+
+template <typename Fsm, typename Event, std::size_t... I>
+const typename fsm_state_table<Fsm, Event, index_sequence<I...> >::transit_t
+    fsm_state_table<Fsm, Event, index_sequence<I...> >::table[sizeof...(I)]
+        = { &Fsm::template transit<static_cast<int>(I), Event>... };
+
+}} // namespace detail::variant
+
+///////////////////////////////////////////////////////////////////////////////
+// class template variant_fsm
+//
+// Finite state machine whose state is a StateVariant and whose events are
+// EventVariant values. The transition table is built at compile time from
+// the overloads of
+//
+//   NewState Transitions::operator()(State&& state, const Event& event);
+//
+// for the pairs of state and event alternatives; events without a
+// transition from the current state are ignored. Dispatch is a single
+// indirect call through a table indexed by both which().
+//
+// The state is replaced in place: the old state is moved out of the variant
+// storage, destroyed there, and the new state is constructed in the same
+// storage from the result of the transition. No heap backup is ever made.
+// If a transition throws, the machine is left in the fallback state of
+// StateVariant (its first nothrow default constructible state, preferring
+// boost::blank); throwing transitions require one.
+//
+// If CountTransitions is true, the machine counts the performed transitions
+// per pair of state and event alternatives.
+//
+template <typename StateVariant, typename EventVariant, typename Transitions, bool CountTransitions = false>
+class variant_fsm
+    : private detail::variant::fsm_counters<
+          CountTransitions
+        , detail::variant::variant_size<StateVariant>::value
+        , detail::variant::variant_size<EventVariant>::value
+        >
+{
+public: // typedefs
+
+    typedef StateVariant state_type;
+    typedef EventVariant event_type;
+    typedef Transitions transitions_type;
+
+    BOOST_STATIC_CONSTANT(std::size_t, states_count = detail::variant::variant_size<StateVariant>::value);
+    BOOST_STATIC_CONSTANT(std::size_t, events_count = detail::variant::variant_size<EventVariant>::value);
+
+private: // representation
+
+    typedef detail::variant::fsm_counters<CountTransitions, states_count, events_count> counters_t;
+    typedef detail::variant::fsm_fallback_state<typename StateVariant::types> fallback_t;
+
+    template <typename Fsm, typename Indexes>
+    friend struct detail::variant::fsm_dispatch_table;
+
+    template <typename Fsm, typename Event, typename Indexes>
+    friend struct detail::variant::fsm_state_table;
+
+    StateVariant state_;
+    Transitions transitions_;
+
+private: // dispatch table entries
+
+    template <int I, typename Event>
+    static bool transit(variant_fsm& self, const Event& event)
+    {
+        typedef typename detail::variant::variant_alternative<StateVariant, I>::type state_t;
+        typedef typename detail::variant::fsm_transition_result<Transitions, state_t, Event>::type next_t;
+
+        return self.template transit_to<I, state_t, next_t>(
+              event
+            , mpl::bool_<!boost::is_same<next_t, detail::variant::fsm_no_transition>::value>()
+            );
+    }
+
+    template <int I, int J>
+    static bool transit_event(variant_fsm& self, const EventVariant& event)
+    {
+        return variant_fsm::transit<I>(self, detail::variant::unchecked_get<J>(event));
+    }
+
+    template <int I, typename State, typename Next, typename Event>
+    bool transit_to(const Event&, mpl::false_ /*has_transition*/) BOOST_NOEXCEPT
+    {
+        return false;
+    }
+
+    template <int I, typename State, typename Next, typename Event>
+    bool transit_to(const Event& event, mpl::true_ /*has_transition*/)
+    {
+        BOOST_STATIC_ASSERT_MSG(
+            (boost::is_same<typename detail::variant::variant_alternative<StateVariant, I>::internal_type, State>::value),
+            "boost::variant_fsm: states can not be recursive_wrapper or reference types"
+        );
+        BOOST_STATIC_ASSERT_MSG(
+            (detail::variant::holds_element<StateVariant, Next>::value),
+            "boost::variant_fsm: a transition must return one of the states"
+        );
+
+        typedef detail::variant::element_position<StateVariant, Next> next_index;
+
+        void* const storage = detail::variant::variant_access::storage(state_);
+        State& current = *static_cast<State*>(storage);
+        State previous(detail::variant::move(current));
+        current.~State();
+
+        construct_next<Next>(
+              storage, previous, event
+            , mpl::bool_<noexcept(Next(std::declval<Transitions&>()(detail::variant::move(previous), event)))>()
+            );
+        detail::variant::variant_access::indicate_which(state_, next_index::value);
+
+        counters_t::count(I, detail::variant::element_position<EventVariant, Event>::value);
+        return true;
+    }
+
+    template <typename Next, typename State, typename Event>
+    void construct_next(void* storage, State& previous, const Event& event, mpl::true_ /*nothrow*/) BOOST_NOEXCEPT
+    {
+        ::new (storage) Next(transitions_(detail::variant::move(previous), event));
+    }
+
+    template <typename Next, typename State, typename Event>
+    void construct_next(void* storage, State& previous, const Event& event, mpl::false_ /*nothrow*/)
+    {
+        typedef typename fallback_t::type fallback_type;
+
+        BOOST_STATIC_ASSERT_MSG(
+            !(boost::is_same<fallback_type, detail::variant::fsm_no_transition>::value),
+            "boost::variant_fsm: throwing transitions require a nothrow default constructible state"
+        );
+
+        BOOST_TRY {
+            ::new (storage) Next(transitions_(detail::variant::move(previous), event));
+        } BOOST_CATCH (...) {
+            ::new (storage) fallback_type();
+            detail::variant::variant_access::indicate_which(state_, fallback_t::index::value);
+            BOOST_RETHROW;
+        } BOOST_CATCH_END
+    }
+
+public: // structors
+
+    explicit variant_fsm(const StateVariant& initial, const Transitions& transitions = Transitions())
+        : state_(initial)
+        , transitions_(transitions)
+    {
+    }
+
+    explicit variant_fsm(StateVariant&& initial, const Transitions& transitions = Transitions())
+        : state_(detail::variant::move(initial))
+        , transitions_(transitions)
+    {
+    }
+
+private:
+    variant_fsm(const variant_fsm&);
+    variant_fsm& operator=(const variant_fsm&);
+
+public: // queries
+
+    const StateVariant& state() const BOOST_NOEXCEPT
+    {
+        return state_;
+    }
+
+    int which() const BOOST_NOEXCEPT
+    {
+        return state_.which();
+    }
+
+    Transitions& transitions() BOOST_NOEXCEPT
+    {
+        return transitions_;
+    }
+
+    const Transitions& transitions() const BOOST_NOEXCEPT
+    {
+        return transitions_;
+    }
+
+    // Number of the transitions performed from the state with index state
+    // on the event with index event. Requires CountTransitions.
+    std::size_t transition_count(std::size_t state, std::size_t event) const BOOST_NOEXCEPT
+    {
+        BOOST_STATIC_ASSERT_MSG(
+            CountTransitions,
+            "boost::variant_fsm::transition_count requires CountTransitions"
+        );
+
+        return counters_t::counts[state * events_count + event];
+    }
+
+public: // modifiers
+
+    // Performs the transition from the current state on the event. Returns
+    // false if there is no such transition.
+    bool process(const EventVariant& event)
+    {
+        typedef detail::variant::fsm_dispatch_table<
+              variant_fsm
+            , typename detail::variant::make_index_sequence<states_count * events_count>::type
+            > table_t;
+
+        return table_t::table[state_.which() * static_cast<int>(events_count) + event.which()](*this, event);
+    }
+
+    // Same as above for an event of known type: dispatches on the state only.
+    template <typename Event>
+    bool process(const Event& event)
+    {
+        BOOST_STATIC_ASSERT_MSG(
+            (detail::variant::holds_element<EventVariant, Event>::value),
+            "boost::variant_fsm::process: Event must be one of the events"
+        );
+
+        typedef detail::variant::fsm_state_table<
+              variant_fsm
+            , Event
+            , typename detail::variant::make_index_sequence<states_count>::type
+            > table_t;
+
+        return table_t::table[state_.which()](*this, event);
+    }
+};
+
+} // namespace boost
+
+#endif // BOOST_VARIANT_VARIANT_FSM_HPP
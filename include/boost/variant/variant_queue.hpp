@@ -0,0 +1,446 @@
+//-----------------------------------------------------------------------------
+// boost variant/variant_queue.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_VARIANT_QUEUE_HPP
+#define BOOST_VARIANT_VARIANT_QUEUE_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <atomic>
+#include <cstddef> // for std::size_t
+#include <new> // for placement new
+
+#include <boost/static_assert.hpp>
+#include <boost/core/no_exceptions_support.hpp>
+#include <boost/variant/variant.hpp>
+#include <boost/variant/static_visitor.hpp>
+#include <boost/variant/atomic_variant.hpp> // for atomic_max_size and atomic_max_alignment
+#include <boost/variant/detail/move.hpp>
+
+#include <boost/type_traits/aligned_storage.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+namespace boost {
+
+namespace detail { namespace variant {
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) metafunction queue_type_index
+//
+// Index of T in Types..., or -1 if T is not one of them.
+//
+template <int I, typename T, typename... Types>
+struct queue_type_index_impl
+    : boost::integral_constant<int, -1>
+{
+};
+
+template <int I, typename T, typename First, typename... Rest>
+struct queue_type_index_impl<I, T, First, Rest...>
+    : boost::integral_constant<
+          int
+        , boost::is_same<T, First>::value ? I : queue_type_index_impl<I + 1, T, Rest...>::value
+        >
+{
+};
+
+template <typename T, typename... Types>
+struct queue_type_index
+    : queue_type_index_impl<0, T, Types...>
+{
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class queue_position
+//
+// Keeps a queue position on its own cache line.
+//
+struct alignas(64) queue_position
+{
+    std::atomic<std::size_t> value;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template queue_slot
+//
+// Slot of a variant_queue: the sequence number of the slot state, the which()
+// of the message (-1 if the producer failed to construct it) and the storage
+// of the message.
+//
+template <std::size_t Size, std::size_t Align>
+struct queue_slot
+{
+    std::atomic<std::size_t> sequence;
+    int which;
+    typename boost::aligned_storage<Size, Align>::type storage;
+};
+
+template <typename T>
+struct queue_destroyer
+{
+    T& operand;
+
+    ~queue_destroyer()
+    {
+        operand.~T();
+    }
+};
+
+template <typename Visitor, typename... T>
+struct queue_consume_table
+{
+    typedef void (*consume_t)(void*, Visitor&);
+
+    // Passes the message to the visitor as a non-const lvalue, so it may
+    // be moved from, and destroys it.
+    template <typename U>
+    static void consume(void* storage, Visitor& visitor)
+    {
+        U& operand = *static_cast<U*>(storage);
+        queue_destroyer<U> destroyer = { operand };
+        visitor(operand);
+    }
+
+    static const consume_t table[sizeof...(T)];
+};
+
+template <typename Visitor, typename... T>
+const typename queue_consume_table<Visitor, T...>::consume_t
+    queue_consume_table<Visitor, T...>::table[sizeof...(T)]
+        = { &queue_consume_table::template consume<T>... };
+
+struct queue_discarder
+{
+    template <typename T>
+    void operator()(T&) const BOOST_NOEXCEPT
+    {
+    }
+};
+
+template <typename Queue>
+class queue_pusher
+    : public boost::static_visitor<bool>
+{
+private: // representation
+
+    Queue& queue_;
+
+public: // structors
+
+    explicit queue_pusher(Queue& queue) BOOST_NOEXCEPT
+        : queue_(queue)
+    {
+    }
+
+public: // visitor interface
+
+    template <typename T>
+    bool operator()(const T& operand) const
+    {
+        return queue_.template emplace<T>(operand);
+    }
+
+    template <typename T>
+    bool operator()(T& operand) const
+    {
+        return queue_.template emplace<T>(detail::variant::move(operand));
+    }
+
+private:
+    queue_pusher& operator=(const queue_pusher&);
+};
+
+}} // namespace detail::variant
+
+///////////////////////////////////////////////////////////////////////////////
+// class template variant_queue
+//
+// Bounded lock-free multi-producer multi-consumer queue of messages of the
+// bounded types. Messages are constructed in place in the slots of a ring
+// buffer and passed to the consumer's visitor directly from the slot,
+// dispatched with a single read of the stored which().
+//
+// Based on the bounded MPMC queue of Dmitry Vyukov: each slot has a sequence
+// number telling the producers and the consumers whether it is free or
+// holds a message of the current lap. consume_all claims a batch of ready
+// slots with a single CAS.
+//
+template <typename... T>
+class variant_queue
+{
+public: // typedefs
+
+    typedef boost::variant<T...> value_type;
+    typedef typename value_type::types types;
+
+private: // representation
+
+    typedef detail::variant::queue_slot<
+          detail::variant::atomic_max_size<T...>::value
+        , detail::variant::atomic_max_alignment<T...>::value
+        > slot_t;
+
+    BOOST_STATIC_CONSTANT(std::size_t, max_batch = 32);
+
+    detail::variant::queue_position enqueue_position_;
+    detail::variant::queue_position dequeue_position_;
+    slot_t* const slots_;
+    const std::size_t mask_;
+
+    static std::size_t round_capacity(std::size_t capacity) BOOST_NOEXCEPT
+    {
+        std::size_t result = 2;
+        while (result < capacity)
+            result *= 2;
+        return result;
+    }
+
+    // Returns the slot for the next message, or nullptr if the queue is full.
+    slot_t* claim_for_write(std::size_t& position) BOOST_NOEXCEPT
+    {
+        position = enqueue_position_.value.load(std::memory_order_relaxed);
+        for (;;) {
+            slot_t& slot = slots_[position & mask_];
+            const std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            if (sequence == position) {
+                if (enqueue_position_.value.compare_exchange_weak(
+                        position, position + 1, std::memory_order_relaxed, std::memory_order_relaxed))
+                {
+                    return &slot;
+                }
+            } else if (sequence < position) {
+                return nullptr;
+            } else {
+                position = enqueue_position_.value.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Claims up to `limit` ready slots starting from `position`, returns
+    // their count.
+    std::size_t claim_for_read(std::size_t& position, std::size_t limit) BOOST_NOEXCEPT
+    {
+        position = dequeue_position_.value.load(std::memory_order_relaxed);
+        for (;;) {
+            std::size_t count = 0;
+            while (count != limit
+                && slots_[(position + count) & mask_].sequence.load(std::memory_order_acquire)
+                    == position + count + 1)
+            {
+                ++count;
+            }
+
+            if (count == 0) {
+                const std::size_t sequence = slots_[position & mask_].sequence.load(std::memory_order_acquire);
+                if (sequence < position + 1)
+                    return 0;
+
+                position = dequeue_position_.value.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if (dequeue_position_.value.compare_exchange_weak(
+                    position, position + count, std::memory_order_relaxed, std::memory_order_relaxed))
+            {
+                return count;
+            }
+        }
+    }
+
+    template <typename Visitor>
+    bool consume_one_impl(Visitor& visitor)
+    {
+        // Skips the slots left empty by a throwing construction:
+        std::size_t position;
+        while (claim_for_read(position, 1)) {
+            if (consume_slot(position, visitor))
+                return true;
+        }
+
+        return false;
+    }
+
+    template <typename Visitor>
+    std::size_t consume_all_impl(Visitor& visitor)
+    {
+        std::size_t consumed = 0;
+        std::size_t position;
+        while (const std::size_t count = claim_for_read(position, max_batch)) {
+            std::size_t i = 0;
+            BOOST_TRY {
+                for (; i != count; ++i) {
+                    if (consume_slot(position + i, visitor))
+                        ++consumed;
+                }
+            } BOOST_CATCH (...) {
+                // The rest of the claimed batch can not be returned to the
+                // queue: destroy it.
+                detail::variant::queue_discarder discarder;
+                for (++i; i != count; ++i)
+                    consume_slot(position + i, discarder);
+                BOOST_RETHROW;
+            } BOOST_CATCH_END
+        }
+
+        return consumed;
+    }
+
+    // Returns false if the slot is empty.
+    template <typename Visitor>
+    bool consume_slot(std::size_t position, Visitor& visitor)
+    {
+        typedef detail::variant::queue_consume_table<Visitor, T...> table_t;
+
+        // Frees the slot even if the visitor throws.
+        struct releaser
+        {
+            slot_t& slot;
+            std::size_t next;
+
+            ~releaser()
+            {
+                slot.sequence.store(next, std::memory_order_release);
+            }
+        };
+
+        slot_t& slot = slots_[position & mask_];
+        releaser release = { slot, position + mask_ + 1 };
+        (void)release;
+
+        const int which = slot.which;
+        if (which < 0)
+            return false;
+
+        table_t::table[which](&slot.storage, visitor);
+        return true;
+    }
+
+public: // structors
+
+    // The capacity is rounded up to a power of two.
+    explicit variant_queue(std::size_t capacity)
+        : slots_(new slot_t[round_capacity(capacity)])
+        , mask_(round_capacity(capacity) - 1)
+    {
+        for (std::size_t i = 0; i <= mask_; ++i)
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+
+        enqueue_position_.value.store(0, std::memory_order_relaxed);
+        dequeue_position_.value.store(0, std::memory_order_relaxed);
+    }
+
+    ~variant_queue()
+    {
+        detail::variant::queue_discarder discarder;
+        consume_all_impl(discarder);
+        delete[] slots_;
+    }
+
+private:
+    variant_queue(const variant_queue&);
+    variant_queue& operator=(const variant_queue&);
+
+public: // queries
+
+    std::size_t capacity() const BOOST_NOEXCEPT
+    {
+        return mask_ + 1;
+    }
+
+    // The result may be outdated by the time it is returned.
+    bool empty() const BOOST_NOEXCEPT
+    {
+        const std::size_t position = dequeue_position_.value.load(std::memory_order_relaxed);
+        return slots_[position & mask_].sequence.load(std::memory_order_acquire) != position + 1;
+    }
+
+public: // producers
+
+    // Constructs the message in place. Returns false if the queue is full.
+    template <typename U, typename... Args>
+    bool emplace(Args&&... args)
+    {
+        BOOST_STATIC_ASSERT_MSG(
+            (detail::variant::queue_type_index<U, T...>::value >= 0),
+            "boost::variant_queue::emplace<U>: U must be one of the bounded types"
+        );
+
+        std::size_t position;
+        slot_t* const slot = claim_for_write(position);
+        if (!slot)
+            return false;
+
+        // The slot is already claimed: if the construction throws, the slot
+        // is published as empty and skipped by the consumers.
+        BOOST_TRY {
+            ::new (static_cast<void*>(&slot->storage)) U(static_cast<Args&&>(args)...);
+            slot->which = detail::variant::queue_type_index<U, T...>::value;
+        } BOOST_CATCH (...) {
+            slot->which = -1;
+            slot->sequence.store(position + 1, std::memory_order_release);
+            BOOST_RETHROW;
+        } BOOST_CATCH_END
+
+        slot->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool push(const value_type& message)
+    {
+        detail::variant::queue_pusher<variant_queue> pusher(*this);
+        return message.apply_visitor(pusher);
+    }
+
+    bool push(value_type&& message)
+    {
+        detail::variant::queue_pusher<variant_queue> pusher(*this);
+        return message.apply_visitor(pusher);
+    }
+
+public: // consumers
+
+    // Passes the next message, if any, to visitor(U&) and destroys it.
+    // Returns false if the queue is empty.
+    template <typename Visitor>
+    bool consume_one(Visitor& visitor)
+    {
+        return consume_one_impl(visitor);
+    }
+
+    template <typename Visitor>
+    bool consume_one(const Visitor& visitor)
+    {
+        return consume_one_impl(visitor);
+    }
+
+    // Passes the messages to visitor(U&) in batches until the queue is
+    // empty. Returns the number of consumed messages. If the visitor
+    // throws, the rest of the current batch is destroyed.
+    template <typename Visitor>
+    std::size_t consume_all(Visitor& visitor)
+    {
+        return consume_all_impl(visitor);
+    }
+
+    template <typename Visitor>
+    std::size_t consume_all(const Visitor& visitor)
+    {
+        return consume_all_impl(visitor);
+    }
+};
+
+} // namespace boost
+
+#endif // BOOST_VARIANT_VARIANT_QUEUE_HPP
@@ -0,0 +1,378 @@
+//-----------------------------------------------------------------------------
+// boost variant/variant_ref.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_VARIANT_REF_HPP
+#define BOOST_VARIANT_VARIANT_REF_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::uintptr_t
+
+#include <boost/assert.hpp>
+#include <boost/core/addressof.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/variant/variant.hpp>
+#include <boost/variant/get.hpp>
+#include <boost/variant/static_visitor.hpp>
+#include <boost/variant/detail/type_pack.hpp>
+
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/size_t.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/utility/enable_if.hpp>
+
+namespace boost {
+
+template <typename... T>
+class variant_ref;
+
+namespace detail { namespace variant {
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) metafunctions variant_ref_tag_bits and variant_ref_min_align
+//
+// Number of low bits needed to hold the index of one of N types, and the
+// least alignment of the types T.
+//
+template <std::size_t N>
+struct variant_ref_tag_bits
+    : mpl::size_t<1 + variant_ref_tag_bits<(N + 1) / 2>::value>
+{
+};
+
+template <>
+struct variant_ref_tag_bits<1>
+    : mpl::size_t<0>
+{
+};
+
+template <typename... T>
+struct variant_ref_min_align;
+
+template <typename T0>
+struct variant_ref_min_align<T0>
+    : mpl::size_t<alignment_of<T0>::value>
+{
+};
+
+template <typename T0, typename T1, typename... T>
+struct variant_ref_min_align<T0, T1, T...>
+    : mpl::size_t<
+          (alignment_of<T0>::value < variant_ref_min_align<T1, T...>::value)
+            ? alignment_of<T0>::value
+            : variant_ref_min_align<T1, T...>::value
+      >
+{
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template variant_ref_storage
+//
+// Address and index of the referenced object. If the alignment of every
+// type leaves the low bits of the address zero, the index is packed into
+// them and the storage is one word, else the index is a second word.
+//
+template <std::size_t TagBits, bool Packed>
+class variant_ref_storage;
+
+template <std::size_t TagBits>
+class variant_ref_storage<TagBits, true>
+{
+private: // representation
+
+    static const std::uintptr_t tag_mask = (static_cast<std::uintptr_t>(1) << TagBits) - 1;
+
+    std::uintptr_t bits_;
+
+public: // structors
+
+    variant_ref_storage(void* address, int which) BOOST_NOEXCEPT
+        : bits_(reinterpret_cast<std::uintptr_t>(address) | static_cast<std::uintptr_t>(which))
+    {
+        BOOST_ASSERT((reinterpret_cast<std::uintptr_t>(address) & tag_mask) == 0);
+    }
+
+public: // queries
+
+    void* address() const BOOST_NOEXCEPT
+    {
+        return reinterpret_cast<void*>(bits_ & ~tag_mask);
+    }
+
+    int which() const BOOST_NOEXCEPT
+    {
+        return static_cast<int>(bits_ & tag_mask);
+    }
+};
+
+template <std::size_t TagBits>
+class variant_ref_storage<TagBits, false>
+{
+private: // representation
+
+    void* address_;
+    int which_;
+
+public: // structors
+
+    variant_ref_storage(void* address, int which) BOOST_NOEXCEPT
+        : address_(address)
+        , which_(which)
+    {
+    }
+
+public: // queries
+
+    void* address() const BOOST_NOEXCEPT
+    {
+        return address_;
+    }
+
+    int which() const BOOST_NOEXCEPT
+    {
+        return which_;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) metafunction classes variant_ref_binds and variant_ref_yields
+//
+// Whether a reference to T binds to an object of type U without conversion
+// (T is U, maybe more cv-qualified), and whether a reference to U binds to
+// an object of type T (for get).
+//
+template <typename U>
+struct variant_ref_binds
+{
+    template <typename T>
+    struct apply
+        : mpl::bool_<
+              is_same<typename remove_cv<T>::type, typename remove_cv<U>::type>::value
+           && is_convertible<U*, T*>::value
+          >
+    {
+    };
+};
+
+template <typename U>
+struct variant_ref_yields
+{
+    template <typename T>
+    struct apply
+        : variant_ref_binds<T>::template apply<U>
+    {
+    };
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template variant_ref_dispatch
+//
+// Table of the functions applying Visitor to each of the types T.
+//
+template <typename Visitor, typename... T>
+struct variant_ref_dispatch
+{
+    typedef typename Visitor::result_type result_type;
+    typedef result_type (*invoke_t)(Visitor&, void*);
+
+    template <typename U>
+    static result_type invoke(Visitor& visitor, void* address)
+    {
+        return visitor(*static_cast<U*>(address));
+    }
+
+    static const invoke_t table[sizeof...(T)];
+};
+
+template <typename Visitor, typename... T>
+const typename variant_ref_dispatch<Visitor, T...>::invoke_t
+    variant_ref_dispatch<Visitor, T...>::table[sizeof...(T)]
+        = { &variant_ref_dispatch::template invoke<T>... };
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class template variant_ref_maker
+//
+// Visitor that makes a variant_ref to the content of a variant.
+//
+template <typename Ref>
+struct variant_ref_maker
+    : public boost::static_visitor<Ref>
+{
+    template <typename U>
+    Ref operator()(U& operand) const BOOST_NOEXCEPT
+    {
+        return Ref(operand);
+    }
+};
+
+}} // namespace detail::variant
+
+///////////////////////////////////////////////////////////////////////////////
+// class template variant_ref
+//
+// Non-owning reference to an object of one of the types T, as
+// variant<T&...>, in one word when the alignment of the types leaves
+// enough low bits of the address for the index (e.g., up to four types
+// aligned to four bytes, or eight aligned to eight), else in two words.
+//
+// Trivially copyable, and like a reference, never empty (it has no
+// default constructor), and rebound only by assignment of another
+// variant_ref. The types T must be complete, and may be const-qualified.
+//
+template <typename... T>
+class variant_ref
+{
+    BOOST_STATIC_ASSERT_MSG(sizeof...(T) > 0, "boost::variant_ref requires at least one type");
+
+public: // typedefs
+
+    typedef detail::variant::type_pack<T&...> types;
+
+private: // representation
+
+    typedef detail::variant::variant_ref_tag_bits<sizeof...(T)> tag_bits;
+    typedef detail::variant::variant_ref_min_align<T...> min_align;
+
+    detail::variant::variant_ref_storage<
+          tag_bits::value
+        , ((static_cast<std::size_t>(1) << tag_bits::value) <= min_align::value)
+        > storage_;
+
+    template <typename U>
+    struct index_of
+        : detail::variant::type_pack_find_if<
+              detail::variant::type_pack<T...>
+            , detail::variant::variant_ref_binds<U>
+            >
+    {
+    };
+
+public: // structors
+
+    template <typename U>
+    variant_ref(
+          U& operand
+        , typename enable_if_c<index_of<U>::value != -1, bool>::type = true
+        ) BOOST_NOEXCEPT
+        : storage_(
+              const_cast<void*>(static_cast<const volatile void*>(boost::addressof(operand)))
+            , index_of<U>::value
+            )
+    {
+    }
+
+    // The content of the variant must be one of the types T.
+
+    template <typename... U>
+    variant_ref(
+          boost::variant<U...>& operand
+        , typename enable_if_c<index_of< boost::variant<U...> >::value == -1, bool>::type = true
+        ) BOOST_NOEXCEPT
+        : storage_(make(operand).storage_)
+    {
+    }
+
+    template <typename... U>
+    variant_ref(
+          const boost::variant<U...>& operand
+        , typename enable_if_c<index_of< const boost::variant<U...> >::value == -1, bool>::type = true
+        ) BOOST_NOEXCEPT
+        : storage_(make(operand).storage_)
+    {
+    }
+
+private: // helpers, for structors (above)
+
+    template <typename Variant>
+    static variant_ref make(Variant& operand) BOOST_NOEXCEPT
+    {
+        detail::variant::variant_ref_maker<variant_ref> maker;
+        return operand.apply_visitor(maker);
+    }
+
+public: // queries
+
+    int which() const BOOST_NOEXCEPT
+    {
+        return storage_.which();
+    }
+
+    // Address of the referenced object.
+    void* address() const BOOST_NOEXCEPT
+    {
+        return storage_.address();
+    }
+
+public: // visitation
+
+    template <typename Visitor>
+    typename Visitor::result_type apply_visitor(Visitor& visitor) const
+    {
+        return detail::variant::variant_ref_dispatch<Visitor, T...>::table[which()](
+              visitor, address()
+            );
+    }
+
+    template <typename Visitor>
+    typename Visitor::result_type apply_visitor(const Visitor& visitor) const
+    {
+        return detail::variant::variant_ref_dispatch<const Visitor, T...>::table[which()](
+              visitor, address()
+            );
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////
+// function template get<U>
+//
+// Retrieves the object referred to by a variant_ref if it is of type U.
+// Otherwise: pointer ver. returns 0; reference ver. throws bad_get.
+//
+template <typename U, typename... T>
+inline U* get(const variant_ref<T...>* operand) BOOST_NOEXCEPT
+{
+    typedef detail::variant::type_pack_find_if<
+          detail::variant::type_pack<T...>
+        , detail::variant::variant_ref_yields<U>
+        > index;
+
+    BOOST_STATIC_ASSERT_MSG(
+          index::value != -1
+        , "boost::variant_ref does not refer to objects of the specified type,"
+          " call to boost::get<U>(boost::variant_ref<T...>) will always fail"
+        );
+
+    if (!operand || operand->which() != index::value)
+        return 0;
+    return static_cast<U*>(operand->address());
+}
+
+template <typename U, typename... T>
+inline U& get(const variant_ref<T...>& operand)
+{
+    U* result = boost::get<U>(boost::addressof(operand));
+
+    if (!result)
+        boost::throw_exception(bad_get());
+    return *result;
+}
+
+} // namespace boost
+
+#endif // BOOST_VARIANT_VARIANT_REF_HPP
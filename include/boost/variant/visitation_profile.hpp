@@ -0,0 +1,362 @@
+//-----------------------------------------------------------------------------
+// boost variant/visitation_profile.hpp header file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_VARIANT_VISITATION_PROFILE_HPP
+#define BOOST_VARIANT_VISITATION_PROFILE_HPP
+
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_PRAGMA_ONCE
+# pragma once
+#endif
+
+#include <boost/variant/apply_visitor.hpp>
+#include <boost/variant/likely_alternatives.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Profile-guided visitation of boost::variant
+//
+// BOOST_VARIANT_PROFILED_APPLY_VISITOR(visitor, operand) is
+// boost::apply_visitor(visitor, operand). When BOOST_VARIANT_PROFILE is
+// #defined it also records the histogram of operand.which() of the call
+// site. At exit the histograms are written to BOOST_VARIANT_PROFILE_OUTPUT
+// (boost_variant_profile.hpp by default, nothing if it is empty) as a header
+// specializing variant_likely_alternatives for each profiled variant type
+// with its alternatives that hold at least BOOST_VARIANT_PROFILE_THRESHOLD
+// percent (25 by default) of the visited values. Including that header in
+// the build without BOOST_VARIANT_PROFILE feeds the profile back into the
+// visitation of those variant types.
+//
+// The generated header spells the types as printed by Boost.TypeIndex, so
+// the profiled variants must consist of types with names reachable from the
+// global namespace.
+//
+
+#if !defined(BOOST_VARIANT_PROFILE)
+
+#define BOOST_VARIANT_PROFILED_APPLY_VISITOR(visitor, operand) \
+    ::boost::apply_visitor(visitor, operand)
+
+#else // defined(BOOST_VARIANT_PROFILE)
+
+#include <algorithm> // for std::sort
+#include <atomic>
+#include <cstddef> // for std::size_t
+#include <cstdlib> // for std::atexit
+#include <fstream>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility> // for std::forward, std::pair
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/type_index.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+#include <boost/variant/detail/index_sequence.hpp>
+
+#if !defined(BOOST_VARIANT_PROFILE_OUTPUT)
+#   define BOOST_VARIANT_PROFILE_OUTPUT "boost_variant_profile.hpp"
+#endif
+
+#if !defined(BOOST_VARIANT_PROFILE_THRESHOLD)
+#   define BOOST_VARIANT_PROFILE_THRESHOLD 25
+#endif
+
+namespace boost {
+
+namespace detail { namespace variant {
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class profile_site
+//
+// Histogram of which() of one call site.
+//
+struct profile_site
+{
+    const char* file;
+    int line;
+    std::string variant_name;
+    std::vector<std::string> alternative_names;
+    std::atomic<boost::uint64_t>* counts;
+    profile_site* next;
+
+    profile_site(const char* f, int l, const std::string& name, const std::vector<std::string>& alternatives)
+        : file(f)
+        , line(l)
+        , variant_name(name)
+        , alternative_names(alternatives)
+        , counts(new std::atomic<boost::uint64_t>[alternatives.size()]())
+        , next(nullptr)
+    {
+    }
+
+    void count(int which) BOOST_NOEXCEPT
+    {
+        counts[which].fetch_add(1, std::memory_order_relaxed);
+    }
+};
+
+// Static slot of a call site of BOOST_VARIANT_PROFILED_APPLY_VISITOR.
+struct profile_slot
+{
+    std::atomic<profile_site*> site;
+    const char* file;
+    int line;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class profile_registry
+//
+// All the profiled call sites of the program. The sites are never freed.
+//
+class profile_registry
+{
+private: // representation
+
+    std::mutex mutex_;
+    profile_site* head_;
+
+    profile_registry()
+        : head_(nullptr)
+    {
+        std::atexit(&profile_registry::write_at_exit);
+    }
+
+    profile_registry(const profile_registry&);
+    profile_registry& operator=(const profile_registry&);
+
+    static void write_at_exit();
+
+public: // queries and modifiers
+
+    // Never destroyed, so that it is still usable by the handlers called at
+    // exit.
+    static profile_registry& instance()
+    {
+        static profile_registry* const registry = new profile_registry();
+        return *registry;
+    }
+
+    profile_site& site(profile_slot& slot, const std::string& name, const std::vector<std::string>& alternatives)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        profile_site* site = slot.site.load(std::memory_order_relaxed);
+        if (!site) {
+            site = new profile_site(slot.file, slot.line, name, alternatives);
+            site->next = head_;
+            head_ = site;
+            slot.site.store(site, std::memory_order_release);
+        }
+
+        return *site;
+    }
+
+    // Calls f(const profile_site&, const std::vector<boost::uint64_t>& counts)
+    // for the sites in the order of first use.
+    template <typename F>
+    void for_each_site(F& f)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        std::vector<const profile_site*> sites;
+        for (const profile_site* site = head_; site; site = site->next)
+            sites.push_back(site);
+
+        for (std::size_t i = sites.size(); i-- > 0;) {
+            std::vector<boost::uint64_t> counts(sites[i]->alternative_names.size());
+            for (std::size_t w = 0; w != counts.size(); ++w)
+                counts[w] = sites[i]->counts[w].load(std::memory_order_relaxed);
+            f(*sites[i], counts);
+        }
+    }
+};
+
+template <typename Variant, std::size_t... I>
+inline std::vector<std::string> profile_alternative_names(index_sequence<I...>)
+{
+    const std::string names[] = {
+        boost::typeindex::type_id<typename variant_alternative<Variant, static_cast<int>(I)>::type>().pretty_name()...
+    };
+    return std::vector<std::string>(names, names + sizeof...(I));
+}
+
+template <typename Variant>
+inline profile_site& profile_site_of(profile_slot& slot)
+{
+    profile_site* const site = slot.site.load(std::memory_order_acquire);
+    if (BOOST_LIKELY(site != nullptr))
+        return *site;
+
+    return profile_registry::instance().site(
+          slot
+        , boost::typeindex::type_id<Variant>().pretty_name()
+        , profile_alternative_names<Variant>(
+              typename make_index_sequence<variant_size<Variant>::value>::type()
+          )
+        );
+}
+
+template <typename Visitor, typename Visitable>
+inline auto profiled_apply_visitor(profile_slot& slot, Visitor&& visitor, Visitable&& visitable)
+    -> decltype(::boost::apply_visitor(std::forward<Visitor>(visitor), std::forward<Visitable>(visitable)))
+{
+    typedef typename boost::remove_cv<
+        typename boost::remove_reference<Visitable>::type
+    >::type variant_t;
+
+    profile_site_of<variant_t>(slot).count(visitable.which());
+    return ::boost::apply_visitor(std::forward<Visitor>(visitor), std::forward<Visitable>(visitable));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// (detail) class profile_writer
+//
+// Sums the histograms of the call sites per variant type and writes them
+// out as the variant_likely_alternatives specializations.
+//
+class profile_writer
+{
+private: // representation
+
+    struct variant_profile
+    {
+        std::string name;
+        std::vector<std::string> alternative_names;
+        std::vector<boost::uint64_t> counts;
+    };
+
+    std::ostream& out_;
+    std::vector<variant_profile> variants_;
+
+    static bool by_count(const std::pair<boost::uint64_t, std::size_t>& lhs, const std::pair<boost::uint64_t, std::size_t>& rhs)
+    {
+        return lhs.first > rhs.first || (lhs.first == rhs.first && lhs.second < rhs.second);
+    }
+
+public: // structors
+
+    explicit profile_writer(std::ostream& out)
+        : out_(out)
+    {
+        out_ << "// Generated by boost/variant/visitation_profile.hpp\n"
+                "//\n"
+                "// Histograms of which() per call site:\n";
+    }
+
+private:
+    profile_writer& operator=(const profile_writer&);
+
+public: // modifiers
+
+    void operator()(const profile_site& site, const std::vector<boost::uint64_t>& counts)
+    {
+        out_ << "//\n// " << site.file << ':' << site.line << ": " << site.variant_name << '\n';
+        for (std::size_t w = 0; w != counts.size(); ++w)
+            out_ << "//   " << counts[w] << ' ' << site.alternative_names[w] << '\n';
+
+        std::size_t index = 0;
+        while (index != variants_.size() && variants_[index].name != site.variant_name)
+            ++index;
+
+        if (index == variants_.size()) {
+            variant_profile profile;
+            profile.name = site.variant_name;
+            profile.alternative_names = site.alternative_names;
+            profile.counts.resize(counts.size());
+            variants_.push_back(profile);
+        }
+
+        for (std::size_t w = 0; w != counts.size(); ++w)
+            variants_[index].counts[w] += counts[w];
+    }
+
+    void finish()
+    {
+        out_ << "\n#ifndef BOOST_VARIANT_GENERATED_PROFILE_HPP\n"
+                "#define BOOST_VARIANT_GENERATED_PROFILE_HPP\n\n"
+                "#include <boost/variant/likely_alternatives.hpp>\n\n"
+                "namespace boost {\n";
+
+        for (std::size_t i = 0; i != variants_.size(); ++i) {
+            const variant_profile& profile = variants_[i];
+
+            boost::uint64_t total = 0;
+            std::vector<std::pair<boost::uint64_t, std::size_t> > order;
+            for (std::size_t w = 0; w != profile.counts.size(); ++w) {
+                total += profile.counts[w];
+                order.push_back(std::make_pair(profile.counts[w], w));
+            }
+            std::sort(order.begin(), order.end(), &profile_writer::by_count);
+
+            std::string likely;
+            for (std::size_t k = 0; k != order.size(); ++k) {
+                if (order[k].first == 0 || order[k].first * 100 < total * BOOST_VARIANT_PROFILE_THRESHOLD)
+                    break;
+                likely += ", " + profile.alternative_names[order[k].second];
+            }
+
+            if (likely.empty())
+                continue;
+
+            out_ << "\ntemplate <>\n"
+                    "struct variant_likely_alternatives< " << profile.name << " >\n"
+                    "    : likely_alternatives< " << profile.name << likely << " >\n"
+                    "{\n"
+                    "};\n";
+        }
+
+        out_ << "\n} // namespace boost\n\n"
+                "#endif // BOOST_VARIANT_GENERATED_PROFILE_HPP\n";
+        out_.flush();
+    }
+};
+
+}} // namespace detail::variant
+
+///////////////////////////////////////////////////////////////////////////////
+// function write_variant_profile
+//
+// Writes the histograms recorded so far and the variant_likely_alternatives
+// specializations derived from them.
+//
+inline void write_variant_profile(std::ostream& out)
+{
+    detail::variant::profile_writer writer(out);
+    detail::variant::profile_registry::instance().for_each_site(writer);
+    writer.finish();
+}
+
+inline void detail::variant::profile_registry::write_at_exit()
+{
+    const char* const path = BOOST_VARIANT_PROFILE_OUTPUT;
+    if (!*path)
+        return;
+
+    std::ofstream out(path);
+    write_variant_profile(out);
+}
+
+} // namespace boost
+
+#define BOOST_VARIANT_PROFILED_APPLY_VISITOR(visitor, operand)                      \
+    ::boost::detail::variant::profiled_apply_visitor(                               \
+          []() -> ::boost::detail::variant::profile_slot& {                         \
+              static ::boost::detail::variant::profile_slot slot                    \
+                  = { {nullptr}, __FILE__, __LINE__ };                              \
+              return slot;                                                          \
+          }()                                                                       \
+        , visitor, operand)
+
+#endif // defined(BOOST_VARIANT_PROFILE)
+
+#endif // BOOST_VARIANT_VISITATION_PROFILE_HPP
@@ -0,0 +1,133 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Testing contended access to a shared state: boost::atomic_variant versus
+// boost::variant protected by a mutex
+//
+
+#define BOOST_ERROR_CODE_HEADER_ONLY
+#define BOOST_CHRONO_HEADER_ONLY
+#include <boost/chrono.hpp>
+
+#include <boost/variant.hpp>
+#include <boost/variant/atomic_variant.hpp>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+    struct scope {
+        typedef boost::chrono::steady_clock test_clock;
+        typedef boost::chrono::duration<double> duration_t;
+        test_clock::time_point start_;
+        const char* const message_;
+        const unsigned threads_;
+        const std::size_t operations_;
+
+        scope(const char* const message, unsigned threads, std::size_t operations)
+            : start_(test_clock::now())
+            , message_(message)
+            , threads_(threads)
+            , operations_(operations)
+        {}
+
+        ~scope() {
+            const double seconds = boost::chrono::duration_cast<duration_t>(test_clock::now() - start_).count();
+            std::cout << message_ << " threads " << threads_ << "   "
+                      << (operations_ / seconds / 1e6) << " Mops/s" << std::endl;
+        }
+    };
+
+struct idle {};
+struct running { int id; };
+struct failed { long long code; };
+
+struct reader : boost::static_visitor<long long> {
+    long long operator()(idle) const { return 0; }
+    long long operator()(running r) const { return r.id; }
+    long long operator()(int v) const { return v; }
+    long long operator()(failed f) const { return f.code; }
+};
+
+BOOST_STATIC_CONSTANT(std::size_t, c_operations_per_thread = 2000000);
+
+// Every 8th operation is a read-modify-write, others are reads
+template <class State, class Worker>
+static void run(const char* name, unsigned threads_count, Worker worker) {
+    State state;
+    scope sc(name, threads_count, threads_count * c_operations_per_thread);
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < threads_count; ++t) {
+        threads.push_back(std::thread(worker, std::ref(state)));
+    }
+    for (unsigned t = 0; t < threads_count; ++t) {
+        threads[t].join();
+    }
+}
+
+template <class Variant>
+struct locked_state {
+    std::mutex mutex;
+    Variant value;
+};
+
+template <class Variant>
+static void locked_worker(locked_state<Variant>& state) {
+    long long sum = 0;
+    for (std::size_t i = 0; i < c_operations_per_thread; ++i) {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (i % 8 == 0) {
+            running r = { static_cast<int>(boost::apply_visitor(reader(), state.value)) + 1 };
+            state.value = r;
+        } else {
+            sum += boost::apply_visitor(reader(), state.value);
+        }
+    }
+    volatile long long sink = sum;
+    (void)sink;
+}
+
+template <class Atomic>
+static void atomic_worker(Atomic& state) {
+    typedef typename Atomic::value_type value_t;
+
+    long long sum = 0;
+    for (std::size_t i = 0; i < c_operations_per_thread; ++i) {
+        if (i % 8 == 0) {
+            value_t expected = state.load(std::memory_order_relaxed);
+            running r;
+            do {
+                r.id = static_cast<int>(boost::apply_visitor(reader(), expected)) + 1;
+            } while (!state.compare_exchange_weak(expected, value_t(r)));
+        } else {
+            sum += state.apply_visitor(reader(), std::memory_order_acquire);
+        }
+    }
+    volatile long long sink = sum;
+    (void)sink;
+}
+
+int main () {
+    typedef boost::variant<idle, running, int> narrow_t;
+    typedef boost::variant<idle, running, failed> wide_t;
+    typedef boost::atomic_variant<idle, running, int> atomic_narrow_t;
+    typedef boost::atomic_variant<idle, running, failed> atomic_wide_t;
+
+    std::cout << "8 byte atomic_variant is lock-free: " << atomic_narrow_t().is_lock_free() << '\n'
+              << "16 byte atomic_variant is lock-free: " << atomic_wide_t().is_lock_free() << std::endl;
+
+    unsigned max_threads = std::thread::hardware_concurrency();
+    if (max_threads < 2) {
+        max_threads = 2;
+    }
+
+    for (unsigned threads = 1; threads <= max_threads && threads <= 64; threads *= 2) {
+        run<locked_state<narrow_t> >("mutex + variant (8 byte payload)", threads, &locked_worker<narrow_t>);
+        run<atomic_narrow_t>("atomic_variant (8 byte word)", threads, &atomic_worker<atomic_narrow_t>);
+        run<locked_state<wide_t> >("mutex + variant (16 byte payload)", threads, &locked_worker<wide_t>);
+        run<atomic_wide_t>("atomic_variant (16 byte word)", threads, &atomic_worker<atomic_wide_t>);
+    }
+}
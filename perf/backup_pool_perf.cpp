@@ -0,0 +1,128 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Testing scaling of cross type assignments that back up the content on
+// the heap: built with BOOST_VARIANT_BACKUP_POOL (per thread free lists)
+// and without it (operator new)
+//
+
+#define BOOST_ERROR_CODE_HEADER_ONLY
+#define BOOST_CHRONO_HEADER_ONLY
+#include <boost/chrono.hpp>
+
+#include <boost/variant.hpp>
+#include <boost/variant/backup_pool.hpp>
+#include <atomic>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#if defined(BOOST_VARIANT_BACKUP_POOL)
+static const char* const c_name = "backup pool ";
+#else
+static const char* const c_name = "operator new";
+#endif
+
+    struct scope {
+        typedef boost::chrono::steady_clock test_clock;
+        typedef boost::chrono::duration<double> duration_t;
+        test_clock::time_point start_;
+        const unsigned threads_;
+        const std::size_t operations_;
+
+        scope(unsigned threads, std::size_t operations)
+            : start_(test_clock::now())
+            , threads_(threads)
+            , operations_(operations)
+        {}
+
+        ~scope() {
+            const double seconds = boost::chrono::duration_cast<duration_t>(test_clock::now() - start_).count();
+            std::cout << c_name << " threads " << threads_ << "   "
+                      << (operations_ / seconds / 1e6) << " Massignments/s" << std::endl;
+        }
+    };
+
+// Copy constructors that may throw (and do not allocate), no move
+// constructors and no nothrow default constructible bounded type: each
+// cross type assignment backs up the content on the heap. (If the copies
+// could not throw, the compiler could elide the backup altogether.)
+static void validate(bool valid) {
+    if (!valid)
+        throw std::invalid_argument("invalid message");
+}
+
+struct quote {
+    char symbol[16];
+    double bid, ask;
+
+    explicit quote(double price) : bid(price), ask(price) { std::memset(symbol, 'q', sizeof(symbol)); }
+    quote(const quote& other) : bid(other.bid), ask(other.ask) { validate(bid <= ask); std::memcpy(symbol, other.symbol, sizeof(symbol)); }
+    quote& operator=(const quote& other) { std::memcpy(this, &other, sizeof(quote)); return *this; }
+};
+
+struct trade {
+    char symbol[16];
+    double price;
+    long quantity;
+
+    explicit trade(long q) : price(1.0), quantity(q) { std::memset(symbol, 't', sizeof(symbol)); }
+    trade(const trade& other) : price(other.price), quantity(other.quantity) { validate(quantity > 0); std::memcpy(symbol, other.symbol, sizeof(symbol)); }
+    trade& operator=(const trade& other) { std::memcpy(this, &other, sizeof(trade)); return *this; }
+};
+
+struct cancel {
+    char reason[48];
+
+    cancel() { std::memset(reason, 'c', sizeof(reason)); }
+    cancel(const cancel& other) { validate(other.reason[0] != 0); std::memcpy(reason, other.reason, sizeof(reason)); }
+    cancel& operator=(const cancel& other) { std::memcpy(this, &other, sizeof(cancel)); return *this; }
+};
+
+typedef boost::variant<quote, trade, cancel> message_t;
+
+BOOST_STATIC_CONSTANT(std::size_t, c_assignments_per_thread = 1000000);
+
+static void run(unsigned threads_count) {
+    std::atomic<boost::uint64_t> hits(0);
+    std::atomic<boost::uint64_t> misses(0);
+
+    {
+        scope sc(threads_count, threads_count * c_assignments_per_thread);
+        std::vector<std::thread> threads;
+        for (unsigned t = 0; t < threads_count; ++t) {
+            threads.push_back(std::thread([&hits, &misses]() {
+                const message_t messages[3] = { quote(1.5), trade(100), cancel() };
+                message_t current = messages[0];
+                for (std::size_t i = 0; i < c_assignments_per_thread; ++i) {
+                    current = messages[(i + 1) % 3];
+                }
+                volatile int sink = current.which();
+                (void)sink;
+
+                const boost::variant_backup_pool_stats stats = boost::variant_backup_pool_snapshot();
+                hits += stats.hits;
+                misses += stats.misses;
+            }));
+        }
+        for (unsigned t = 0; t < threads_count; ++t) {
+            threads[t].join();
+        }
+    }
+
+#if defined(BOOST_VARIANT_BACKUP_POOL)
+    std::cout << "    pool hits " << hits << ", misses " << misses << std::endl;
+#endif
+}
+
+int main () {
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    for (unsigned threads = 1; threads <= 32; threads *= 2) {
+        run(threads);
+    }
+}
@@ -0,0 +1,115 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Testing text formatting and parsing of variants: std::ostream versus
+// boost::format_to and boost::parse_variant
+//
+
+#define BOOST_ERROR_CODE_HEADER_ONLY
+#define BOOST_CHRONO_HEADER_ONLY
+#include <boost/chrono.hpp>
+
+#include <boost/variant.hpp>
+#include <boost/variant/charconv.hpp>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+    struct scope {
+        typedef boost::chrono::steady_clock test_clock;
+        typedef boost::chrono::milliseconds duration_t;
+        test_clock::time_point start_;
+        const char* const message_;
+
+        explicit scope(const char* const message)
+            : start_(test_clock::now())
+            , message_(message)
+        {}
+
+        ~scope() {
+            std::cout << message_ << "   " << boost::chrono::duration_cast<duration_t>(test_clock::now() - start_) << std::endl;
+        }
+    };
+
+typedef boost::variant<int, double, std::string> var_t;
+
+int main () {
+    BOOST_STATIC_CONSTANT(std::size_t, c_elements_count = 2000000);
+
+    std::vector<var_t> data;
+    data.reserve(c_elements_count);
+    for (std::size_t i = 0; i < c_elements_count; ++i) {
+        switch (i % 3) {
+        case 0: data.push_back(static_cast<int>(i * 7919)); break;
+        case 1: data.push_back(i / 7.0); break;
+        default: data.push_back(std::string("field")); break;
+        }
+    }
+
+    std::size_t total = 0;
+    {
+        scope sc("std::ostream operator<< formatting");
+        std::ostringstream os;
+        os.precision(17);
+        for (std::size_t i = 0; i < data.size(); ++i) {
+            os << data[i] << ',';
+        }
+        total += os.str().size();
+    }
+
+    std::string text;
+    std::vector<std::size_t> ends;
+    ends.reserve(c_elements_count);
+    {
+        scope sc("boost::format_to formatting");
+        char buffer[64];
+        for (std::size_t i = 0; i < data.size(); ++i) {
+            const char* end = boost::format_to(buffer, data[i]);
+            text.append(static_cast<const char*>(buffer), end);
+            ends.push_back(text.size());
+        }
+        total += text.size();
+    }
+
+    std::size_t ints = 0;
+    {
+        scope sc("std::istream parsing of int, then double, then string");
+        std::size_t begin = 0;
+        for (std::size_t i = 0; i < ends.size(); ++i) {
+            const std::string field(text, begin, ends[i] - begin);
+            begin = ends[i];
+
+            std::istringstream is(field);
+            int n;
+            double d;
+            if ((is >> n) && is.eof()) {
+                ints += (var_t(n).which() == 0);
+            } else if ((is.clear(), is.seekg(0), is >> d) && is.eof()) {
+                total += var_t(d).which();
+            } else {
+                total += var_t(field).which();
+            }
+        }
+    }
+
+    {
+        scope sc("boost::parse_variant parsing");
+        std::size_t begin = 0;
+        var_t v;
+        for (std::size_t i = 0; i < ends.size(); ++i) {
+            boost::parse_variant(text.data() + begin, text.data() + ends[i], v);
+            begin = ends[i];
+            ints -= (v.which() == 0);
+        }
+    }
+
+    if (ints != 0) {
+        std::cout << "Results mismatch" << std::endl;
+        return 1;
+    }
+    return total ? 0 : 1;
+}
@@ -0,0 +1,116 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Testing throughput of variant binary encoding/decoding
+//
+
+#define BOOST_ERROR_CODE_HEADER_ONLY
+#define BOOST_CHRONO_HEADER_ONLY
+#include <boost/chrono.hpp>
+
+#include <boost/variant/binary_codec.hpp>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+    struct scope {
+        typedef boost::chrono::steady_clock test_clock;
+        typedef boost::chrono::duration<double> duration_t;
+        test_clock::time_point start_;
+        const char* const message_;
+        const std::size_t bytes_;
+
+        scope(const char* const message, std::size_t bytes)
+            : start_(test_clock::now())
+            , message_(message)
+            , bytes_(bytes)
+        {}
+
+        ~scope() {
+            const double seconds = boost::chrono::duration_cast<duration_t>(test_clock::now() - start_).count();
+            std::cout << message_ << "   " << (bytes_ / seconds / 1e9) << " GB/s" << std::endl;
+        }
+    };
+
+template <class Variant>
+static void do_test(const char* name, const std::vector<Variant>& data) {
+    BOOST_STATIC_CONSTANT(std::size_t, c_run_count = 20);
+    BOOST_STATIC_CONSTANT(std::size_t, c_buffer_size = 64 * 1024);
+
+    std::vector<unsigned char> stream;
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        stream.resize(stream.size() + boost::encoded_variant_size(data[i]));
+    }
+    const std::size_t bytes = stream.size() * c_run_count;
+
+    std::cout << "#############################################\n";
+    std::cout << name << ": " << data.size() << " variants, " << stream.size() << " bytes\n";
+
+    {
+        scope sc("encode_variants into 64KiB buffers", bytes);
+        std::vector<unsigned char> buffer(c_buffer_size);
+        for (std::size_t run = 0; run < c_run_count; ++run) {
+            typename std::vector<Variant>::const_iterator it = data.begin();
+            std::size_t offset = 0;
+            while (it != data.end()) {
+                std::size_t written = 0;
+                it = boost::encode_variants(it, data.end(), &buffer[0], buffer.size(), written);
+                std::memcpy(&stream[offset], &buffer[0], written);
+                offset += written;
+            }
+        }
+    }
+
+    std::vector<Variant> decoded(data.size());
+    {
+        scope sc("decode_variants from contiguous buffer", bytes);
+        for (std::size_t run = 0; run < c_run_count; ++run) {
+            std::size_t consumed = 0;
+            boost::decode_variants(decoded.begin(), decoded.end(), &stream[0], stream.size(), consumed);
+        }
+    }
+
+    {
+        scope sc("encode_variant one by one", bytes);
+        for (std::size_t run = 0; run < c_run_count; ++run) {
+            std::size_t offset = 0;
+            for (std::size_t i = 0; i < data.size(); ++i) {
+                offset += boost::encode_variant(data[i], &stream[offset], stream.size() - offset);
+            }
+        }
+    }
+
+    if (decoded != data) {
+        std::cout << "ERROR: decoded data differs\n";
+    }
+}
+
+int main () {
+    BOOST_STATIC_CONSTANT(std::size_t, c_elements_count = 1000000);
+
+    typedef boost::variant<int, double, long long> scalar_t;
+    std::vector<scalar_t> scalars;
+    for (std::size_t i = 0; i < c_elements_count; ++i) {
+        switch (i % 3) {
+        case 0: scalars.push_back(static_cast<int>(i)); break;
+        case 1: scalars.push_back(i / 3.0); break;
+        default: scalars.push_back(static_cast<long long>(i) << 20); break;
+        }
+    }
+    do_test("variant<int, double, long long>", scalars);
+
+    typedef boost::variant<int, std::string, std::vector<double> > mixed_t;
+    std::vector<mixed_t> mixed;
+    for (std::size_t i = 0; i < c_elements_count; ++i) {
+        switch (i % 3) {
+        case 0: mixed.push_back(static_cast<int>(i)); break;
+        case 1: mixed.push_back(std::string(i % 40, 'a')); break;
+        default: mixed.push_back(std::vector<double>(i % 16, 1.0)); break;
+        }
+    }
+    do_test("variant<int, std::string, std::vector<double> >", mixed);
+}
@@ -0,0 +1,165 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Testing the time to get a scan over stored variants: decoding of the
+// binary representation versus visiting the columnar format in place
+//
+
+#define BOOST_ERROR_CODE_HEADER_ONLY
+#define BOOST_CHRONO_HEADER_ONLY
+#include <boost/chrono.hpp>
+
+#include <boost/variant/apply_visitor.hpp>
+#include <boost/variant/binary_codec.hpp>
+#include <boost/variant/columnar.hpp>
+#include <boost/variant/static_visitor.hpp>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+    struct scope {
+        typedef boost::chrono::steady_clock test_clock;
+        typedef boost::chrono::milliseconds duration_t;
+        test_clock::time_point start_;
+        const char* const message_;
+
+        explicit scope(const char* const message)
+            : start_(test_clock::now())
+            , message_(message)
+        {}
+
+        ~scope() {
+            std::cout << message_ << "   " << boost::chrono::duration_cast<duration_t>(test_clock::now() - start_) << std::endl;
+        }
+    };
+
+struct tick {
+    boost::int64_t time;
+    double price;
+};
+
+struct quote {
+    boost::int64_t time;
+    double bid;
+    double ask;
+};
+
+typedef boost::variant<boost::int64_t, double, tick, quote> var_t;
+
+namespace boost {
+    template <>
+    struct variant_codec<tick> {
+        static std::size_t encoded_size(const tick&) {
+            return sizeof(tick);
+        }
+
+        static unsigned char* encode(unsigned char* out, const tick& value) {
+            std::memcpy(out, &value, sizeof(value));
+            return out + sizeof(value);
+        }
+
+        static const unsigned char* decode(const unsigned char* in, const unsigned char* end, tick& value) {
+            if (static_cast<std::size_t>(end - in) < sizeof(value)) return nullptr;
+            std::memcpy(&value, in, sizeof(value));
+            return in + sizeof(value);
+        }
+    };
+
+    template <>
+    struct variant_codec<quote> {
+        static std::size_t encoded_size(const quote&) {
+            return sizeof(quote);
+        }
+
+        static unsigned char* encode(unsigned char* out, const quote& value) {
+            std::memcpy(out, &value, sizeof(value));
+            return out + sizeof(value);
+        }
+
+        static const unsigned char* decode(const unsigned char* in, const unsigned char* end, quote& value) {
+            if (static_cast<std::size_t>(end - in) < sizeof(value)) return nullptr;
+            std::memcpy(&value, in, sizeof(value));
+            return in + sizeof(value);
+        }
+    };
+}
+
+struct summer : boost::static_visitor<> {
+    double sum;
+
+    summer() : sum(0) {}
+
+    void operator()(boost::int64_t v) { sum += static_cast<double>(v); }
+    void operator()(double v) { sum += v; }
+    void operator()(const tick& v) { sum += v.price; }
+    void operator()(const quote& v) { sum += v.bid - v.ask; }
+};
+
+int main () {
+    BOOST_STATIC_CONSTANT(std::size_t, c_elements_count = 10000000);
+
+    std::vector<var_t> data;
+    data.reserve(c_elements_count);
+    for (std::size_t i = 0; i < c_elements_count; ++i) {
+        const boost::int64_t t = static_cast<boost::int64_t>(i);
+        switch (i % 4) {
+        case 0: data.push_back(t); break;
+        case 1: data.push_back(t * 0.5); break;
+        case 2: { tick v = { t, t * 0.25 }; data.push_back(v); break; }
+        default: { quote v = { t, t * 0.25, t * 0.5 }; data.push_back(v); break; }
+        }
+    }
+
+    std::vector<unsigned char> encoded(c_elements_count * (sizeof(quote) + 1));
+    std::size_t encoded_size = 0;
+    boost::encode_variants(data.begin(), data.end(), &encoded[0], encoded.size(), encoded_size);
+
+    std::ostringstream os;
+    boost::write_columnar_variants(data.begin(), data.end(), os);
+    const std::string columnar_bytes = os.str();
+    std::vector<boost::uint64_t> columnar(columnar_bytes.size() / sizeof(boost::uint64_t) + 1);
+    std::memcpy(&columnar[0], columnar_bytes.data(), columnar_bytes.size());
+    data.clear();
+
+    std::cout << "binary size " << encoded_size << " bytes, columnar size "
+              << columnar_bytes.size() << " bytes" << std::endl;
+
+    summer s1;
+    {
+        scope sc("decode_variants and scan");
+        std::vector<var_t> decoded(c_elements_count);
+        std::size_t consumed = 0;
+        boost::decode_variants(decoded.begin(), decoded.end(), &encoded[0], encoded_size, consumed);
+        for (std::size_t i = 0; i < decoded.size(); ++i) {
+            boost::apply_visitor(s1, decoded[i]);
+        }
+    }
+
+    summer s2;
+    {
+        scope sc("columnar_variants sequential scan in place");
+        const boost::columnar_variants<var_t> view(&columnar[0], columnar_bytes.size());
+        for (boost::columnar_variants<var_t>::const_iterator it = view.begin(); it != view.end(); ++it) {
+            boost::apply_visitor(s2, *it);
+        }
+    }
+
+    summer s3;
+    {
+        scope sc("columnar_variants random access in place");
+        const boost::columnar_variants<var_t> view(&columnar[0], columnar_bytes.size());
+        for (std::size_t i = 0; i < view.size(); ++i) {
+            boost::apply_visitor(s3, view[i]);
+        }
+    }
+
+    if (s1.sum != s2.sum || s1.sum != s3.sum) {
+        std::cout << "Results mismatch" << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,215 @@
+#!/usr/bin/env python3
+#
+# Copyright 2026 agent
+# Distributed under the Boost Software License, Version 1.0.
+# See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+"""Compile time, compiler memory and code size of boost::variant instantiations.
+
+Compiles variant_instantiation.cpp once per configuration (number of
+alternatives, recursion depth, instantiated operation) and records, per
+translation unit:
+
+  * wall and CPU (user + system) time of the compiler,
+  * peak resident memory of the compiler,
+  * object file size and the size of its executable sections.
+
+The results go to a JSON file (or the standard output). The "none"
+operation compiles the headers only; subtract it to get the cost of the
+instantiations themselves.
+
+Example:
+
+  perf/compile_time/measure.py --cxx g++ --flags="-std=c++11 -O2" \\
+      --alternatives 10,20,50,100 --depths 0,2,4 --output compile_time.json
+
+POSIX only (uses wait4 for the memory of the compiler).
+"""
+
+import argparse
+import json
+import os
+import platform
+import shlex
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SOURCE = os.path.join(HERE, "variant_instantiation.cpp")
+INCLUDE = os.path.normpath(os.path.join(HERE, "..", "..", "include"))
+
+OPERATIONS = ["none", "declare", "construct", "copy", "visit", "binary_visit",
+              "compare", "hash", "get", "all"]
+
+
+def executable_size(path):
+    """Sum of the sizes of the executable sections of an ELF object, or None
+    if the object is not ELF."""
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if data[:4] != b"\x7fELF":
+        return None
+
+    is64 = data[4] == 2
+    endian = "<" if data[5] == 1 else ">"
+    if is64:
+        shoff, = struct.unpack_from(endian + "Q", data, 0x28)
+        shentsize, shnum = struct.unpack_from(endian + "HH", data, 0x3A)
+    else:
+        shoff, = struct.unpack_from(endian + "I", data, 0x20)
+        shentsize, shnum = struct.unpack_from(endian + "HH", data, 0x2E)
+
+    SHF_EXECINSTR = 0x4
+    SHT_NOBITS = 8
+    total = 0
+    for i in range(shnum):
+        offset = shoff + i * shentsize
+        if is64:
+            _, sh_type, sh_flags = struct.unpack_from(endian + "IIQ", data, offset)
+            sh_size, = struct.unpack_from(endian + "Q", data, offset + 0x20)
+        else:
+            _, sh_type, sh_flags = struct.unpack_from(endian + "III", data, offset)
+            sh_size, = struct.unpack_from(endian + "I", data, offset + 0x14)
+        if sh_flags & SHF_EXECINSTR and sh_type != SHT_NOBITS:
+            total += sh_size
+    return total
+
+
+def max_rss_bytes(rusage):
+    # Kilobytes on Linux, bytes on macOS
+    if sys.platform == "darwin":
+        return rusage.ru_maxrss
+    return rusage.ru_maxrss * 1024
+
+
+def compile_once(cxx, flags, defines, output):
+    command = [cxx] + flags + ["-I" + INCLUDE] + ["-D%s=%s" % d for d in defines] \
+        + ["-c", SOURCE, "-o", output]
+
+    start = time.perf_counter()
+    process = subprocess.Popen(command, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE)
+    # wait4 reports the resources of this compiler process only
+    errors = process.stderr.read().decode("utf-8", "replace")
+    process.stderr.close()
+    _, status, rusage = os.wait4(process.pid, 0)
+    wall = time.perf_counter() - start
+    failed = not os.WIFEXITED(status) or os.WEXITSTATUS(status) != 0
+
+    error = None
+    if failed:
+        lines = errors.splitlines()
+        error = next((line for line in lines if "error" in line), lines[0] if lines else "compiler failed")
+
+    return {
+        "command": " ".join(shlex.quote(c) for c in command),
+        "status": "failed" if failed else "ok",
+        "error": error,
+        "wall_s": wall,
+        "cpu_s": rusage.ru_utime + rusage.ru_stime,
+        "peak_memory_bytes": max_rss_bytes(rusage),
+    }
+
+
+def measure(cxx, flags, alternatives, depth, operation, repeat, workdir):
+    output = os.path.join(workdir, "variant_instantiation.o")
+    defines = [("VARIANT_CT_ALTERNATIVES", alternatives),
+               ("VARIANT_CT_DEPTH", depth),
+               ("VARIANT_CT_OPERATION", operation)]
+
+    best = None
+    for _ in range(repeat):
+        if os.path.exists(output):
+            os.remove(output)
+        run = compile_once(cxx, flags, defines, output)
+        if run["status"] != "ok":
+            best = run
+            break
+        if best is None or run["cpu_s"] < best["cpu_s"]:
+            best = run
+
+    result = {
+        "alternatives": alternatives,
+        "depth": depth,
+        "operation": operation,
+        "status": best["status"],
+        "wall_s": round(best["wall_s"], 3),
+        "cpu_s": round(best["cpu_s"], 3),
+        "peak_memory_bytes": best["peak_memory_bytes"],
+    }
+
+    if best["status"] == "ok":
+        result["object_bytes"] = os.path.getsize(output)
+        result["code_bytes"] = executable_size(output)
+    else:
+        result["error"] = best["error"]
+        result["command"] = best["command"]
+
+    return result
+
+
+def int_list(text):
+    return [int(x) for x in text.split(",") if x]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--cxx", default=os.environ.get("CXX", "c++"), help="compiler (default: $CXX or c++)")
+    parser.add_argument("--flags", default="-std=c++11 -O2", help="compiler flags (default: %(default)s)")
+    parser.add_argument("--alternatives", type=int_list, default=[10, 20, 50, 100],
+                        help="comma separated numbers of alternatives (default: 10,20,50,100)")
+    parser.add_argument("--depths", type=int_list, default=[0, 2, 4],
+                        help="comma separated recursion depths, 0 for non-recursive (default: 0,2,4)")
+    parser.add_argument("--operations", default=",".join(OPERATIONS),
+                        help="comma separated operations (default: all of them)")
+    parser.add_argument("--binary-visit-limit", type=int, default=20,
+                        help="largest number of alternatives for binary_visit, which is quadratic (default: 20)")
+    parser.add_argument("--repeat", type=int, default=1, help="compilations per configuration, the best is kept")
+    parser.add_argument("--output", help="JSON file (default: standard output)")
+    args = parser.parse_args()
+
+    operations = [op for op in args.operations.split(",") if op]
+    for op in operations:
+        if op not in OPERATIONS:
+            parser.error("unknown operation " + op)
+
+    flags = shlex.split(args.flags)
+    version = subprocess.run([args.cxx, "--version"], stdout=subprocess.PIPE, stderr=subprocess.STDOUT) \
+        .stdout.decode("utf-8", "replace").splitlines()[0]
+
+    results = []
+    with tempfile.TemporaryDirectory() as workdir:
+        for depth in args.depths:
+            for alternatives in args.alternatives:
+                for op in operations:
+                    if op in ("binary_visit", "all") and alternatives > args.binary_visit_limit:
+                        continue
+                    result = measure(args.cxx, flags, alternatives, depth, op, args.repeat, workdir)
+                    results.append(result)
+                    sys.stderr.write("N=%d D=%d %-12s %s %.2fs %.0fMB %s\n" % (
+                        alternatives, depth, op, result["status"], result["cpu_s"],
+                        result["peak_memory_bytes"] / 1048576.0, result.get("code_bytes")))
+
+    report = {
+        "suite": "boost.variant compile time",
+        "compiler": version,
+        "flags": args.flags,
+        "machine": platform.machine(),
+        "results": results,
+    }
+
+    text = json.dumps(report, indent=2) + "\n"
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+    return 0 if all(r["status"] == "ok" for r in results) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,173 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Translation unit for measuring the compile time, the compiler memory and
+// the code size of boost::variant instantiations. Driven by measure.py,
+// configured with:
+//
+//   VARIANT_CT_ALTERNATIVES   number of alternatives (default 10)
+//   VARIANT_CT_DEPTH          if non zero, one more alternative is the
+//                             recursive_variant_ nested into DEPTH levels of
+//                             std::vector (default 0)
+//   VARIANT_CT_OPERATION      what to instantiate (default all):
+//                               none          only the headers
+//                               declare       sizeof of the variant
+//                               construct     construction and destruction
+//                               copy          copy construction and assignment
+//                               visit         unary apply_visitor
+//                               binary_visit  binary apply_visitor
+//                               compare       operator== and operator<
+//                               hash          hash_value
+//                               get           get and relaxed_get
+//                               all           everything above
+//
+
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/repetition/enum.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+
+#ifndef VARIANT_CT_ALTERNATIVES
+#   define VARIANT_CT_ALTERNATIVES 10
+#endif
+
+#ifndef VARIANT_CT_DEPTH
+#   define VARIANT_CT_DEPTH 0
+#endif
+
+#include <boost/variant.hpp>
+#include <boost/functional/hash.hpp>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+#ifndef VARIANT_CT_OPERATION
+#   define VARIANT_CT_OPERATION all
+#endif
+
+#define VARIANT_CT_OP_none          0
+#define VARIANT_CT_OP_declare       1
+#define VARIANT_CT_OP_construct     2
+#define VARIANT_CT_OP_copy          3
+#define VARIANT_CT_OP_visit         4
+#define VARIANT_CT_OP_binary_visit  5
+#define VARIANT_CT_OP_compare       6
+#define VARIANT_CT_OP_hash          7
+#define VARIANT_CT_OP_get           8
+#define VARIANT_CT_OP_all           9
+
+#define VARIANT_CT_SELECTED BOOST_PP_CAT(VARIANT_CT_OP_, VARIANT_CT_OPERATION)
+#define VARIANT_CT_ENABLED(op) \
+    (VARIANT_CT_SELECTED == BOOST_PP_CAT(VARIANT_CT_OP_, op) || VARIANT_CT_SELECTED == VARIANT_CT_OP_all)
+
+#if VARIANT_CT_SELECTED != VARIANT_CT_OP_none
+
+template <int I>
+struct alt {
+    int value;
+
+    friend bool operator==(const alt& lhs, const alt& rhs) { return lhs.value == rhs.value; }
+    friend bool operator<(const alt& lhs, const alt& rhs) { return lhs.value < rhs.value; }
+    friend std::size_t hash_value(const alt& a) { return static_cast<std::size_t>(a.value) ^ I; }
+};
+
+#define VARIANT_CT_ALT(z, n, data) alt<n>
+
+#if VARIANT_CT_DEPTH == 0
+
+typedef boost::variant<
+    BOOST_PP_ENUM(VARIANT_CT_ALTERNATIVES, VARIANT_CT_ALT, ~)
+> variant_t;
+
+#else
+
+#define VARIANT_CT_VECTOR_OPEN(z, n, data) std::vector<
+#define VARIANT_CT_VECTOR_CLOSE(z, n, data) >
+
+typedef boost::make_recursive_variant<
+      BOOST_PP_ENUM(VARIANT_CT_ALTERNATIVES, VARIANT_CT_ALT, ~)
+    , BOOST_PP_REPEAT(VARIANT_CT_DEPTH, VARIANT_CT_VECTOR_OPEN, ~)
+          boost::recursive_variant_
+      BOOST_PP_REPEAT(VARIANT_CT_DEPTH, VARIANT_CT_VECTOR_CLOSE, ~)
+>::type variant_t;
+
+#endif
+
+struct sum_visitor : boost::static_visitor<int> {
+    template <int I>
+    int operator()(const alt<I>& a) const { return a.value + I; }
+
+    template <class T>
+    int operator()(const std::vector<T>& v) const { return static_cast<int>(v.size()); }
+
+    template <class T, class U>
+    int operator()(const T& a, const U& b) const { return (*this)(a) - (*this)(b); }
+};
+
+#if VARIANT_CT_ENABLED(declare)
+std::size_t variant_size() {
+    return sizeof(variant_t);
+}
+#endif
+
+#if VARIANT_CT_ENABLED(construct)
+void variant_construct(void* storage, int value) {
+    new (storage) variant_t(alt<VARIANT_CT_ALTERNATIVES - 1>{ value });
+}
+
+void variant_destroy(variant_t* v) {
+    v->~variant_t();
+}
+#endif
+
+#if VARIANT_CT_ENABLED(copy)
+void variant_copy_construct(void* storage, const variant_t& v) {
+    new (storage) variant_t(v);
+}
+
+void variant_copy_assign(variant_t& lhs, const variant_t& rhs) {
+    lhs = rhs;
+}
+#endif
+
+#if VARIANT_CT_ENABLED(visit)
+int variant_visit(const variant_t& v) {
+    return boost::apply_visitor(sum_visitor(), v);
+}
+#endif
+
+#if VARIANT_CT_ENABLED(binary_visit)
+int variant_binary_visit(const variant_t& lhs, const variant_t& rhs) {
+    return boost::apply_visitor(sum_visitor(), lhs, rhs);
+}
+#endif
+
+#if VARIANT_CT_ENABLED(compare)
+bool variant_equal(const variant_t& lhs, const variant_t& rhs) {
+    return lhs == rhs;
+}
+
+bool variant_less(const variant_t& lhs, const variant_t& rhs) {
+    return lhs < rhs;
+}
+#endif
+
+#if VARIANT_CT_ENABLED(hash)
+std::size_t variant_hash(const variant_t& v) {
+    return boost::hash_value(v);
+}
+#endif
+
+#if VARIANT_CT_ENABLED(get)
+const alt<VARIANT_CT_ALTERNATIVES / 2>* variant_get(const variant_t& v) {
+    return boost::get< alt<VARIANT_CT_ALTERNATIVES / 2> >(&v);
+}
+
+const alt<VARIANT_CT_ALTERNATIVES / 2>* variant_relaxed_get(const variant_t& v) {
+    return boost::relaxed_get< alt<VARIANT_CT_ALTERNATIVES / 2> >(&v);
+}
+#endif
+
+#endif // VARIANT_CT_SELECTED != VARIANT_CT_OP_none
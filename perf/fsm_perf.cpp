@@ -0,0 +1,179 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Testing throughput of protocol session state machines: boost::variant_fsm
+// versus binary apply_visitor with variant assignment of the new state
+//
+
+#define BOOST_ERROR_CODE_HEADER_ONLY
+#define BOOST_CHRONO_HEADER_ONLY
+#include <boost/chrono.hpp>
+
+#include <boost/variant.hpp>
+#include <boost/variant/variant_fsm.hpp>
+#include <iostream>
+#include <string>
+#include <vector>
+
+    struct scope {
+        typedef boost::chrono::steady_clock test_clock;
+        typedef boost::chrono::duration<double> duration_t;
+        test_clock::time_point start_;
+        const char* const message_;
+        const std::size_t operations_;
+
+        scope(const char* const message, std::size_t operations)
+            : start_(test_clock::now())
+            , message_(message)
+            , operations_(operations)
+        {}
+
+        ~scope() {
+            const double seconds = boost::chrono::duration_cast<duration_t>(test_clock::now() - start_).count();
+            std::cout << message_ << "   " << (operations_ / seconds / 1e6) << " Mevents/s" << std::endl;
+        }
+    };
+
+// States. A throwing copy constructor makes variant assignment between
+// different states use the heap backup.
+struct idle {
+    idle() {}
+    idle(const idle&) {}
+    idle(idle&&) noexcept(false) {}
+    idle& operator=(const idle&) { return *this; }
+};
+
+struct handshaking {
+    std::string peer;
+    int attempts;
+};
+
+struct established {
+    std::string peer;
+    long long bytes;
+};
+
+// Events
+struct hello { std::string peer; };
+struct ack {};
+struct chunk { int size; };
+struct bye {};
+
+typedef boost::variant<idle, handshaking, established> state_t;
+typedef boost::variant<hello, ack, chunk, bye> event_t;
+
+struct session {
+    handshaking operator()(idle&&, const hello& e) const {
+        handshaking result = { e.peer, 1 };
+        return result;
+    }
+
+    established operator()(handshaking&& s, const ack&) const {
+        established result = { std::move(s.peer), 0 };
+        return result;
+    }
+
+    established operator()(established&& s, const chunk& e) const {
+        s.bytes += e.size;
+        return std::move(s);
+    }
+
+    idle operator()(established&&, const bye&) const {
+        return idle();
+    }
+};
+
+// The same machine as a binary visitor assigning the new state
+struct assigning_session : boost::static_visitor<bool> {
+    state_t& state;
+
+    explicit assigning_session(state_t& s) : state(s) {}
+
+    bool operator()(idle&, const hello& e) const {
+        handshaking next = { e.peer, 1 };
+        state = std::move(next);
+        return true;
+    }
+
+    bool operator()(handshaking& s, const ack&) const {
+        established next = { std::move(s.peer), 0 };
+        state = std::move(next);
+        return true;
+    }
+
+    bool operator()(established& s, const chunk& e) const {
+        s.bytes += e.size;
+        return true;
+    }
+
+    bool operator()(established&, const bye&) const {
+        state = idle();
+        return true;
+    }
+
+    template <class S, class E>
+    bool operator()(S&, const E&) const {
+        return false;
+    }
+};
+
+BOOST_STATIC_CONSTANT(std::size_t, c_sessions = 100000);
+BOOST_STATIC_CONSTANT(std::size_t, c_rounds = 10);
+
+static std::vector<event_t> make_script() {
+    std::vector<event_t> script;
+    hello c = { "10.0.0.1:443" };
+    script.push_back(c);
+    script.push_back(ack());
+    for (int i = 0; i < 4; ++i) {
+        chunk d = { 100 + i };
+        script.push_back(d);
+    }
+    script.push_back(bye());
+    return script;
+}
+
+int main () {
+    const std::vector<event_t> script = make_script();
+    const std::size_t events = c_sessions * c_rounds * script.size();
+    std::size_t transitions = 0;
+
+    {
+        std::vector<state_t> sessions(c_sessions);
+        scope sc("apply_visitor + variant assignment", events);
+        for (std::size_t round = 0; round < c_rounds; ++round) {
+            for (std::size_t i = 0; i < script.size(); ++i) {
+                for (std::size_t s = 0; s < sessions.size(); ++s) {
+                    event_t& e = const_cast<event_t&>(script[i]);
+                    transitions += boost::apply_visitor(assigning_session(sessions[s]), sessions[s], e);
+                }
+            }
+        }
+    }
+
+    {
+        typedef boost::variant_fsm<state_t, event_t, session> fsm_t;
+        std::vector<fsm_t*> sessions;
+        for (std::size_t s = 0; s < c_sessions; ++s) {
+            sessions.push_back(new fsm_t(idle()));
+        }
+        {
+            scope sc("variant_fsm", events);
+            for (std::size_t round = 0; round < c_rounds; ++round) {
+                for (std::size_t i = 0; i < script.size(); ++i) {
+                    for (std::size_t s = 0; s < sessions.size(); ++s) {
+                        transitions += sessions[s]->process(script[i]);
+                    }
+                }
+            }
+        }
+        for (std::size_t s = 0; s < c_sessions; ++s) {
+            delete sessions[s];
+        }
+    }
+
+    std::cout << "transitions: " << transitions << std::endl;
+}
@@ -0,0 +1,136 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Testing visitation of a message stream in which one alternative holds 95%
+// (and 50%) of the messages: plain apply_visitor versus apply_visitor with
+// that alternative declared in variant_likely_alternatives
+//
+
+#define BOOST_ERROR_CODE_HEADER_ONLY
+#define BOOST_CHRONO_HEADER_ONLY
+#include <boost/chrono.hpp>
+
+#include <boost/variant.hpp>
+#include <boost/variant/likely_alternatives.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+    struct scope {
+        typedef boost::chrono::steady_clock test_clock;
+        typedef boost::chrono::duration<double> duration_t;
+        test_clock::time_point start_;
+        const char* const message_;
+        const std::size_t operations_;
+
+        scope(const char* const message, std::size_t operations)
+            : start_(test_clock::now())
+            , message_(message)
+            , operations_(operations)
+        {}
+
+        ~scope() {
+            const double seconds = boost::chrono::duration_cast<duration_t>(test_clock::now() - start_).count();
+            std::cout << message_ << "   " << (operations_ / seconds / 1e6) << " Mmsg/s" << std::endl;
+        }
+    };
+
+// Same messages for both variants, told apart by the tag.
+template <int N, class Tag>
+struct msg {
+    int payload[4];
+};
+
+struct plain_tag {};
+struct likely_tag {};
+
+template <class Tag>
+struct messages {
+    typedef boost::variant<
+        msg<0, Tag>, msg<1, Tag>, msg<2, Tag>, msg<3, Tag>,
+        msg<4, Tag>, msg<5, Tag>, msg<6, Tag>, msg<7, Tag>
+    > type;
+};
+
+typedef messages<plain_tag>::type plain_t;
+typedef messages<likely_tag>::type likely_t;
+
+namespace boost {
+
+template <>
+struct variant_likely_alternatives<likely_t>
+    : likely_alternatives<likely_t, msg<5, likely_tag> >
+{
+};
+
+} // namespace boost
+
+struct sum_visitor : boost::static_visitor<long> {
+    template <int N, class Tag>
+    long operator()(const msg<N, Tag>& m) const {
+        return m.payload[N % 4] + N;
+    }
+};
+
+template <class Variant>
+std::vector<Variant> make_stream(std::size_t size, int hot_percent) {
+    typedef typename boost::mpl::at_c<typename Variant::types, 5>::type hot_t;
+
+    std::vector<Variant> stream;
+    stream.reserve(size);
+    std::srand(42);
+    for (std::size_t i = 0; i < size; ++i) {
+        const int r = std::rand() % 100;
+        if (r < hot_percent) {
+            stream.push_back(hot_t());
+        } else {
+            switch (r % 7) {
+            case 0: stream.push_back(typename boost::mpl::at_c<typename Variant::types, 0>::type()); break;
+            case 1: stream.push_back(typename boost::mpl::at_c<typename Variant::types, 1>::type()); break;
+            case 2: stream.push_back(typename boost::mpl::at_c<typename Variant::types, 2>::type()); break;
+            case 3: stream.push_back(typename boost::mpl::at_c<typename Variant::types, 3>::type()); break;
+            case 4: stream.push_back(typename boost::mpl::at_c<typename Variant::types, 4>::type()); break;
+            case 5: stream.push_back(typename boost::mpl::at_c<typename Variant::types, 6>::type()); break;
+            default: stream.push_back(typename boost::mpl::at_c<typename Variant::types, 7>::type()); break;
+            }
+        }
+    }
+
+    return stream;
+}
+
+template <class Variant>
+long visit_stream(const std::vector<Variant>& stream, std::size_t rounds, const char* message) {
+    const sum_visitor visitor = sum_visitor();
+    long result = 0;
+
+    scope sc(message, stream.size() * rounds);
+    for (std::size_t round = 0; round < rounds; ++round) {
+        for (std::size_t i = 0; i < stream.size(); ++i)
+            result += boost::apply_visitor(visitor, stream[i]);
+    }
+
+    return result;
+}
+
+int main() {
+    const std::size_t size = 1 << 16;
+    const std::size_t rounds = 500;
+
+    const int hot_percents[] = { 95, 50 };
+    long result = 0;
+    for (std::size_t i = 0; i < sizeof(hot_percents) / sizeof(hot_percents[0]); ++i) {
+        std::cout << "\n" << hot_percents[i] << "% of the messages of one type:\n";
+
+        const std::vector<plain_t> plain = make_stream<plain_t>(size, hot_percents[i]);
+        const std::vector<likely_t> likely = make_stream<likely_t>(size, hot_percents[i]);
+
+        result += visit_stream(plain, rounds, "apply_visitor                     ");
+        result += visit_stream(likely, rounds, "apply_visitor, likely_alternatives");
+    }
+
+    return result == 42 ? 1 : 0;
+}
@@ -14,6 +14,7 @@
 #include <boost/chrono.hpp>
 
 #include <boost/variant.hpp>
+#include <iostream>
 #include <string>
 #include <vector>
 
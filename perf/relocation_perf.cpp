@@ -0,0 +1,185 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Testing the trivial relocation of variant contents: shuffles and sorts
+// (swap heavy) of variant<std::string, Big> and variant<string_ptr, Big>,
+// and the growth of a buffer of variants by relocate_range versus
+// std::vector. The pinned_ types are the same types that are not declared
+// trivially relocatable (nor is std::string of libstdc++).
+//
+
+#define BOOST_ERROR_CODE_HEADER_ONLY
+#define BOOST_CHRONO_HEADER_ONLY
+#include <boost/chrono.hpp>
+
+#include <boost/variant.hpp>
+#include <boost/variant/trivially_relocatable.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+    struct scope {
+        typedef boost::chrono::steady_clock test_clock;
+        typedef boost::chrono::duration<double> duration_t;
+        test_clock::time_point start_;
+        const char* const message_;
+        const std::size_t operations_;
+
+        scope(const char* const message, std::size_t operations)
+            : start_(test_clock::now())
+            , message_(message)
+            , operations_(operations)
+        {}
+
+        ~scope() {
+            const double seconds = boost::chrono::duration_cast<duration_t>(test_clock::now() - start_).count();
+            std::cout << message_ << "   " << (operations_ / seconds / 1e6) << " Melements/s" << std::endl;
+        }
+    };
+
+// A user-provided copy and move (so not trivially copyable), that may throw
+template <class Tag>
+struct big {
+    long key;
+    char payload[56];
+
+    explicit big(int k) : key(k) { std::memset(payload, 'b', sizeof(payload)); }
+    big(const big& other) : key(other.key) { std::memcpy(payload, other.payload, sizeof(payload)); }
+    big(big&& other) : key(other.key) { std::memcpy(payload, other.payload, sizeof(payload)); }
+    big& operator=(const big& other) { key = other.key; std::memcpy(payload, other.payload, sizeof(payload)); return *this; }
+};
+
+struct relocatable_tag {};
+struct pinned_tag {};
+
+typedef big<relocatable_tag> Big;
+typedef big<pinned_tag> pinned_big;
+
+// String sharing its characters: trivially relocatable in practice
+template <class Tag>
+struct shared_string {
+    std::shared_ptr<std::string> chars;
+};
+
+typedef shared_string<relocatable_tag> string_ptr;
+typedef shared_string<pinned_tag> pinned_string_ptr;
+
+namespace boost {
+    template <>
+    struct is_trivially_relocatable<Big> : mpl::true_ {};
+
+    template <>
+    struct is_trivially_relocatable<string_ptr> : mpl::true_ {};
+}
+
+struct key_of : boost::static_visitor<int> {
+    int operator()(const std::string& s) const { return static_cast<unsigned char>(s[0]); }
+    template <class Tag>
+    int operator()(const shared_string<Tag>& s) const { return static_cast<unsigned char>((*s.chars)[0]); }
+    template <class Tag>
+    int operator()(const big<Tag>& b) const { return static_cast<int>(b.key); }
+};
+
+struct by_key {
+    template <class Variant>
+    bool operator()(const Variant& lhs, const Variant& rhs) const {
+        return boost::apply_visitor(key_of(), lhs) < boost::apply_visitor(key_of(), rhs);
+    }
+};
+
+BOOST_STATIC_CONSTANT(std::size_t, c_elements = 100000);
+BOOST_STATIC_CONSTANT(std::size_t, c_runs = 20);
+
+static void make_string(std::string& s, int key) {
+    s = std::string(1, static_cast<char>(key)) + "-a string too long for the small buffer";
+}
+
+template <class Tag>
+static void make_string(shared_string<Tag>& s, int key) {
+    s.chars = std::make_shared<std::string>();
+    make_string(*s.chars, key);
+}
+
+template <class String, class BigT>
+static void sort_test(const char* message) {
+    typedef boost::variant<String, BigT> variant_t;
+
+    std::vector<variant_t> v;
+    v.reserve(c_elements);
+
+    std::srand(42);
+    for (std::size_t i = 0; i < c_elements; ++i) {
+        const int key = std::rand() % 256;
+        if (key % 2) {
+            String s;
+            make_string(s, key);
+            v.push_back(s);
+        } else {
+            v.push_back(BigT(key));
+        }
+    }
+
+    std::mt19937 random(42);
+    scope sc(message, c_elements * c_runs);
+    for (std::size_t run = 0; run < c_runs; ++run) {
+        std::shuffle(v.begin(), v.end(), random);
+        std::sort(v.begin(), v.end(), by_key());
+    }
+}
+
+// Minimal growing buffer, as a container would relocate its elements
+template <class T>
+class relocating_buffer {
+    T* data_;
+    std::size_t size_;
+    std::size_t capacity_;
+
+public:
+    relocating_buffer() : data_(0), size_(0), capacity_(0) {}
+    ~relocating_buffer() {
+        for (std::size_t i = 0; i < size_; ++i) data_[i].~T();
+        std::free(data_);
+    }
+
+    template <class U>
+    void push_back(U&& value) {
+        if (size_ == capacity_) {
+            capacity_ = capacity_ ? capacity_ * 2 : 16;
+            T* data = static_cast<T*>(std::malloc(capacity_ * sizeof(T)));
+            boost::relocate_range(data_, data_ + size_, data);
+            std::free(data_);
+            data_ = data;
+        }
+        new (data_ + size_) T(std::forward<U>(value));
+        ++size_;
+    }
+};
+
+template <class Container>
+static void growth_test(const char* message) {
+    scope sc(message, c_elements * c_runs);
+    for (std::size_t run = 0; run < c_runs; ++run) {
+        Container c;
+        for (std::size_t i = 0; i < c_elements; ++i) {
+            c.push_back(Big(static_cast<int>(i)));
+        }
+    }
+}
+
+int main () {
+    sort_test<std::string, pinned_big>("shuffle and sort variant<std::string, pinned_big>        ");
+    sort_test<std::string, Big>("shuffle and sort variant<std::string, Big>               ");
+    sort_test<pinned_string_ptr, pinned_big>("shuffle and sort variant<pinned_string_ptr, pinned_big>  ");
+    sort_test<string_ptr, Big>("shuffle and sort variant<string_ptr, Big>                ");
+
+    growth_test< std::vector< boost::variant<string_ptr, Big> > >("growth std::vector                                       ");
+    growth_test< relocating_buffer< boost::variant<string_ptr, Big> > >("growth relocate_range                                    ");
+}
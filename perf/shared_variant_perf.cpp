@@ -0,0 +1,155 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Testing scaling of readers of a shared read-mostly variant of large
+// bounded types with a single writer: boost::shared_variant versus a variant
+// protected by a shared (or, if not available, exclusive) mutex
+//
+
+#define BOOST_ERROR_CODE_HEADER_ONLY
+#define BOOST_CHRONO_HEADER_ONLY
+#include <boost/chrono.hpp>
+
+#include <boost/variant.hpp>
+#include <boost/variant/shared_variant.hpp>
+#include <atomic>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef BOOST_NO_CXX14_HDR_SHARED_MUTEX
+#   include <shared_mutex>
+#endif
+
+    struct scope {
+        typedef boost::chrono::steady_clock test_clock;
+        typedef boost::chrono::duration<double> duration_t;
+        test_clock::time_point start_;
+        const char* const message_;
+        const unsigned threads_;
+        const std::size_t operations_;
+
+        scope(const char* const message, unsigned threads, std::size_t operations)
+            : start_(test_clock::now())
+            , message_(message)
+            , threads_(threads)
+            , operations_(operations)
+        {}
+
+        ~scope() {
+            const double seconds = boost::chrono::duration_cast<duration_t>(test_clock::now() - start_).count();
+            std::cout << message_ << " readers " << threads_ << "   "
+                      << (operations_ / seconds / 1e6) << " Mreads/s" << std::endl;
+        }
+    };
+
+typedef std::vector<int> table_t;
+typedef std::map<std::string, int> index_t;
+
+typedef boost::variant<std::string, table_t, index_t> config_t;
+
+struct reader : boost::static_visitor<long long> {
+    long long operator()(const std::string& s) const { return static_cast<long long>(s.size()); }
+    long long operator()(const table_t& t) const { return t[t.size() / 2]; }
+    long long operator()(const index_t& m) const { return m.find("42")->second; }
+};
+
+static config_t make_config(int i) {
+    if (i % 2) {
+        index_t m;
+        for (int k = 0; k < 64; ++k) {
+            m[std::to_string(k)] = i;
+        }
+        return m;
+    }
+    return table_t(1024, i);
+}
+
+BOOST_STATIC_CONSTANT(std::size_t, c_reads_per_thread = 500000);
+
+#ifndef BOOST_NO_CXX14_HDR_SHARED_MUTEX
+typedef std::shared_timed_mutex mutex_t;
+typedef std::shared_lock<mutex_t> read_lock_t;
+static const char* const c_locked_name = "shared_timed_mutex + variant";
+#else
+typedef std::mutex mutex_t;
+typedef std::lock_guard<mutex_t> read_lock_t;
+static const char* const c_locked_name = "mutex + variant";
+#endif
+
+struct locked_config {
+    mutable mutex_t mutex;
+    config_t value;
+
+    long long read() const {
+        read_lock_t lock(mutex);
+        return boost::apply_visitor(reader(), value);
+    }
+
+    void write(const config_t& v) {
+        std::lock_guard<mutex_t> lock(mutex);
+        value = v;
+    }
+};
+
+struct rcu_config {
+    boost::shared_variant<std::string, table_t, index_t> value;
+
+    long long read() const {
+        return value.apply_visitor(reader());
+    }
+
+    void write(const config_t& v) {
+        value.store(v);
+    }
+};
+
+template <class Shared>
+static void run(const char* name, unsigned readers_count) {
+    Shared shared;
+    shared.write(make_config(0));
+    std::atomic<bool> stop(false);
+
+    // The writer updates the value continuously
+    std::thread writer([&shared, &stop]() {
+        for (int i = 0; !stop.load(std::memory_order_relaxed); ++i) {
+            shared.write(make_config(i));
+            std::this_thread::yield();
+        }
+    });
+
+    {
+        scope sc(name, readers_count, readers_count * c_reads_per_thread);
+        std::vector<std::thread> readers;
+        for (unsigned t = 0; t < readers_count; ++t) {
+            readers.push_back(std::thread([&shared]() {
+                long long sum = 0;
+                for (std::size_t i = 0; i < c_reads_per_thread; ++i) {
+                    sum += shared.read();
+                }
+                volatile long long sink = sum;
+                (void)sink;
+            }));
+        }
+        for (unsigned t = 0; t < readers_count; ++t) {
+            readers[t].join();
+        }
+    }
+
+    stop = true;
+    writer.join();
+}
+
+int main () {
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    for (unsigned readers = 1; readers <= 64; readers *= 2) {
+        run<locked_config>(c_locked_name, readers);
+        run<rcu_config>("shared_variant", readers);
+    }
+}
@@ -0,0 +1,111 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Testing the copies and destructions of a vector of events, 90% of them
+// scalars and the others strings, held in variant<int, double, std::string>.
+// The boxed_ scalars are the same scalars with a user-provided copy, which
+// variant copies and destroys by visitation.
+//
+
+#define BOOST_ERROR_CODE_HEADER_ONLY
+#define BOOST_CHRONO_HEADER_ONLY
+#include <boost/chrono.hpp>
+
+#include <boost/variant.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+    struct scope {
+        typedef boost::chrono::steady_clock test_clock;
+        typedef boost::chrono::duration<double> duration_t;
+        test_clock::time_point start_;
+        const char* const message_;
+        const std::size_t operations_;
+
+        scope(const char* const message, std::size_t operations)
+            : start_(test_clock::now())
+            , message_(message)
+            , operations_(operations)
+        {}
+
+        ~scope() {
+            const double seconds = boost::chrono::duration_cast<duration_t>(test_clock::now() - start_).count();
+            std::cout << message_ << "   " << (operations_ / seconds / 1e6) << " Melements/s" << std::endl;
+        }
+    };
+
+// Not trivially copyable, nor trivially destructible
+template <class T>
+struct boxed_scalar {
+    T value;
+
+    boxed_scalar(T v) : value(v) {}
+    boxed_scalar(const boxed_scalar& other) : value(other.value) {}
+    boxed_scalar& operator=(const boxed_scalar& other) { value = other.value; return *this; }
+    ~boxed_scalar() {}
+};
+
+typedef boost::variant<int, double, std::string> event_t;
+typedef boost::variant<boxed_scalar<int>, boxed_scalar<double>, std::string> boxed_event_t;
+
+BOOST_STATIC_CONSTANT(std::size_t, c_elements = 100000);
+BOOST_STATIC_CONSTANT(std::size_t, c_runs = 200);
+
+template <class Variant, class Int, class Double>
+static void fill(std::vector<Variant>& events) {
+    std::srand(42);
+    for (std::size_t i = 0; i < c_elements; ++i) {
+        const int r = std::rand() % 100;
+        if (r < 10) {
+            events.push_back(std::string("an occasional string, not a small one"));
+        } else if (r < 55) {
+            events.push_back(Int(r));
+        } else {
+            events.push_back(Double(r * 0.5));
+        }
+    }
+}
+
+template <class Variant, class Int, class Double>
+static void copy_test(const char* message) {
+    std::vector<Variant> events;
+    fill<Variant, Int, Double>(events);
+
+    std::size_t checksum = 0;
+    {
+        scope sc(message, c_elements * c_runs);
+        for (std::size_t run = 0; run < c_runs; ++run) {
+            std::vector<Variant> copy(events);
+            checksum += copy[run].which();
+        }
+    }
+    std::cout << "   (checksum " << checksum << ")" << std::endl;
+}
+
+template <class Variant, class Int, class Double>
+static void assign_test(const char* message) {
+    std::vector<Variant> events;
+    fill<Variant, Int, Double>(events);
+
+    std::vector<Variant> shifted(events.begin() + 1, events.end());
+    shifted.push_back(events.front());
+
+    std::vector<Variant> target(events);
+    scope sc(message, c_elements * c_runs);
+    for (std::size_t run = 0; run < c_runs; ++run) {
+        target = (run % 2) ? events : shifted;
+    }
+}
+
+int main () {
+    copy_test<boxed_event_t, boxed_scalar<int>, boxed_scalar<double> >("copy and destroy variant<boxed_int, boxed_double, string>");
+    copy_test<event_t, int, double>("copy and destroy variant<int, double, string>            ");
+
+    assign_test<boxed_event_t, boxed_scalar<int>, boxed_scalar<double> >("assign variant<boxed_int, boxed_double, string>          ");
+    assign_test<event_t, int, double>("assign variant<int, double, string>                      ");
+}
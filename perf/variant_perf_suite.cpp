@@ -0,0 +1,562 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Runtime benchmark suite of boost::variant, with std::variant running the
+// same workloads as the baseline (when <variant> is available).
+//
+// Usage: variant_perf_suite [--output FILE] [--filter SUBSTRING]
+//
+// Writes the results as JSON to FILE, or to the standard output if there is
+// no --output; the progress goes to the standard error. Every result is the
+// best of several runs, in nanoseconds per operation. Compare the results
+// of two Boost versions benchmark by benchmark, relative to std::variant
+// on the same machine.
+//
+
+#define BOOST_ERROR_CODE_HEADER_ONLY
+#define BOOST_CHRONO_HEADER_ONLY
+#include <boost/chrono.hpp>
+
+#include <boost/config.hpp>
+#include <boost/version.hpp>
+#include <boost/variant.hpp>
+#include <boost/variant/multivisitors.hpp>
+#include <boost/functional/hash.hpp>
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if !defined(BOOST_NO_CXX17_HDR_VARIANT)
+#   include <variant>
+#   define VARIANT_PERF_STD_BASELINE
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Measurement and the report
+
+struct result {
+    std::string benchmark;
+    std::string library;
+    int alternatives;
+    std::size_t operations;
+    double ns_per_op;
+};
+
+class suite {
+    std::vector<result> results_;
+    std::string filter_;
+
+public:
+    explicit suite(const std::string& filter)
+        : filter_(filter)
+    {}
+
+    bool enabled(const std::string& benchmark) const {
+        return benchmark.find(filter_) != std::string::npos;
+    }
+
+    // Runs f() `runs` times, each performing `operations` operations, and
+    // records the fastest run.
+    template <class F>
+    void measure(const std::string& benchmark, const char* library, int alternatives, std::size_t operations, F f) {
+        if (!enabled(benchmark))
+            return;
+
+        typedef boost::chrono::steady_clock test_clock;
+        typedef boost::chrono::duration<double, boost::nano> duration_t;
+
+        const int runs = 5;
+        double best = 0;
+        for (int run = 0; run < runs; ++run) {
+            const test_clock::time_point start = test_clock::now();
+            f();
+            const double ns = boost::chrono::duration_cast<duration_t>(test_clock::now() - start).count();
+            if (run == 0 || ns < best)
+                best = ns;
+        }
+
+        result r = { benchmark, library, alternatives, operations, best / operations };
+        results_.push_back(r);
+        std::cerr << benchmark << " / " << library << " / " << alternatives << ": "
+                  << r.ns_per_op << " ns/op" << std::endl;
+    }
+
+    static std::string escape(const std::string& s) {
+        std::string out;
+        for (std::size_t i = 0; i < s.size(); ++i) {
+            if (s[i] == '"' || s[i] == '\\')
+                out += '\\';
+            out += s[i];
+        }
+        return out;
+    }
+
+    void write_json(std::ostream& out) const {
+        out << "{\n"
+            << "  \"suite\": \"boost.variant runtime\",\n"
+            << "  \"boost_version\": \"" << BOOST_LIB_VERSION << "\",\n"
+            << "  \"compiler\": \"" << escape(BOOST_COMPILER) << "\",\n"
+            << "  \"cplusplus\": " << __cplusplus << ",\n"
+            << "  \"results\": [";
+
+        for (std::size_t i = 0; i < results_.size(); ++i) {
+            const result& r = results_[i];
+            out << (i ? ",\n" : "\n")
+                << "    { \"benchmark\": \"" << escape(r.benchmark)
+                << "\", \"library\": \"" << escape(r.library)
+                << "\", \"alternatives\": " << r.alternatives
+                << ", \"operations\": " << r.operations
+                << ", \"ns_per_op\": " << r.ns_per_op << " }";
+        }
+
+        out << "\n  ]\n}\n";
+    }
+};
+
+static const char* const boost_lib = "boost::variant";
+static const char* const std_lib = "std::variant";
+
+// Keeps the results of the workloads alive.
+static volatile long sink;
+
+///////////////////////////////////////////////////////////////////////////////
+// Alternatives
+
+template <std::size_t... I>
+struct indexes {};
+
+template <std::size_t N, std::size_t... I>
+struct make_indexes : make_indexes<N - 1, N - 1, I...> {};
+
+template <std::size_t... I>
+struct make_indexes<0, I...> {
+    typedef indexes<I...> type;
+};
+
+template <std::size_t I>
+struct alt {
+    long value;
+
+    explicit alt(long v = 0) : value(v) {}
+
+    friend bool operator==(const alt& lhs, const alt& rhs) { return lhs.value == rhs.value; }
+    friend bool operator<(const alt& lhs, const alt& rhs) { return lhs.value < rhs.value; }
+    friend std::size_t hash_value(const alt& a) { return boost::hash_value(a.value) ^ I; }
+};
+
+#if defined(VARIANT_PERF_STD_BASELINE)
+namespace std {
+    template <std::size_t I>
+    struct hash< alt<I> > {
+        std::size_t operator()(const alt<I>& a) const { return std::hash<long>()(a.value) ^ I; }
+    };
+}
+#endif
+
+template <class Indexes>
+struct alternatives;
+
+template <std::size_t... I>
+struct alternatives< indexes<I...> > {
+    typedef boost::variant<alt<I>...> boost_type;
+#if defined(VARIANT_PERF_STD_BASELINE)
+    typedef std::variant<alt<I>...> std_type;
+#endif
+
+    template <class Variant, std::size_t J>
+    static Variant make_one(long value) {
+        return Variant(alt<J>(value));
+    }
+
+    // A variant holding the alternative `which`
+    template <class Variant>
+    static Variant make(std::size_t which, long value) {
+        static Variant (*const makers[])(long) = { &alternatives::make_one<Variant, I>... };
+        return makers[which](value);
+    }
+};
+
+template <std::size_t N>
+struct bench_types : alternatives<typename make_indexes<N>::type> {};
+
+// Pseudo random but reproducible contents with uniformly distributed which()
+template <std::size_t N, class Variant>
+std::vector<Variant> make_values(std::size_t size) {
+    std::vector<Variant> values;
+    values.reserve(size);
+    std::srand(42);
+    for (std::size_t i = 0; i < size; ++i) {
+        values.push_back(
+            bench_types<N>::template make<Variant>(std::rand() % N, std::rand() % 4)
+        );
+    }
+    return values;
+}
+
+struct sum_visitor : boost::static_visitor<long> {
+    template <std::size_t I>
+    long operator()(const alt<I>& a) const { return a.value + I; }
+
+    template <std::size_t I, std::size_t J>
+    long operator()(const alt<I>& a, const alt<J>& b) const { return a.value * b.value + I - J; }
+};
+
+static const std::size_t values_count = 1 << 12;
+static const std::size_t rounds = 256;
+static const std::size_t operations = values_count * rounds;
+
+///////////////////////////////////////////////////////////////////////////////
+// Visitation
+
+template <std::size_t N>
+void bench_visitation(suite& s) {
+    typedef typename bench_types<N>::boost_type boost_t;
+    const std::vector<boost_t> b = make_values<N, boost_t>(values_count);
+
+    s.measure("visit_unary", boost_lib, N, operations, [&]() {
+        long r = 0;
+        for (std::size_t round = 0; round < rounds; ++round)
+            for (std::size_t i = 0; i < b.size(); ++i)
+                r += boost::apply_visitor(sum_visitor(), b[i]);
+        sink = r;
+    });
+
+    s.measure("visit_binary", boost_lib, N, operations, [&]() {
+        long r = 0;
+        for (std::size_t round = 0; round < rounds; ++round)
+            for (std::size_t i = 1; i < b.size(); ++i)
+                r += boost::apply_visitor(sum_visitor(), b[i - 1], b[i]);
+        sink = r;
+    });
+
+#if defined(VARIANT_PERF_STD_BASELINE)
+    typedef typename bench_types<N>::std_type std_t;
+    const std::vector<std_t> v = make_values<N, std_t>(values_count);
+
+    s.measure("visit_unary", std_lib, N, operations, [&]() {
+        long r = 0;
+        for (std::size_t round = 0; round < rounds; ++round)
+            for (std::size_t i = 0; i < v.size(); ++i)
+                r += std::visit(sum_visitor(), v[i]);
+        sink = r;
+    });
+
+    s.measure("visit_binary", std_lib, N, operations, [&]() {
+        long r = 0;
+        for (std::size_t round = 0; round < rounds; ++round)
+            for (std::size_t i = 1; i < v.size(); ++i)
+                r += std::visit(sum_visitor(), v[i - 1], v[i]);
+        sink = r;
+    });
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// get, comparison, hash, swap
+
+void bench_access(suite& s) {
+    const std::size_t N = 4;
+    typedef bench_types<N>::boost_type boost_t;
+    std::vector<boost_t> b = make_values<N, boost_t>(values_count);
+
+    s.measure("get", boost_lib, N, operations, [&]() {
+        long r = 0;
+        for (std::size_t round = 0; round < rounds; ++round)
+            for (std::size_t i = 0; i < b.size(); ++i)
+                if (const alt<0>* p = boost::get< alt<0> >(&b[i])) r += p->value;
+        sink = r;
+    });
+
+    s.measure("relaxed_get", boost_lib, N, operations, [&]() {
+        long r = 0;
+        for (std::size_t round = 0; round < rounds; ++round)
+            for (std::size_t i = 0; i < b.size(); ++i)
+                if (const alt<0>* p = boost::relaxed_get< alt<0> >(&b[i])) r += p->value;
+        sink = r;
+    });
+
+    s.measure("operator==", boost_lib, N, operations, [&]() {
+        long r = 0;
+        for (std::size_t round = 0; round < rounds; ++round)
+            for (std::size_t i = 1; i < b.size(); ++i)
+                r += (b[i - 1] == b[i]);
+        sink = r;
+    });
+
+    s.measure("operator<", boost_lib, N, operations, [&]() {
+        long r = 0;
+        for (std::size_t round = 0; round < rounds; ++round)
+            for (std::size_t i = 1; i < b.size(); ++i)
+                r += (b[i - 1] < b[i]);
+        sink = r;
+    });
+
+    s.measure("hash_value", boost_lib, N, operations, [&]() {
+        std::size_t r = 0;
+        for (std::size_t round = 0; round < rounds; ++round)
+            for (std::size_t i = 0; i < b.size(); ++i)
+                r += boost::hash_value(b[i]);
+        sink = static_cast<long>(r);
+    });
+
+    s.measure("swap", boost_lib, N, operations, [&]() {
+        for (std::size_t round = 0; round < rounds; ++round)
+            for (std::size_t i = 1; i < b.size(); ++i)
+                boost::swap(b[i - 1], b[i]);
+        sink = b[0].which();
+    });
+
+#if defined(VARIANT_PERF_STD_BASELINE)
+    typedef bench_types<N>::std_type std_t;
+    std::vector<std_t> v = make_values<N, std_t>(values_count);
+
+    s.measure("get", std_lib, N, operations, [&]() {
+        long r = 0;
+        for (std::size_t round = 0; round < rounds; ++round)
+            for (std::size_t i = 0; i < v.size(); ++i)
+                if (const alt<0>* p = std::get_if< alt<0> >(&v[i])) r += p->value;
+        sink = r;
+    });
+
+    s.measure("operator==", std_lib, N, operations, [&]() {
+        long r = 0;
+        for (std::size_t round = 0; round < rounds; ++round)
+            for (std::size_t i = 1; i < v.size(); ++i)
+                r += (v[i - 1] == v[i]);
+        sink = r;
+    });
+
+    s.measure("operator<", std_lib, N, operations, [&]() {
+        long r = 0;
+        for (std::size_t round = 0; round < rounds; ++round)
+            for (std::size_t i = 1; i < v.size(); ++i)
+                r += (v[i - 1] < v[i]);
+        sink = r;
+    });
+
+    s.measure("hash_value", std_lib, N, operations, [&]() {
+        std::size_t r = 0;
+        for (std::size_t round = 0; round < rounds; ++round)
+            for (std::size_t i = 0; i < v.size(); ++i)
+                r += std::hash<std_t>()(v[i]);
+        sink = static_cast<long>(r);
+    });
+
+    s.measure("swap", std_lib, N, operations, [&]() {
+        for (std::size_t round = 0; round < rounds; ++round)
+            for (std::size_t i = 1; i < v.size(); ++i)
+                std::swap(v[i - 1], v[i]);
+        sink = static_cast<long>(v[0].index());
+    });
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Cross type assignment
+
+// Copy may throw, no move constructor and no nothrow default constructor:
+// boost::variant assignment replacing it backs it up on the heap.
+struct label {
+    std::string text;
+
+    explicit label(const char* t) : text(t) {}
+    label(const label& other) : text(other.text) {}
+    label& operator=(const label& other) { text = other.text; return *this; }
+};
+
+struct amount {
+    std::string currency;
+    long value;
+
+    explicit amount(long v) : currency("EUR"), value(v) {}
+    amount(const amount& other) : currency(other.currency), value(other.value) {}
+    amount& operator=(const amount& other) { currency = other.currency; value = other.value; return *this; }
+};
+
+template <class Variant>
+void assign_alternating(std::vector<Variant>& target, const Variant& a, const Variant& b) {
+    for (std::size_t round = 0; round < rounds; ++round)
+        for (std::size_t i = 0; i < target.size(); ++i)
+            target[i] = ((i + round) & 1) ? a : b;
+}
+
+void bench_assignment(suite& s) {
+    {
+        typedef boost::variant<int, double, alt<0> > boost_t;
+        std::vector<boost_t> b(values_count);
+        const boost_t x(1.5), y(alt<0>(3));
+        s.measure("assign_cross_type_nothrow", boost_lib, 3, operations, [&]() {
+            assign_alternating(b, x, y);
+            sink = b[0].which();
+        });
+
+#if defined(VARIANT_PERF_STD_BASELINE)
+        typedef std::variant<int, double, alt<0> > std_t;
+        std::vector<std_t> v(values_count);
+        const std_t p(1.5), q(alt<0>(3));
+        s.measure("assign_cross_type_nothrow", std_lib, 3, operations, [&]() {
+            assign_alternating(v, p, q);
+            sink = static_cast<long>(v[0].index());
+        });
+#endif
+    }
+
+    {
+        typedef boost::variant<label, amount> boost_t;
+        const boost_t x(label("label")), y(amount(42));
+        std::vector<boost_t> b(values_count, x);
+        s.measure("assign_cross_type_backup", boost_lib, 2, operations, [&]() {
+            assign_alternating(b, x, y);
+            sink = b[0].which();
+        });
+
+#if defined(VARIANT_PERF_STD_BASELINE)
+        typedef std::variant<label, amount> std_t;
+        const std_t p(label("label")), q(amount(42));
+        std::vector<std_t> v(values_count, p);
+        s.measure("assign_cross_type_backup", std_lib, 2, operations, [&]() {
+            assign_alternating(v, p, q);
+            sink = static_cast<long>(v[0].index());
+        });
+#endif
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Recursive trees
+
+struct boost_binary;
+typedef boost::variant<long, boost::recursive_wrapper<boost_binary> > boost_expr;
+
+struct boost_binary {
+    boost_expr lhs;
+    boost_expr rhs;
+
+    boost_binary(boost_expr&& l, boost_expr&& r) : lhs(std::move(l)), rhs(std::move(r)) {}
+};
+
+boost_expr build_boost_tree(int depth) {
+    if (depth == 0)
+        return boost_expr(static_cast<long>(depth + 1));
+    return boost_expr(boost_binary(build_boost_tree(depth - 1), build_boost_tree(depth - 1)));
+}
+
+#if defined(VARIANT_PERF_STD_BASELINE)
+// Heap allocated deep copied value, the usual replacement of
+// recursive_wrapper for std::variant.
+template <class T>
+class box {
+    std::unique_ptr<T> p_;
+
+public:
+    box(T&& value) : p_(new T(std::move(value))) {}
+    box(const box& other) : p_(new T(*other.p_)) {}
+    box(box&& other) noexcept = default;
+    box& operator=(const box& other) { *p_ = *other.p_; return *this; }
+    box& operator=(box&& other) noexcept = default;
+    ~box() = default;
+
+    const T& get() const { return *p_; }
+};
+
+struct std_binary;
+typedef std::variant<long, box<std_binary> > std_expr;
+
+struct std_binary {
+    std_expr lhs;
+    std_expr rhs;
+};
+
+std_expr build_std_tree(int depth) {
+    if (depth == 0)
+        return std_expr(static_cast<long>(depth + 1));
+    return std_expr(box<std_binary>(std_binary{ build_std_tree(depth - 1), build_std_tree(depth - 1) }));
+}
+#endif
+
+void bench_recursive(suite& s) {
+    const int depth = 12;
+    const std::size_t nodes = (std::size_t(1) << (depth + 1)) - 1;
+    const std::size_t tree_rounds = 16;
+
+    s.measure("recursive_tree_build", boost_lib, 2, nodes * tree_rounds, [&]() {
+        for (std::size_t round = 0; round < tree_rounds; ++round) {
+            boost_expr tree = build_boost_tree(depth);
+            sink = tree.which();
+        }
+    });
+
+    {
+        const boost_expr tree = build_boost_tree(depth);
+        s.measure("recursive_tree_copy_destroy", boost_lib, 2, nodes * tree_rounds, [&]() {
+            for (std::size_t round = 0; round < tree_rounds; ++round) {
+                boost_expr copy(tree);
+                sink = copy.which();
+            }
+        });
+    }
+
+#if defined(VARIANT_PERF_STD_BASELINE)
+    s.measure("recursive_tree_build", std_lib, 2, nodes * tree_rounds, [&]() {
+        for (std::size_t round = 0; round < tree_rounds; ++round) {
+            std_expr tree = build_std_tree(depth);
+            sink = static_cast<long>(tree.index());
+        }
+    });
+
+    {
+        const std_expr tree = build_std_tree(depth);
+        s.measure("recursive_tree_copy_destroy", std_lib, 2, nodes * tree_rounds, [&]() {
+            for (std::size_t round = 0; round < tree_rounds; ++round) {
+                std_expr copy(tree);
+                sink = static_cast<long>(copy.index());
+            }
+        });
+    }
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int main (int argc, char** argv) {
+    std::string output;
+    std::string filter;
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::strcmp(argv[i], "--output") == 0)
+            output = argv[++i];
+        else if (std::strcmp(argv[i], "--filter") == 0)
+            filter = argv[++i];
+    }
+
+    suite s(filter);
+
+    bench_visitation<2>(s);
+    bench_visitation<4>(s);
+    bench_visitation<8>(s);
+    bench_visitation<16>(s);
+    bench_access(s);
+    bench_assignment(s);
+    bench_recursive(s);
+
+    if (output.empty()) {
+        s.write_json(std::cout);
+    } else {
+        std::ofstream out(output.c_str());
+        s.write_json(out);
+        if (!out) {
+            std::cerr << "Failed to write " << output << std::endl;
+            return 1;
+        }
+    }
+
+    return 0;
+}
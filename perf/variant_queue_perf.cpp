@@ -0,0 +1,171 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//
+// Testing throughput of a mailbox of variant messages with 1..16 producers
+// and as many consumers: boost::variant_queue versus a std::deque of
+// variants protected by a mutex
+//
+
+#define BOOST_ERROR_CODE_HEADER_ONLY
+#define BOOST_CHRONO_HEADER_ONLY
+#include <boost/chrono.hpp>
+
+#include <boost/variant.hpp>
+#include <boost/variant/variant_queue.hpp>
+#include <atomic>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+    struct scope {
+        typedef boost::chrono::steady_clock test_clock;
+        typedef boost::chrono::duration<double> duration_t;
+        test_clock::time_point start_;
+        const char* const message_;
+        const unsigned threads_;
+        const std::size_t operations_;
+
+        scope(const char* const message, unsigned threads, std::size_t operations)
+            : start_(test_clock::now())
+            , message_(message)
+            , threads_(threads)
+            , operations_(operations)
+        {}
+
+        ~scope() {
+            const double seconds = boost::chrono::duration_cast<duration_t>(test_clock::now() - start_).count();
+            std::cout << message_ << " producers/consumers " << threads_ << "   "
+                      << (operations_ / seconds / 1e6) << " Mmsg/s" << std::endl;
+        }
+    };
+
+struct order {
+    long long id;
+    double price;
+    int quantity;
+};
+
+struct cancel {
+    long long id;
+};
+
+typedef boost::variant<order, cancel, std::string> message_t;
+
+struct handler : boost::static_visitor<> {
+    long long sum;
+
+    handler() : sum(0) {}
+
+    void operator()(const order& o) { sum += o.quantity; }
+    void operator()(const cancel& c) { sum += c.id; }
+    void operator()(const std::string& s) { sum += static_cast<long long>(s.size()); }
+};
+
+BOOST_STATIC_CONSTANT(std::size_t, c_messages_per_producer = 200000);
+BOOST_STATIC_CONSTANT(std::size_t, c_capacity = 1024);
+
+struct locked_mailbox {
+    std::mutex mutex;
+    std::deque<message_t> queue;
+
+    void push_order(long long i) {
+        order o = { i, 1.5, 1 };
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push_back(o);
+    }
+
+    void push_cancel(long long i) {
+        cancel c = { i };
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push_back(c);
+    }
+
+    std::size_t drain(handler& h) {
+        std::size_t count = 0;
+        for (;;) {
+            message_t message;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (queue.empty()) {
+                    return count;
+                }
+                message = boost::move(queue.front());
+                queue.pop_front();
+            }
+            boost::apply_visitor(h, message);
+            ++count;
+        }
+    }
+};
+
+struct lockfree_mailbox {
+    boost::variant_queue<order, cancel, std::string> queue;
+
+    lockfree_mailbox() : queue(c_capacity) {}
+
+    void push_order(long long i) {
+        while (!queue.emplace<order>(order{ i, 1.5, 1 })) {
+            std::this_thread::yield();
+        }
+    }
+
+    void push_cancel(long long i) {
+        while (!queue.emplace<cancel>(cancel{ i })) {
+            std::this_thread::yield();
+        }
+    }
+
+    std::size_t drain(handler& h) {
+        return queue.consume_all(h);
+    }
+};
+
+template <class Mailbox>
+static void run(const char* name, unsigned threads) {
+    Mailbox mailbox;
+    const std::size_t total = threads * c_messages_per_producer;
+    std::atomic<std::size_t> consumed(0);
+    std::atomic<long long> sink(0);
+
+    scope sc(name, threads, total);
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.push_back(std::thread([&mailbox]() {
+            for (std::size_t i = 0; i < c_messages_per_producer; ++i) {
+                if (i % 4) {
+                    mailbox.push_order(static_cast<long long>(i));
+                } else {
+                    mailbox.push_cancel(static_cast<long long>(i));
+                }
+            }
+        }));
+        workers.push_back(std::thread([&mailbox, &consumed, &sink, total]() {
+            handler h;
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                const std::size_t n = mailbox.drain(h);
+                consumed += n;
+                if (!n) {
+                    std::this_thread::yield();
+                }
+            }
+            sink += h.sum;
+        }));
+    }
+    for (std::size_t t = 0; t < workers.size(); ++t) {
+        workers[t].join();
+    }
+}
+
+int main () {
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    for (unsigned threads = 1; threads <= 16; threads *= 2) {
+        run<locked_mailbox>("mutex + deque<variant>", threads);
+        run<lockfree_mailbox>("variant_queue", threads);
+    }
+}
@@ -0,0 +1,21 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/atomic_variant_too_large.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "boost/variant/atomic_variant.hpp"
+
+struct idle {};
+struct report { char text[16]; };
+
+int main() {
+    // Must fail: report does not fit into an atomic word together with which()
+    boost::atomic_variant<idle, report> state;
+    return state.which();
+}
@@ -0,0 +1,22 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/dispatcher_unbounded_handler.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "boost/variant/variant_dispatcher.hpp"
+
+struct connect { int port; };
+struct disconnect {};
+
+int main() {
+    boost::variant_dispatcher< boost::variant<connect, disconnect> > d;
+
+    // Must fail: double is not a bounded type
+    return d.has_handler<double>();
+}
@@ -0,0 +1,36 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/no_heap_backup_assignment.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_VARIANT_NO_HEAP
+
+#include "boost/variant/variant.hpp"
+
+struct may_throw {
+    may_throw() {}
+    may_throw(const may_throw&) {}
+    may_throw& operator=(const may_throw&) { return *this; }
+};
+
+struct may_throw_too {
+    may_throw_too() {}
+    may_throw_too(const may_throw_too&) {}
+    may_throw_too& operator=(const may_throw_too&) { return *this; }
+};
+
+int main() {
+    boost::variant<may_throw, may_throw_too> v;
+    const boost::variant<may_throw, may_throw_too> rhs = may_throw_too();
+
+    // Must fail: no nothrow copy, move nor fallback type, so the assignment
+    // may back up may_throw on the heap
+    v = rhs;
+    return v.which();
+}
@@ -0,0 +1,26 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/no_heap_recursive_wrapper.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_VARIANT_NO_HEAP
+
+#include "boost/variant.hpp"
+
+#include <vector>
+
+int main() {
+    // Must fail: recursive_wrapper allocates
+    typedef boost::make_recursive_variant<
+        int, std::vector<boost::recursive_variant_>
+    >::type tree_t;
+
+    tree_t tree = 1;
+    return tree.which();
+}
@@ -0,0 +1,235 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/variant_allocator_test.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "boost/variant/allocator_variant.hpp"
+#include "boost/variant/get.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include "boost/static_assert.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <scoped_allocator>
+
+// Older Boost.Config has no macro for <memory_resource>
+#if !defined(BOOST_NO_CXX17_HDR_MEMORY_RESOURCE) && !defined(BOOST_NO_CXX17_HDR_VARIANT)
+#define TEST_PMR
+#include <memory_resource>
+#endif
+
+// Counts the allocations made with each arena
+struct arena {
+    std::size_t allocations;
+};
+
+arena default_arena = { 0 };
+
+template <class T>
+struct arena_allocator {
+    typedef T value_type;
+
+    arena* a;
+
+    arena_allocator() : a(&default_arena) {}
+    explicit arena_allocator(arena& ar) : a(&ar) {}
+
+    template <class U>
+    arena_allocator(const arena_allocator<U>& other) : a(other.a) {}
+
+    T* allocate(std::size_t n) {
+        ++a->allocations;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) {
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    arena_allocator select_on_container_copy_construction() const {
+        return arena_allocator(default_arena);
+    }
+
+    template <class U>
+    struct rebind { typedef arena_allocator<U> other; };
+};
+
+template <class T, class U>
+bool operator==(const arena_allocator<T>& lhs, const arena_allocator<U>& rhs) { return lhs.a == rhs.a; }
+
+template <class T, class U>
+bool operator!=(const arena_allocator<T>& lhs, const arena_allocator<U>& rhs) { return lhs.a != rhs.a; }
+
+typedef arena_allocator<char> allocator_t;
+typedef std::basic_string<char, std::char_traits<char>, allocator_t> string_t;
+typedef std::vector<int, arena_allocator<int> > vector_t;
+typedef boost::variant<int, string_t, vector_t> variant_t;
+
+const char long_text[] = "a string too long for the small string optimization";
+
+BOOST_STATIC_ASSERT((std::uses_allocator<variant_t, allocator_t>::value));
+BOOST_STATIC_ASSERT((!std::uses_allocator<boost::variant<int, double>, allocator_t>::value));
+
+void test_variant()
+{
+    arena ar = { 0 };
+    const allocator_t alloc(ar);
+
+    // The content is constructed with the allocator
+    variant_t v(std::allocator_arg, alloc, string_t(long_text, alloc));
+    BOOST_TEST(boost::get<string_t>(v).get_allocator() == alloc);
+
+    const variant_t defaulted(std::allocator_arg, alloc);
+    BOOST_TEST_EQ(boost::get<int>(defaulted), 0);
+
+    // Converted directly, without a temporary
+    const std::size_t default_allocations = default_arena.allocations;
+    const variant_t converted(std::allocator_arg, alloc, long_text);
+    BOOST_TEST(boost::get<string_t>(converted).get_allocator() == alloc);
+    BOOST_TEST_EQ(boost::get<string_t>(converted), long_text);
+    BOOST_TEST_EQ(default_arena.allocations, default_allocations);
+
+    arena other = { 0 };
+    const allocator_t other_alloc(other);
+
+    const variant_t copy(std::allocator_arg, other_alloc, v);
+    BOOST_TEST(boost::get<string_t>(copy).get_allocator() == other_alloc);
+    BOOST_TEST_EQ(boost::get<string_t>(copy), long_text);
+    BOOST_TEST_EQ(other.allocations, 1u);
+
+    const variant_t moved(std::allocator_arg, other_alloc, std::move(v));
+    BOOST_TEST(boost::get<string_t>(moved).get_allocator() == other_alloc);
+    BOOST_TEST_EQ(boost::get<string_t>(moved), long_text);
+
+    const variant_t number(std::allocator_arg, other_alloc, 42);
+    BOOST_TEST_EQ(boost::get<int>(number), 42);
+}
+
+void test_container()
+{
+    arena ar = { 0 };
+    typedef std::scoped_allocator_adaptor<arena_allocator<variant_t> > scoped_t;
+    std::vector<variant_t, scoped_t> elements((scoped_t(arena_allocator<variant_t>(ar))));
+
+    elements.push_back(variant_t(string_t(long_text, allocator_t(default_arena))));
+    elements.push_back(variant_t(vector_t(100, 1, arena_allocator<int>(default_arena))));
+    elements.push_back(variant_t(3));
+
+    // The elements are constructed with the allocator of the container
+    BOOST_TEST(boost::get<string_t>(elements[0]).get_allocator() == allocator_t(ar));
+    BOOST_TEST(boost::get<vector_t>(elements[1]).get_allocator() == allocator_t(ar));
+    BOOST_TEST_EQ(boost::get<int>(elements[2]), 3);
+}
+
+typedef boost::allocator_variant<allocator_t, int, string_t, vector_t> allocator_variant_t;
+
+BOOST_STATIC_ASSERT((std::uses_allocator<allocator_variant_t, allocator_t>::value));
+
+void test_allocator_variant()
+{
+    arena ar = { 0 };
+    const allocator_t alloc(ar);
+
+    allocator_variant_t v(alloc);
+    BOOST_TEST_EQ(v.which(), 0);
+    BOOST_TEST(v.get_allocator() == alloc);
+
+    // Type changing assignments keep the allocator
+    v = string_t(long_text, allocator_t(default_arena));
+    BOOST_TEST_EQ(v.which(), 1);
+    BOOST_TEST(boost::get<string_t>(v.value()).get_allocator() == alloc);
+
+    v = vector_t(10, 7, arena_allocator<int>(default_arena));
+    BOOST_TEST(boost::get<vector_t>(v.value()).get_allocator() == alloc);
+
+    v = variant_t(string_t(long_text, allocator_t(default_arena)));
+    BOOST_TEST(boost::get<string_t>(v.value()).get_allocator() == alloc);
+
+    // Same type assignments reuse the content
+    const std::size_t allocations = ar.allocations;
+    v = string_t("short", allocator_t(default_arena));
+    BOOST_TEST_EQ(boost::get<string_t>(v.value()), "short");
+    BOOST_TEST(boost::get<string_t>(v.value()).get_allocator() == alloc);
+    BOOST_TEST_EQ(ar.allocations, allocations);
+
+    v = 5;
+    BOOST_TEST_EQ(boost::get<int>(v.value()), 5);
+
+    // The copy gets the allocator of select_on_container_copy_construction
+    v = long_text;
+    const allocator_variant_t copy(v);
+    BOOST_TEST(copy.get_allocator() == allocator_t(default_arena));
+    BOOST_TEST(boost::get<string_t>(copy.value()).get_allocator() == allocator_t(default_arena));
+    BOOST_TEST(copy == v);
+
+    // Assignment does not propagate the allocator
+    allocator_variant_t target(alloc);
+    target = copy;
+    BOOST_TEST(target.get_allocator() == alloc);
+    BOOST_TEST(boost::get<string_t>(target.value()).get_allocator() == alloc);
+
+    const allocator_variant_t moved(std::move(target));
+    BOOST_TEST(moved.get_allocator() == alloc);
+    BOOST_TEST(boost::get<string_t>(moved.value()).get_allocator() == alloc);
+
+    // Elements of a container use its allocator
+    typedef std::scoped_allocator_adaptor<arena_allocator<allocator_variant_t> > scoped_t;
+    std::vector<allocator_variant_t, scoped_t> elements((scoped_t(arena_allocator<allocator_variant_t>(ar))));
+    elements.push_back(copy);
+    elements.emplace_back(42);
+    BOOST_TEST(elements[0].get_allocator() == alloc);
+    BOOST_TEST(boost::get<string_t>(elements[0].value()).get_allocator() == alloc);
+    elements[1] = long_text;
+    BOOST_TEST(boost::get<string_t>(elements[1].value()).get_allocator() == alloc);
+
+    allocator_variant_t other(std::allocator_arg, alloc, 1);
+    swap(other, elements[1]);
+    BOOST_TEST_EQ(boost::get<string_t>(other.value()), long_text);
+    BOOST_TEST_EQ(boost::get<int>(elements[1].value()), 1);
+}
+
+#if defined(TEST_PMR)
+void test_pmr()
+{
+    char buffer[4096];
+    std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+    typedef boost::allocator_variant<
+        std::pmr::polymorphic_allocator<char>, int, std::pmr::string, std::pmr::vector<int>
+    > pmr_variant_t;
+
+    pmr_variant_t v{ std::pmr::polymorphic_allocator<char>(&resource) };
+    v = std::pmr::string(long_text);
+    BOOST_TEST(boost::get<std::pmr::string>(v.value()).get_allocator().resource() == &resource);
+
+    v = std::pmr::vector<int>(100, 1);
+    BOOST_TEST(boost::get<std::pmr::vector<int> >(v.value()).get_allocator().resource() == &resource);
+
+    std::pmr::vector<boost::variant<int, std::pmr::string> > elements(&resource);
+    elements.emplace_back(std::pmr::string(long_text));
+    BOOST_TEST(boost::get<std::pmr::string>(elements[0]).get_allocator().resource() == &resource);
+}
+#endif
+
+int main()
+{
+    test_variant();
+    test_container();
+    test_allocator_variant();
+#if defined(TEST_PMR)
+    test_pmr();
+#endif
+
+    return boost::report_errors();
+}
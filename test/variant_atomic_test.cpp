@@ -0,0 +1,132 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/variant_atomic_test.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "boost/variant/atomic_variant.hpp"
+#include "boost/variant/apply_visitor.hpp"
+#include "boost/variant/get.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <thread>
+#include <vector>
+
+struct idle {};
+struct running { int id; };
+struct failed { int code; };
+struct failed_long { long long code; };
+
+inline bool operator==(idle, idle) { return true; }
+inline bool operator==(running lhs, running rhs) { return lhs.id == rhs.id; }
+inline bool operator==(failed lhs, failed rhs) { return lhs.code == rhs.code; }
+inline bool operator==(failed_long lhs, failed_long rhs) { return lhs.code == rhs.code; }
+
+struct describe : boost::static_visitor<int> {
+    int operator()(idle) const { return 0; }
+    int operator()(running r) const { return 1000 + r.id; }
+    int operator()(failed f) const { return -f.code; }
+    int operator()(failed_long f) const { return -static_cast<int>(f.code); }
+};
+
+template <class Atomic, class Failed>
+void test_operations() {
+    typedef typename Atomic::value_type value_t;
+
+    Atomic a;
+    BOOST_TEST_EQ(a.which(), 0);
+    BOOST_TEST(boost::get<idle>(&static_cast<const value_t&>(a.load())));
+
+    running r = { 7 };
+    a.store(r);
+    BOOST_TEST_EQ(a.which(), 1);
+    BOOST_TEST_EQ(boost::get<running>(a.load()).id, 7);
+    BOOST_TEST_EQ(boost::apply_visitor(describe(), a), 1007);
+    BOOST_TEST_EQ(a.apply_visitor(describe(), std::memory_order_acquire), 1007);
+
+    const value_t previous = a.exchange(value_t(idle()));
+    BOOST_TEST_EQ(boost::get<running>(previous).id, 7);
+    BOOST_TEST_EQ(a.which(), 0);
+
+    // Failed CAS reports the current value
+    value_t expected = r;
+    BOOST_TEST(!a.compare_exchange_strong(expected, value_t(r)));
+    BOOST_TEST_EQ(expected.which(), 0);
+
+    BOOST_TEST(a.compare_exchange_strong(expected, value_t(r)));
+    BOOST_TEST_EQ(boost::get<running>(a.load()).id, 7);
+
+    // Equal values of different bounded types are different
+    Failed f = { 7 };
+    expected = f;
+    BOOST_TEST(!a.compare_exchange_strong(expected, value_t(idle()), std::memory_order_acq_rel, std::memory_order_acquire));
+    BOOST_TEST_EQ(expected.which(), 1);
+
+    while (!a.compare_exchange_weak(expected, value_t(f))) {}
+    BOOST_TEST_EQ(boost::apply_visitor(describe(), a), -7);
+
+    a = value_t(idle());
+    BOOST_TEST(static_cast<value_t>(a) == value_t(idle()));
+
+    const value_t initial = f;
+    const Atomic b(initial);
+    BOOST_TEST_EQ(b.which(), 2);
+}
+
+template <class Atomic>
+void test_concurrent_transitions() {
+    typedef typename Atomic::value_type value_t;
+
+    // Each thread moves the state from running{n} to running{n + 1}
+    Atomic a;
+    running zero = { 0 };
+    a.store(zero);
+
+    const int threads_count = 4;
+    const int iterations = 20000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threads_count; ++t) {
+        threads.push_back(std::thread([&a]() {
+            for (int i = 0; i < iterations; ++i) {
+                value_t expected = a.load(std::memory_order_relaxed);
+                running next;
+                do {
+                    next.id = boost::get<running>(expected).id + 1;
+                } while (!a.compare_exchange_weak(expected, value_t(next)));
+            }
+        }));
+    }
+    for (std::size_t t = 0; t < threads.size(); ++t) {
+        threads[t].join();
+    }
+
+    BOOST_TEST_EQ(boost::get<running>(a.load()).id, threads_count * iterations);
+}
+
+int main() {
+    typedef boost::atomic_variant<idle, running, failed> small_t;
+
+    BOOST_TEST_EQ(sizeof(small_t), 8u);
+    BOOST_TEST(small_t().is_lock_free());
+
+    test_operations<small_t, failed>();
+    test_concurrent_transitions<small_t>();
+
+#if defined(BOOST_VARIANT_DETAIL_CMPXCHG16B)
+    // 16 byte words: elsewhere, rejected unless lock-free
+    typedef boost::atomic_variant<idle, running, failed_long> wide_t;
+
+    BOOST_TEST_EQ(sizeof(wide_t), 16u);
+    BOOST_TEST(wide_t().is_lock_free());
+
+    test_operations<wide_t, failed_long>();
+    test_concurrent_transitions<wide_t>();
+#endif
+
+    return boost::report_errors();
+}
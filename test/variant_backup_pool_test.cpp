@@ -0,0 +1,180 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/variant_backup_pool_test.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+// Backup allocator counting the blocks it hands out
+struct counting_backup_allocator {
+    static std::atomic<int> allocations;
+    static std::atomic<int> deallocations;
+
+    static void* allocate(std::size_t size, std::size_t) {
+        ++allocations;
+        return ::operator new(size);
+    }
+
+    static void deallocate(void* p, std::size_t, std::size_t) noexcept {
+        ++deallocations;
+        ::operator delete(p);
+    }
+};
+
+std::atomic<int> counting_backup_allocator::allocations(0);
+std::atomic<int> counting_backup_allocator::deallocations(0);
+
+#define BOOST_VARIANT_BACKUP_POOL
+#define BOOST_VARIANT_BACKUP_ALLOCATOR counting_backup_allocator
+
+#include "boost/variant/variant.hpp"
+#include "boost/variant/get.hpp"
+#include "boost/variant/backup_pool.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+// Copy may throw and there is no nothrow move nor a nothrow default
+// constructible bounded type: assignments use the heap backup.
+template <std::size_t Size>
+struct may_throw {
+    int value;
+    char padding[Size];
+    static bool fail;
+
+    explicit may_throw(int v) : value(v) {}
+    may_throw(const may_throw& other) : value(other.value) {
+        if (fail)
+            throw std::runtime_error("may_throw");
+    }
+    may_throw& operator=(const may_throw& other) {
+        value = other.value;
+        return *this;
+    }
+};
+
+template <std::size_t Size>
+bool may_throw<Size>::fail = false;
+
+typedef may_throw<8> small_t;
+typedef may_throw<4096> large_t;
+
+struct named {
+    std::string name;
+
+    explicit named(const std::string& n) : name(n) {}
+    named(const named& other) : name(other.name) {}
+    named& operator=(const named& other) {
+        name = other.name;
+        return *this;
+    }
+};
+
+typedef boost::variant<small_t, named> backup_t;
+
+void test_reuse()
+{
+    const int before = counting_backup_allocator::allocations;
+    const boost::variant_backup_pool_stats stats = boost::variant_backup_pool_snapshot();
+
+    backup_t v = small_t(1);
+    const backup_t small = small_t(2);
+    const backup_t name = named("name");
+    for (int i = 0; i < 100; ++i) {
+        v = name;   // backs up small_t
+        v = small;  // backs up named
+    }
+    BOOST_TEST_EQ(boost::get<small_t>(v).value, 2);
+
+    // A block per size class, then only hits
+    const boost::variant_backup_pool_stats after = boost::variant_backup_pool_snapshot();
+    BOOST_TEST_EQ(after.hits + after.misses - stats.hits - stats.misses, 200u);
+    BOOST_TEST(after.misses - stats.misses <= 2u);
+    BOOST_TEST_EQ(static_cast<boost::uint64_t>(counting_backup_allocator::allocations - before),
+                  after.misses - stats.misses);
+    BOOST_TEST(after.cached >= 1u);
+}
+
+void test_failed_assignment()
+{
+    backup_t v = small_t(1);
+    const backup_t name = named("name");
+    const boost::variant_backup_pool_stats stats = boost::variant_backup_pool_snapshot();
+
+    // Fails with the content in the heap backup...
+    backup_t w = small_t(3);
+    w = name;
+    small_t::fail = true;
+    BOOST_TEST_THROWS(w = small_t(4), std::runtime_error);
+    small_t::fail = false;
+    BOOST_TEST_EQ(boost::get<named>(w).name, "name");
+
+    // ...then frees it to the pool
+    w = v;
+    BOOST_TEST_EQ(boost::get<small_t>(w).value, 1);
+    w = name;
+    BOOST_TEST_EQ(boost::get<named>(w).name, "name");
+
+    const boost::variant_backup_pool_stats after = boost::variant_backup_pool_snapshot();
+    BOOST_TEST(after.hits > stats.hits);
+}
+
+void test_large()
+{
+    typedef boost::variant<large_t, named> large_backup_t;
+
+    const int before = counting_backup_allocator::allocations;
+    const boost::variant_backup_pool_stats stats = boost::variant_backup_pool_snapshot();
+
+    large_backup_t v = large_t(1);
+    v = named("name");  // backs up large_t
+
+    // Not pooled: straight to the backup allocator
+    BOOST_TEST_EQ(counting_backup_allocator::allocations - before, 1);
+    const boost::variant_backup_pool_stats after = boost::variant_backup_pool_snapshot();
+    BOOST_TEST_EQ(after.hits, stats.hits);
+    BOOST_TEST_EQ(after.misses, stats.misses);
+}
+
+void test_threads()
+{
+    boost::variant_backup_pool_stats thread_stats = { 0, 0, 0, 0 };
+
+    std::thread worker([&thread_stats]() {
+        backup_t v = small_t(1);
+        for (int i = 0; i < 10; ++i) {
+            v = named("name");
+            v = small_t(i);
+        }
+        thread_stats = boost::variant_backup_pool_snapshot();
+    });
+    worker.join();
+
+    BOOST_TEST_EQ(thread_stats.hits + thread_stats.misses, 20u);
+    BOOST_TEST(thread_stats.cached >= 1u);
+
+    // The cached blocks of the thread are released at its exit
+    boost::trim_variant_backup_pool();
+    BOOST_TEST_EQ(boost::variant_backup_pool_snapshot().cached, 0u);
+    BOOST_TEST_EQ(counting_backup_allocator::allocations, counting_backup_allocator::deallocations);
+}
+
+int main()
+{
+    test_reuse();
+    test_failed_assignment();
+    test_large();
+    test_threads();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,229 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/variant_binary_codec_test.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "boost/variant/binary_codec.hpp"
+#include "boost/variant/get.hpp"
+#include "boost/variant/recursive_variant.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct point {
+    int x;
+    int y;
+};
+
+inline bool operator==(const point& lhs, const point& rhs) {
+    return lhs.x == rhs.x && lhs.y == rhs.y;
+}
+
+namespace boost {
+    template <>
+    struct variant_codec<point> {
+        static std::size_t encoded_size(const point&) {
+            return 2 * sizeof(int);
+        }
+
+        static unsigned char* encode(unsigned char* out, const point& value) {
+            out = variant_codec<int>::encode(out, value.x);
+            return variant_codec<int>::encode(out, value.y);
+        }
+
+        static const unsigned char* decode(const unsigned char* in, const unsigned char* end, point& value) {
+            in = variant_codec<int>::decode(in, end, value.x);
+            return in ? variant_codec<int>::decode(in, end, value.y) : in;
+        }
+    };
+}
+
+enum color { red, green, blue };
+
+typedef boost::variant<int, std::string, double, std::vector<int>, point, bool, color, boost::blank> var_t;
+
+std::vector<var_t> make_data() {
+    std::vector<var_t> data;
+    data.push_back(42);
+    data.push_back(std::string("hello"));
+    data.push_back(std::string(300, 'x'));
+    data.push_back(3.25);
+    data.push_back(std::vector<int>(100, 7));
+    data.push_back(std::vector<int>());
+    point p = { -1, 2 };
+    data.push_back(p);
+    data.push_back(true);
+    data.push_back(blue);
+    data.push_back(boost::blank());
+    data.push_back(std::string());
+    return data;
+}
+
+void test_round_trip() {
+    const std::vector<var_t> data = make_data();
+    unsigned char buffer[1024];
+
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        const std::size_t size = boost::encoded_variant_size(data[i]);
+        BOOST_TEST_EQ(boost::encode_variant(data[i], buffer, sizeof(buffer)), size);
+
+        var_t decoded;
+        BOOST_TEST_EQ(boost::decode_variant(decoded, buffer, size), size);
+        BOOST_TEST(decoded == data[i]);
+
+        // decoding into the content of the same type
+        var_t same = data[i];
+        BOOST_TEST_EQ(boost::decode_variant(same, buffer, size), size);
+        BOOST_TEST(same == data[i]);
+
+        // not enough input
+        for (std::size_t partial = 0; partial < size; ++partial) {
+            var_t v;
+            BOOST_TEST_EQ(boost::decode_variant(v, buffer, partial), 0u);
+        }
+
+        // not enough output
+        BOOST_TEST_EQ(boost::encode_variant(data[i], buffer, size - 1), 0u);
+    }
+}
+
+void test_format() {
+    unsigned char buffer[16];
+    BOOST_TEST_EQ(boost::encode_variant(var_t(std::string("ab")), buffer, sizeof(buffer)), 4u);
+    BOOST_TEST_EQ(buffer[0], 1); // which()
+    BOOST_TEST_EQ(buffer[1], 2); // size()
+    BOOST_TEST_EQ(buffer[2], 'a');
+    BOOST_TEST_EQ(buffer[3], 'b');
+
+    BOOST_TEST_EQ(boost::encode_variant(var_t(boost::blank()), buffer, sizeof(buffer)), 1u);
+    BOOST_TEST_EQ(buffer[0], 7);
+
+    // multibyte varint
+    BOOST_TEST_EQ(boost::encoded_variant_size(var_t(std::string(200, 'a'))), 1u + 2u + 200u);
+}
+
+void test_malformed() {
+    var_t v;
+
+    const unsigned char bad_which[] = { 8 };
+    try {
+        boost::decode_variant(v, bad_which, sizeof(bad_which));
+        BOOST_TEST(false);
+    } catch (const boost::bad_variant_decode& e) {
+        BOOST_TEST(std::strlen(e.what()) != 0);
+    }
+
+    const unsigned char bad_bool[] = { 5, 2 };
+    BOOST_TEST_THROWS(boost::decode_variant(v, bad_bool, sizeof(bad_bool)), boost::bad_variant_decode);
+
+    const unsigned char long_varint[] = {
+        0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x01
+    };
+    BOOST_TEST_THROWS(boost::decode_variant(v, long_varint, sizeof(long_varint)), boost::bad_variant_decode);
+
+    // Bits past the 64th, or else a which() of 0 followed by an int
+    const unsigned char overflowing_varint[] = {
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0, 0, 0, 0
+    };
+    BOOST_TEST_THROWS(boost::decode_variant(v, overflowing_varint, sizeof(overflowing_varint)), boost::bad_variant_decode);
+
+    // More elements than a vector may hold
+    typedef boost::variant<int, std::vector<std::string> > strings_t;
+    strings_t strings = std::vector<std::string>();
+
+    const unsigned char huge_count[] = {
+        1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40
+    };
+    BOOST_TEST_THROWS(boost::decode_variant(strings, huge_count, sizeof(huge_count)), boost::bad_variant_decode);
+
+    // More elements than the input holds: no room is made for them
+    const unsigned char truncated[] = { 1, 0xe8, 0x07, 1, 'a' };
+    BOOST_TEST_EQ(boost::decode_variant(strings, truncated, sizeof(truncated)), 0u);
+    BOOST_TEST_LT(boost::get< std::vector<std::string> >(strings).capacity(), 1000u);
+
+    // Elements with an empty encoding: the input does not bound their count
+    typedef boost::variant<int, std::vector<boost::blank> > blanks_t;
+    blanks_t blanks;
+
+    const unsigned char few_blanks[] = { 1, 3 };
+    BOOST_TEST_EQ(boost::decode_variant(blanks, few_blanks, sizeof(few_blanks)), 2u);
+    BOOST_TEST_EQ(boost::get< std::vector<boost::blank> >(blanks).size(), 3u);
+
+    const unsigned char many_blanks[] = {
+        1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x3f
+    };
+    BOOST_TEST_THROWS(boost::decode_variant(blanks, many_blanks, sizeof(many_blanks)), boost::bad_variant_decode);
+}
+
+void test_ranges() {
+    const std::vector<var_t> data = make_data();
+
+    // stream through a small buffer
+    std::vector<unsigned char> stream;
+    unsigned char buffer[512];
+    std::vector<var_t>::const_iterator it = data.begin();
+    while (it != data.end()) {
+        std::size_t written = 0;
+        it = boost::encode_variants(it, data.end(), buffer, sizeof(buffer), written);
+        if (!written) {
+            BOOST_TEST(false);
+            break;
+        }
+        stream.insert(stream.end(), buffer, buffer + written);
+    }
+
+    std::vector<var_t> decoded(data.size());
+    std::size_t consumed = 0;
+    std::vector<var_t>::iterator end = boost::decode_variants(
+        decoded.begin(), decoded.end(), &stream[0], stream.size() - 1, consumed
+    );
+    BOOST_TEST(end == decoded.end() - 1);
+
+    std::size_t consumed_tail = 0;
+    end = boost::decode_variants(
+        end, decoded.end(), &stream[consumed], stream.size() - consumed, consumed_tail
+    );
+    BOOST_TEST(end == decoded.end());
+    BOOST_TEST_EQ(consumed + consumed_tail, stream.size());
+    BOOST_TEST(decoded == data);
+}
+
+void test_recursive() {
+    typedef boost::make_recursive_variant<
+        int, std::string, std::vector<boost::recursive_variant_>
+    >::type tree_t;
+
+    std::vector<tree_t> inner;
+    inner.push_back(1);
+    inner.push_back(std::string("leaf"));
+
+    std::vector<tree_t> outer;
+    outer.push_back(inner);
+    outer.push_back(2);
+
+    const tree_t tree = outer;
+
+    std::vector<unsigned char> buffer(boost::encoded_variant_size(tree));
+    BOOST_TEST_EQ(boost::encode_variant(tree, &buffer[0], buffer.size()), buffer.size());
+
+    tree_t decoded;
+    BOOST_TEST_EQ(boost::decode_variant(decoded, &buffer[0], buffer.size()), buffer.size());
+    BOOST_TEST(decoded == tree);
+}
+
+int main() {
+    test_round_trip();
+    test_format();
+    test_malformed();
+    test_ranges();
+    test_recursive();
+    return boost::report_errors();
+}
@@ -0,0 +1,265 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/variant_boxed_test.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "boost/variant/boxed_variant.hpp"
+#include "boost/variant/get.hpp"
+#include "boost/variant/polymorphic_get.hpp"
+#include "boost/core/lightweight_test.hpp"
+#include "boost/functional/hash.hpp"
+
+#include "boost/mpl/at.hpp"
+#include "boost/static_assert.hpp"
+#include "boost/type_traits/is_same.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct ping {
+    int seq;
+
+    friend bool operator==(const ping& lhs, const ping& rhs) { return lhs.seq == rhs.seq; }
+    friend bool operator<(const ping& lhs, const ping& rhs) { return lhs.seq < rhs.seq; }
+    friend std::size_t hash_value(const ping& p) { return static_cast<std::size_t>(p.seq); }
+};
+
+struct snapshot {
+    int id;
+    char payload[512];
+
+    explicit snapshot(int i = 0) : id(i) { std::memset(payload, i, sizeof(payload)); }
+
+    friend bool operator==(const snapshot& lhs, const snapshot& rhs) { return lhs.id == rhs.id; }
+    friend bool operator<(const snapshot& lhs, const snapshot& rhs) { return lhs.id < rhs.id; }
+    friend std::size_t hash_value(const snapshot& s) { return static_cast<std::size_t>(s.id); }
+};
+
+typedef boost::boxed_variant<16, int, ping, snapshot> message_t;
+
+BOOST_STATIC_ASSERT((sizeof(message_t) < sizeof(snapshot)));
+BOOST_STATIC_ASSERT((sizeof(message_t) <= 2 * sizeof(void*)));
+BOOST_STATIC_ASSERT((boost::is_same<boost::mpl::at_c<message_t::types, 2>::type, snapshot>::value));
+BOOST_STATIC_ASSERT((boost::is_same<boost::mpl::at_c<message_t::types, 1>::type, ping>::value));
+BOOST_STATIC_ASSERT((boost::is_same<
+    boost::boxed_variant<1024, int, snapshot>, boost::variant<int, snapshot>
+>::value));
+
+struct payload_id : boost::static_visitor<int> {
+    int operator()(int i) const { return i; }
+    int operator()(const ping& p) const { return p.seq; }
+    int operator()(const snapshot& s) const { return s.id; }
+
+    template <class T, class U>
+    int operator()(const T& lhs, const U& rhs) const { return (*this)(lhs) + (*this)(rhs); }
+};
+
+void test_transparent()
+{
+    message_t m = snapshot(7);
+    BOOST_TEST_EQ(m.which(), 2);
+    BOOST_TEST(m.type() == boost::typeindex::type_id<snapshot>());
+    BOOST_TEST_EQ(boost::get<snapshot>(m).id, 7);
+    BOOST_TEST_EQ(boost::get<snapshot>(&m)->payload[511], 7);
+    BOOST_TEST_EQ(boost::relaxed_get<snapshot>(m).id, 7);
+    BOOST_TEST_EQ(boost::polymorphic_get<snapshot>(m).id, 7);
+    BOOST_TEST(!boost::get<ping>(&m));
+    BOOST_TEST_EQ(boost::apply_visitor(payload_id(), m), 7);
+
+    message_t copy = m;
+    BOOST_TEST(copy == m);
+    BOOST_TEST(&boost::get<snapshot>(copy) != &boost::get<snapshot>(m));
+    BOOST_TEST_EQ(boost::hash_value(copy), boost::hash_value(m));
+    BOOST_TEST_EQ(boost::apply_visitor(payload_id(), copy, m), 14);
+
+    boost::get<snapshot>(copy).id = 8;
+    BOOST_TEST(m < copy);
+
+    message_t moved = std::move(copy);
+    BOOST_TEST_EQ(boost::get<snapshot>(moved).id, 8);
+
+    m = ping{ 3 };
+    BOOST_TEST_EQ(boost::get<ping>(m).seq, 3);
+    BOOST_TEST(m < moved);
+
+    m.swap(moved);
+    BOOST_TEST_EQ(boost::get<snapshot>(m).id, 8);
+    BOOST_TEST_EQ(boost::get<ping>(moved).seq, 3);
+
+    m = snapshot(9);                                // same type
+    BOOST_TEST_EQ(boost::get<snapshot>(m).id, 9);
+    m = 42;
+    BOOST_TEST_EQ(boost::get<int>(m), 42);
+}
+
+void test_dense_array()
+{
+    std::vector<message_t> messages;
+    for (int i = 0; i < 100; ++i) {
+        if (i % 50 == 0)
+            messages.push_back(snapshot(i));
+        else
+            messages.push_back(ping{ i });
+    }
+
+    int sum = 0;
+    for (std::size_t i = 0; i < messages.size(); ++i)
+        sum += boost::apply_visitor(payload_id(), messages[i]);
+
+    BOOST_TEST_EQ(sum, 99 * 100 / 2);
+}
+
+static int allocations = 0;
+static int deallocations = 0;
+
+template <class T>
+struct counting_allocator {
+    typedef T value_type;
+
+    counting_allocator() {}
+    template <class U> counting_allocator(const counting_allocator<U>&) {}
+
+    T* allocate(std::size_t n) {
+        ++allocations;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) {
+        ++deallocations;
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template <class U> bool operator==(const counting_allocator<U>&) const { return true; }
+    template <class U> bool operator!=(const counting_allocator<U>&) const { return false; }
+};
+
+void test_allocator()
+{
+    typedef boost::basic_boxed_variant<
+        16, counting_allocator<void>, int, std::string, snapshot
+    > variant_t;
+
+    // types are the unboxed types, whatever their size
+    BOOST_STATIC_ASSERT((boost::is_same<boost::mpl::at_c<variant_t::types, 1>::type, std::string>::value));
+
+    {
+        variant_t v = snapshot(1);
+        BOOST_TEST_EQ(allocations, 1);
+
+        variant_t copy = v;
+        BOOST_TEST_EQ(allocations, 2);
+        BOOST_TEST(copy == v);
+
+        v = 5;
+        BOOST_TEST_EQ(deallocations, 1);
+        BOOST_TEST_EQ(boost::get<snapshot>(copy).id, 1);
+    }
+
+    BOOST_TEST_EQ(allocations, deallocations);
+}
+
+void test_boxed()
+{
+    boost::boxed<snapshot> a(snapshot(1));
+    boost::boxed<snapshot> b(snapshot(2));
+    snapshot* pa = a.get_pointer();
+
+    swap(a, b);
+    BOOST_TEST_EQ(a.get().id, 2);
+    BOOST_TEST_EQ(b.get_pointer(), pa);
+
+    a = b;
+    BOOST_TEST_EQ(a.get().id, 1);
+    BOOST_TEST(a.get_pointer() != b.get_pointer());
+
+    boost::boxed<snapshot> c(std::move(a));
+    BOOST_TEST_EQ(c.get().id, 1);
+    BOOST_TEST_EQ(a.get().id, 1);                   // still holds a value
+}
+
+// Stateful allocator over a numbered memory resource, as the std::pmr
+// allocators: Propagate selects whether it propagates on move assignment
+// and swap.
+static int resource_allocations[3] = { 0, 0, 0 };
+
+template <class T, bool Propagate>
+struct resource_allocator {
+    typedef T value_type;
+    typedef boost::integral_constant<bool, Propagate> propagate_on_container_move_assignment;
+    typedef boost::integral_constant<bool, Propagate> propagate_on_container_swap;
+
+    template <class U> struct rebind { typedef resource_allocator<U, Propagate> other; };
+
+    int resource;
+
+    explicit resource_allocator(int r) : resource(r) {}
+    template <class U> resource_allocator(const resource_allocator<U, Propagate>& other) : resource(other.resource) {}
+
+    T* allocate(std::size_t n) {
+        ++resource_allocations[resource];
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) {
+        --resource_allocations[resource];
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template <class U> bool operator==(const resource_allocator<U, Propagate>& other) const { return resource == other.resource; }
+    template <class U> bool operator!=(const resource_allocator<U, Propagate>& other) const { return resource != other.resource; }
+};
+
+template <bool Propagate>
+void test_boxed_allocator_propagation()
+{
+    typedef resource_allocator<snapshot, Propagate> allocator_t;
+    typedef boost::boxed<snapshot, allocator_t> boxed_t;
+
+    {
+        boxed_t a(snapshot(1), allocator_t(1));
+        boxed_t b(snapshot(2), allocator_t(2));
+
+        swap(a, b);
+        BOOST_TEST_EQ(a.get().id, 2);
+        BOOST_TEST_EQ(b.get().id, 1);
+        BOOST_TEST_EQ(a.get_allocator().resource, Propagate ? 2 : 1);
+        BOOST_TEST_EQ(b.get_allocator().resource, Propagate ? 1 : 2);
+
+        boxed_t c(snapshot(3), allocator_t(1));
+        a = std::move(c);
+        BOOST_TEST_EQ(a.get().id, 3);
+        BOOST_TEST_EQ(a.get_allocator().resource, 1);
+
+        boxed_t d(snapshot(4), allocator_t(2));
+        const snapshot* pd = d.get_pointer();
+        a = std::move(d);
+        BOOST_TEST_EQ(a.get().id, 4);
+        BOOST_TEST_EQ(a.get_pointer() == pd, Propagate);
+        BOOST_TEST_EQ(a.get_allocator().resource, Propagate ? 2 : 1);
+    }
+
+    BOOST_TEST_EQ(resource_allocations[1], 0);
+    BOOST_TEST_EQ(resource_allocations[2], 0);
+}
+
+int main()
+{
+    test_transparent();
+    test_dense_array();
+    test_allocator();
+    test_boxed();
+    test_boxed_allocator_propagation<true>();
+    test_boxed_allocator_propagation<false>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,165 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/variant_bulk_algorithms_test.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "boost/variant/bulk_algorithms.hpp"
+#include "boost/variant/get.hpp"
+#include "boost/variant/recursive_variant.hpp"
+#include "boost/core/lightweight_test.hpp"
+#include "boost/functional/hash.hpp"
+
+#include <list>
+#include <string>
+#include <vector>
+
+struct tick {
+    int price;
+    int volume;
+};
+
+inline bool operator==(const tick& lhs, const tick& rhs) {
+    return lhs.price == rhs.price && lhs.volume == rhs.volume;
+}
+
+inline std::size_t hash_value(const tick& t) {
+    std::size_t seed = 0;
+    boost::hash_combine(seed, t.price);
+    boost::hash_combine(seed, t.volume);
+    return seed;
+}
+
+namespace boost {
+    template <> struct is_bitwise_comparable<tick> : boost::true_type {};
+}
+
+typedef boost::variant<int, std::string, double, tick> var_t;
+
+std::vector<var_t> make_data(std::size_t size) {
+    std::vector<var_t> data;
+    for (std::size_t i = 0; i < size; ++i) {
+        switch (i % 7) {
+        case 0: case 3: data.push_back(static_cast<int>(i)); break;
+        case 1: data.push_back(std::string(i % 13, 'x')); break;
+        case 2: case 5: data.push_back(static_cast<double>(i) / 3); break;
+        default: {
+            tick t = { static_cast<int>(i), static_cast<int>(i * 2) };
+            data.push_back(t);
+        }
+        }
+    }
+    return data;
+}
+
+void test_hash_per_element() {
+    const std::vector<var_t> data = make_data(1000);
+    std::vector<std::size_t> hashes(data.size());
+
+    std::vector<std::size_t>::iterator end = boost::hash_range_variants(data.begin(), data.end(), hashes.begin());
+    BOOST_TEST(end == hashes.end());
+
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        BOOST_TEST_EQ(hashes[i], boost::hash_value(data[i]));
+    }
+}
+
+void test_hash_combined() {
+    const std::vector<var_t> data = make_data(777);
+    BOOST_TEST_EQ(boost::hash_range_variants(data.begin(), data.end()), boost::hash_range(data.begin(), data.end()));
+
+    std::size_t seed = 42;
+    std::size_t expected = 42;
+    boost::hash_range_variants(seed, data.begin(), data.end());
+    boost::hash_range(expected, data.begin(), data.end());
+    BOOST_TEST_EQ(seed, expected);
+
+    const std::list<var_t> list(data.begin(), data.end());
+    BOOST_TEST_EQ(boost::hash_range_variants(list.begin(), list.end()), boost::hash_range(data.begin(), data.end()));
+
+    BOOST_TEST_EQ(boost::hash_range_variants(data.end(), data.end()), 0u);
+}
+
+void test_equal() {
+    const std::vector<var_t> lhs = make_data(1000);
+    std::vector<var_t> rhs = lhs;
+
+    BOOST_TEST(boost::equal_ranges_variants(lhs.begin(), lhs.end(), rhs.begin()));
+    BOOST_TEST(boost::equal_ranges_variants(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+
+    rhs.pop_back();
+    BOOST_TEST(!boost::equal_ranges_variants(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+    BOOST_TEST(!boost::equal_ranges_variants(rhs.begin(), rhs.end(), lhs.begin(), lhs.end()));
+    BOOST_TEST(boost::equal_ranges_variants(rhs.begin(), rhs.end(), lhs.begin()));
+    rhs.push_back(lhs.back());
+
+    // different bounded type
+    rhs[500] = std::string("500");
+    BOOST_TEST(!boost::equal_ranges_variants(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+    rhs[500] = lhs[500];
+
+    // same bounded type, different values
+    rhs[998] = boost::get<tick>(lhs[998]);
+    boost::get<tick>(rhs[998]).volume += 1;
+    BOOST_TEST(!boost::equal_ranges_variants(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+    rhs[998] = lhs[998];
+
+    boost::get<std::string>(rhs[1]) += "y";
+    BOOST_TEST(!boost::equal_ranges_variants(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+    rhs[1] = lhs[1];
+
+    BOOST_TEST(boost::equal_ranges_variants(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+}
+
+void test_recursive() {
+    typedef boost::make_recursive_variant<
+        int, std::vector<boost::recursive_variant_>
+    >::type tree_t;
+
+    std::vector<tree_t> leafs;
+    leafs.push_back(1);
+    leafs.push_back(2);
+
+    std::vector<tree_t> data;
+    data.push_back(3);
+    data.push_back(leafs);
+    data.push_back(4);
+
+    std::vector<std::size_t> hashes(data.size());
+    boost::hash_range_variants(data.begin(), data.end(), hashes.begin());
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        BOOST_TEST_EQ(hashes[i], boost::hash_value(data[i]));
+    }
+
+    const std::vector<tree_t> copy = data;
+    BOOST_TEST(boost::equal_ranges_variants(data.begin(), data.end(), copy.begin(), copy.end()));
+}
+
+void test_references() {
+    int i = 1;
+    std::string s = "reference";
+    typedef boost::variant<int&, std::string&> ref_t;
+
+    std::vector<ref_t> data;
+    data.push_back(ref_t(i));
+    data.push_back(ref_t(s));
+
+    std::vector<std::size_t> hashes(data.size());
+    boost::hash_range_variants(data.begin(), data.end(), hashes.begin());
+    BOOST_TEST_EQ(hashes[0], boost::hash_value(data[0]));
+    BOOST_TEST_EQ(hashes[1], boost::hash_value(data[1]));
+}
+
+int main() {
+    test_hash_per_element();
+    test_hash_combined();
+    test_equal();
+    test_recursive();
+    test_references();
+    return boost::report_errors();
+}
@@ -0,0 +1,198 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/variant_charconv_test.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "boost/variant/charconv.hpp"
+#include "boost/variant/get.hpp"
+#include "boost/mpl/vector.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string>
+
+struct point {
+    int x;
+    int y;
+
+    point() : x(0), y(0) {}
+};
+
+namespace boost {
+    template <>
+    struct variant_chars<point> {
+        static char* to_chars(char* first, char* last, const point& value) {
+            first = variant_chars<int>::to_chars(first, last, value.x);
+            if (!first || first == last) return nullptr;
+            *first++ = ':';
+            return variant_chars<int>::to_chars(first, last, value.y);
+        }
+
+        static bool from_chars(const char* first, const char* last, point& value) {
+            const char* colon = std::find(first, last, ':');
+            return colon != last
+                && variant_chars<int>::from_chars(first, colon, value.x)
+                && variant_chars<int>::from_chars(colon + 1, last, value.y);
+        }
+    };
+}
+
+typedef boost::variant<int, double, std::string> csv_t;
+
+template <class Variant>
+std::string format(const Variant& v) {
+    char buffer[128];
+    const char* end = boost::format_to(buffer, v);
+    BOOST_TEST(end);
+    return end ? std::string(static_cast<const char*>(buffer), end) : std::string();
+}
+
+template <class Variant>
+bool parse(const char* text, Variant& v) {
+    return boost::parse_variant(text, text + std::strlen(text), v);
+}
+
+void test_format() {
+    BOOST_TEST_EQ(format(csv_t(42)), "42");
+    BOOST_TEST_EQ(format(csv_t(-7)), "-7");
+    BOOST_TEST_EQ(format(csv_t(0.5)), "0.5");
+    BOOST_TEST_EQ(format(csv_t(-2.5)), "-2.5");
+    BOOST_TEST_EQ(format(csv_t(std::string("text"))), "text");
+
+    typedef boost::variant<bool, char, boost::blank, long long, unsigned short, point> other_t;
+    BOOST_TEST_EQ(format(other_t(true)), "true");
+    BOOST_TEST_EQ(format(other_t(false)), "false");
+    BOOST_TEST_EQ(format(other_t('x')), "x");
+    BOOST_TEST_EQ(format(other_t()), "false");
+    BOOST_TEST_EQ(format(other_t(boost::blank())), "");
+    BOOST_TEST_EQ(format(other_t((std::numeric_limits<long long>::min)())), "-9223372036854775808");
+    BOOST_TEST_EQ(format(other_t(static_cast<unsigned short>(65535))), "65535");
+
+    point p;
+    p.x = 3;
+    p.y = -4;
+    BOOST_TEST_EQ(format(other_t(p)), "3:-4");
+
+    // Nested variants
+    typedef boost::variant<csv_t, boost::blank> nested_t;
+    BOOST_TEST_EQ(format(nested_t(csv_t(1.5))), "1.5");
+
+    // Buffer too small
+    char small[3];
+    BOOST_TEST(!boost::format_to(small, csv_t(1234)));
+    BOOST_TEST(!boost::format_to(small, csv_t(std::string("long"))));
+    BOOST_TEST(boost::format_to(small, small + 2, csv_t(12)) == small + 2);
+}
+
+void test_floating_round_trip() {
+    const double values[] = {
+        0.1, 1.0 / 3, 2.0 / 3, 1e-300, 1.7976931348623157e308, 5e-324, 123456789.125, -1.25e10
+    };
+
+    for (std::size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i) {
+        const std::string text = format(csv_t(values[i]));
+        csv_t parsed;
+        BOOST_TEST(parse(text.c_str(), parsed));
+        BOOST_TEST(boost::get<double>(&parsed));
+        if (const double* d = boost::get<double>(&parsed)) {
+            BOOST_TEST_EQ(*d, values[i]);
+        }
+    }
+
+    typedef boost::variant<float> float_t;
+    const std::string text = format(float_t(0.1f));
+    float_t parsed;
+    BOOST_TEST(parse(text.c_str(), parsed));
+    BOOST_TEST_EQ(boost::get<float>(parsed), 0.1f);
+}
+
+void test_parse() {
+    csv_t v;
+    BOOST_TEST(parse("123", v));
+    BOOST_TEST_EQ(boost::get<int>(v), 123);
+
+    BOOST_TEST(parse("-2147483648", v));
+    BOOST_TEST_EQ(boost::get<int>(v), (std::numeric_limits<int>::min)());
+
+    // Overflows int, parsed as double
+    BOOST_TEST(parse("2147483648", v));
+    BOOST_TEST_EQ(boost::get<double>(v), 2147483648.0);
+
+    BOOST_TEST(parse("12.5", v));
+    BOOST_TEST_EQ(boost::get<double>(v), 12.5);
+
+    BOOST_TEST(parse("1e3", v));
+    BOOST_TEST_EQ(boost::get<double>(v), 1000.0);
+
+    // Falls back on std::string
+    BOOST_TEST(parse("12a", v));
+    BOOST_TEST_EQ(boost::get<std::string>(v), "12a");
+    BOOST_TEST(parse(" 12", v));
+    BOOST_TEST_EQ(boost::get<std::string>(v), " 12");
+    BOOST_TEST(parse("+12", v));
+    BOOST_TEST_EQ(boost::get<std::string>(v), "+12");
+    BOOST_TEST(parse("", v));
+    BOOST_TEST_EQ(boost::get<std::string>(v), "");
+
+    // Failure does not modify the variant
+    typedef boost::variant<int, bool> strict_t;
+    strict_t s(5);
+    BOOST_TEST(!parse("five", s));
+    BOOST_TEST_EQ(boost::get<int>(s), 5);
+    BOOST_TEST(!parse("", s));
+    BOOST_TEST(!parse("-", s));
+    BOOST_TEST(parse("true", s));
+    BOOST_TEST_EQ(boost::get<bool>(s), true);
+
+    typedef boost::variant<unsigned char, signed char> small_t;
+    small_t sm;
+    BOOST_TEST(parse("255", sm));
+    BOOST_TEST_EQ(boost::get<unsigned char>(sm), 255);
+    BOOST_TEST(parse("-128", sm));
+    BOOST_TEST_EQ(boost::get<signed char>(sm), -128);
+    BOOST_TEST(!parse("256", sm));
+    BOOST_TEST(!parse("-129", sm));
+
+    typedef boost::variant<boost::blank, point, int> blank_t;
+    blank_t b(1);
+    BOOST_TEST(parse("", b));
+    BOOST_TEST(boost::get<boost::blank>(&b));
+    BOOST_TEST(parse("1:2", b));
+    BOOST_TEST_EQ(boost::get<point>(b).y, 2);
+}
+
+void test_parse_order() {
+    typedef boost::mpl::vector<double, int, std::string> double_first_t;
+
+    const char text[] = "17";
+    csv_t v;
+    BOOST_TEST((boost::parse_variant<csv_t, double_first_t>(text, text + 2, v)));
+    BOOST_TEST_EQ(boost::get<double>(v), 17.0);
+
+    typedef boost::mpl::vector<int> ints_only_t;
+    BOOST_TEST((boost::parse_variant<csv_t, ints_only_t>("42")) == csv_t(42));
+    BOOST_TEST_THROWS((boost::parse_variant<csv_t, ints_only_t>("4.2")), boost::bad_variant_parse);
+
+    BOOST_TEST(boost::parse_variant<csv_t>(std::string("4.25")) == csv_t(4.25));
+    BOOST_TEST(boost::parse_variant<csv_t>("word") == csv_t(std::string("word")));
+
+    typedef boost::variant<int, double> numbers_t;
+    BOOST_TEST_THROWS(boost::parse_variant<numbers_t>("word"), boost::bad_variant_parse);
+}
+
+int main() {
+    test_format();
+    test_floating_round_trip();
+    test_parse();
+    test_parse_order();
+
+    return boost::report_errors();
+}
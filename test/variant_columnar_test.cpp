@@ -0,0 +1,229 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/variant_columnar_test.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "boost/variant/columnar.hpp"
+#include "boost/variant/apply_visitor.hpp"
+#include "boost/variant/get.hpp"
+#include "boost/variant/static_visitor.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct tick {
+    boost::int64_t time;
+    double price;
+};
+
+struct quote {
+    boost::int64_t time;
+    double bid;
+    double ask;
+    int size;
+};
+
+inline bool operator==(const tick& lhs, const tick& rhs) {
+    return lhs.time == rhs.time && lhs.price == rhs.price;
+}
+
+inline bool operator==(const quote& lhs, const quote& rhs) {
+    return lhs.time == rhs.time && lhs.bid == rhs.bid && lhs.ask == rhs.ask && lhs.size == rhs.size;
+}
+
+typedef boost::variant<boost::int64_t, double, tick, quote> var_t;
+
+std::vector<var_t> make_data(std::size_t count) {
+    std::vector<var_t> data;
+    for (std::size_t i = 0; i < count; ++i) {
+        const boost::int64_t t = static_cast<boost::int64_t>(i);
+        switch ((i * 7 + i / 3) % 5) {
+        case 0: data.push_back(t); break;
+        case 1: data.push_back(t * 0.5); break;
+        case 2: { tick v = { t, t * 0.25 }; data.push_back(v); break; }
+        default: { quote v = { t, t * 0.25, t * 0.5, static_cast<int>(i) }; data.push_back(v); break; }
+        }
+    }
+    return data;
+}
+
+// Storage aligned for all the bounded types
+struct buffer {
+    std::vector<boost::uint64_t> storage;
+    std::size_t size;
+
+    explicit buffer(const std::string& bytes)
+        : storage(bytes.size() / sizeof(boost::uint64_t) + 2)
+        , size(bytes.size())
+    {
+        std::memcpy(&storage[0], bytes.data(), bytes.size());
+    }
+
+    unsigned char* data() {
+        return reinterpret_cast<unsigned char*>(&storage[0]);
+    }
+};
+
+std::string write(const std::vector<var_t>& data) {
+    std::ostringstream os;
+    boost::write_columnar_variants(data.begin(), data.end(), os);
+    BOOST_TEST(os.good());
+    return os.str();
+}
+
+struct equal_to_variant : boost::static_visitor<bool> {
+    const var_t& expected;
+
+    explicit equal_to_variant(const var_t& v) : expected(v) {}
+
+    template <class T>
+    bool operator()(const T& value) const {
+        const T* p = boost::get<T>(&expected);
+        return p && *p == value;
+    }
+};
+
+struct summer : boost::static_visitor<> {
+    double sum;
+
+    summer() : sum(0) {}
+
+    void operator()(boost::int64_t v) { sum += static_cast<double>(v); }
+    void operator()(double v) { sum += v; }
+    void operator()(const tick& v) { sum += v.price; }
+    void operator()(const quote& v) { sum += v.bid + v.ask; }
+};
+
+void test_round_trip(std::size_t count) {
+    const std::vector<var_t> data = make_data(count);
+    buffer buf(write(data));
+
+    const boost::columnar_variants<var_t> view(buf.data(), buf.size);
+    BOOST_TEST_EQ(view.size(), data.size());
+    BOOST_TEST_EQ(view.empty(), data.empty());
+
+    std::size_t i = 0;
+    summer s1;
+    for (boost::columnar_variants<var_t>::const_iterator it = view.begin(); it != view.end(); ++it, ++i) {
+        BOOST_TEST_EQ((*it).which(), data[i].which());
+        BOOST_TEST(boost::apply_visitor(equal_to_variant(data[i]), *it));
+        boost::apply_visitor(s1, *it);
+    }
+    BOOST_TEST_EQ(i, data.size());
+
+    summer s2;
+    for (i = 0; i < data.size(); ++i) {
+        BOOST_TEST_EQ(view.which(i), data[i].which());
+        BOOST_TEST(boost::apply_visitor(equal_to_variant(data[i]), view[i]));
+        BOOST_TEST(view[i].value() == data[i]);
+        boost::apply_visitor(s2, data[i]);
+    }
+    BOOST_TEST_EQ(s1.sum, s2.sum);
+
+    std::size_t ticks = 0;
+    for (i = 0; i < data.size(); ++i) {
+        if (const tick* p = boost::get<tick>(&data[i])) {
+            BOOST_TEST(view.column_begin<2>() + ticks != view.column_end<2>());
+            BOOST_TEST(view.column_begin<2>()[ticks] == *p);
+            ++ticks;
+        }
+    }
+    BOOST_TEST(view.column_begin<2>() + ticks == view.column_end<2>());
+
+#ifndef BOOST_NO_CXX14_DECLTYPE_AUTO
+    if (!data.empty()) {
+        const double d = boost::apply_visitor([](const auto& v) { return sizeof(v) * 1.0; }, view[0]);
+        BOOST_TEST_EQ(d, boost::apply_visitor([](const auto& v) { return sizeof(v) * 1.0; }, data[0]));
+    }
+#endif
+}
+
+void test_format() {
+    std::vector<var_t> data;
+    data.push_back(boost::int64_t(5));
+    data.push_back(2.0);
+    data.push_back(boost::int64_t(7));
+
+    const std::string bytes = write(data);
+    BOOST_TEST_EQ(bytes.compare(0, 8, "BVCOLMN1"), 0);
+
+    buffer buf(bytes);
+    const boost::columnar_variants<var_t> view(buf.data(), buf.size);
+    BOOST_TEST_EQ(view.column_end<0>() - view.column_begin<0>(), 2);
+    BOOST_TEST_EQ(view.column_begin<0>()[1], 7);
+    BOOST_TEST_EQ(view.column_end<1>() - view.column_begin<1>(), 1);
+    BOOST_TEST(view.column_begin<2>() == view.column_end<2>());
+
+    // Payload columns are 64 bytes aligned relative to the data
+    const unsigned char* column0 = reinterpret_cast<const unsigned char*>(view.column_begin<0>());
+    const unsigned char* column1 = reinterpret_cast<const unsigned char*>(view.column_begin<1>());
+    BOOST_TEST_EQ((column0 - buf.data()) % 64, 0);
+    BOOST_TEST_EQ((column1 - buf.data()) % 64, 0);
+}
+
+void test_malformed() {
+    std::vector<var_t> data = make_data(300);
+    const std::string bytes = write(data);
+
+    {
+        buffer buf(bytes);
+        buf.data()[0] = 'X';
+        BOOST_TEST_THROWS(boost::columnar_variants<var_t>(buf.data(), buf.size), boost::bad_variant_decode);
+    }
+    {
+        buffer buf(bytes);
+        BOOST_TEST_THROWS(boost::columnar_variants<var_t>(buf.data(), buf.size - 1), boost::bad_variant_decode);
+        BOOST_TEST_THROWS(boost::columnar_variants<var_t>(buf.data(), 16), boost::bad_variant_decode);
+    }
+    {
+        // Different set of bounded types
+        typedef boost::variant<boost::int64_t, double, tick, int> other_t;
+        buffer buf(bytes);
+        BOOST_TEST_THROWS(boost::columnar_variants<other_t>(buf.data(), buf.size), boost::bad_variant_decode);
+    }
+    {
+        // Misaligned data
+        std::vector<boost::uint64_t> storage(bytes.size() / sizeof(boost::uint64_t) + 2);
+        unsigned char* p = reinterpret_cast<unsigned char*>(&storage[0]) + 1;
+        std::memcpy(p, bytes.data(), bytes.size());
+        BOOST_TEST_THROWS(boost::columnar_variants<var_t>(p, bytes.size()), boost::bad_variant_decode);
+    }
+    {
+        // Corrupted tags are reported on access
+        buffer buf(bytes);
+        const std::size_t tags_offset = 40 + 4 * 24;
+        buf.data()[tags_offset + 10] = 200;
+        buf.data()[tags_offset + 11] = 3;
+        const boost::columnar_variants<var_t> view(buf.data(), buf.size);
+        BOOST_TEST_THROWS(view[10], boost::bad_variant_decode);
+        (void)view[9];
+
+        boost::columnar_variants<var_t>::const_iterator it = view.begin();
+        for (int i = 0; i < 10; ++i, ++it) {
+            (void)*it;
+        }
+        BOOST_TEST_THROWS(*it, boost::bad_variant_decode);
+    }
+}
+
+int main() {
+    test_round_trip(0);
+    test_round_trip(1);
+    test_round_trip(63);
+    test_round_trip(64);
+    test_round_trip(65);
+    test_round_trip(1000);
+    test_format();
+    test_malformed();
+
+    return boost::report_errors();
+}
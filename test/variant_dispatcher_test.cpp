@@ -0,0 +1,144 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/variant_dispatcher_test.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "boost/variant/variant_dispatcher.hpp"
+#include "boost/variant/recursive_wrapper.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+struct connect { int port; };
+struct disconnect {};
+struct payload { std::string data; };
+
+typedef boost::variant<connect, disconnect, payload, int> event_t;
+
+struct counting_handler {
+    int* counter;
+
+    void operator()(const disconnect&) const { ++*counter; }
+};
+
+void test_dispatch() {
+    boost::variant_dispatcher<event_t> d;
+    int connects = 0;
+    int disconnects = 0;
+    std::string received;
+
+    BOOST_TEST(!d.has_handler<connect>());
+    BOOST_TEST(!d.has_default());
+
+    d.on<connect>([&connects](const connect& c) { connects += c.port; });
+    d.on<disconnect>(counting_handler{ &disconnects });
+    d.on<payload>([&received](const payload& p) { received += p.data; });
+
+    BOOST_TEST(d.has_handler<connect>());
+    BOOST_TEST(!d.has_handler<int>());
+
+    d.dispatch(connect{ 80 });
+    d(event_t(disconnect()));
+    d.dispatch(payload{ "abc" });
+    BOOST_TEST_EQ(connects, 80);
+    BOOST_TEST_EQ(disconnects, 1);
+    BOOST_TEST_EQ(received, "abc");
+
+    // No handler for int and no default handler
+    BOOST_TEST_THROWS(d.dispatch(42), boost::bad_visit);
+
+    int unhandled = 0;
+    d.on_default([&unhandled](const event_t& e) { unhandled += e.which(); });
+    BOOST_TEST(d.has_default());
+    d.dispatch(42);
+    BOOST_TEST_EQ(unhandled, 3);
+
+    // Replacing and resetting handlers
+    d.on<connect>([&connects](const connect&) { connects = -1; });
+    d.dispatch(connect{ 1 });
+    BOOST_TEST_EQ(connects, -1);
+
+    d.reset<payload>();
+    BOOST_TEST(!d.has_handler<payload>());
+    d.dispatch(payload{ "def" });
+    BOOST_TEST_EQ(received, "abc");
+    BOOST_TEST_EQ(unhandled, 5);
+}
+
+void test_result_and_ranges() {
+    boost::variant_dispatcher<event_t, int> d;
+    d.on<connect>([](const connect& c) { return c.port; });
+    d.on<int>([](int i) { return i * 2; });
+    d.on_default([](const event_t&) { return 0; });
+
+    std::vector<event_t> events;
+    events.push_back(connect{ 10 });
+    events.push_back(disconnect());
+    events.push_back(21);
+    events.push_back(payload{ "x" });
+
+    std::vector<int> results(events.size());
+    std::transform(events.begin(), events.end(), results.begin(), boost::apply_dispatcher(d));
+    BOOST_TEST_EQ(results[0], 10);
+    BOOST_TEST_EQ(results[1], 0);
+    BOOST_TEST_EQ(results[2], 42);
+    BOOST_TEST_EQ(results[3], 0);
+
+    int total = 0;
+    std::for_each(events.begin(), events.end(), [&](const event_t& e) { total += d(e); });
+    BOOST_TEST_EQ(total, 52);
+}
+
+struct tracked {
+    static int alive;
+
+    tracked() { ++alive; }
+    tracked(const tracked&) { ++alive; }
+    ~tracked() { --alive; }
+
+    template <class T>
+    void operator()(const T&) const {}
+};
+int tracked::alive = 0;
+
+struct node;
+typedef boost::variant<int, boost::recursive_wrapper<node> > tree_t;
+struct node { tree_t left; tree_t right; };
+
+void test_storage() {
+    {
+        boost::variant_dispatcher<event_t> d;
+        d.on_default(tracked());
+        d.on<int>(tracked());
+        BOOST_TEST_EQ(tracked::alive, 2);
+        d.on<int>(tracked());
+        BOOST_TEST_EQ(tracked::alive, 2);
+        d.reset<int>();
+        BOOST_TEST_EQ(tracked::alive, 1);
+    }
+    BOOST_TEST_EQ(tracked::alive, 0);
+
+    // Handlers of recursive types receive the unwrapped value
+    boost::variant_dispatcher<tree_t, int> d;
+    d.on<int>([](int i) { return i; });
+    d.on<node>([](const node& n) { return n.left.which() + n.right.which() + 100; });
+    BOOST_TEST_EQ(d.dispatch(tree_t(7)), 7);
+    BOOST_TEST_EQ(d.dispatch(tree_t(node{ tree_t(1), tree_t(2) })), 100);
+}
+
+int main() {
+    test_dispatch();
+    test_result_and_ranges();
+    test_storage();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,160 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/variant_flatten_test.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "boost/variant/flatten_variant.hpp"
+#include "boost/variant/get.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include "boost/static_assert.hpp"
+#include "boost/type_traits/is_same.hpp"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+struct heartbeat { int seq; };
+struct order { char side; long quantity; };
+struct cancel { long id; };
+
+typedef boost::variant<char, long> scalar_t;
+typedef boost::variant<order, cancel> command_t;
+typedef boost::variant<heartbeat, scalar_t, command_t, std::string> message_t;
+typedef boost::flatten_variant<message_t>::type flat_t;
+
+BOOST_STATIC_ASSERT((boost::is_same<
+    flat_t, boost::variant<heartbeat, char, long, order, cancel, std::string>
+>::value));
+
+// Repeated leaves are removed, deeper levels are flattened too
+BOOST_STATIC_ASSERT((boost::is_same<
+    boost::flatten_variant< boost::variant<int, boost::variant<char, boost::variant<int, double> > > >::type,
+    boost::variant<int, char, double>
+>::value));
+
+// A flat variant is its own flat variant
+BOOST_STATIC_ASSERT((boost::is_same<boost::flatten_variant<flat_t>::type, flat_t>::value));
+
+// One discriminator instead of three
+BOOST_STATIC_ASSERT((sizeof(flat_t) <= sizeof(message_t)));
+
+struct describe : boost::static_visitor<std::string> {
+    std::string operator()(const heartbeat&) const { return "heartbeat"; }
+    std::string operator()(char) const { return "char"; }
+    std::string operator()(long) const { return "long"; }
+    std::string operator()(const order&) const { return "order"; }
+    std::string operator()(const cancel&) const { return "cancel"; }
+    std::string operator()(const std::string& s) const { return s; }
+};
+
+struct double_quantity : boost::static_visitor<> {
+    void operator()(order& o) const { o.quantity *= 2; }
+
+    template <class T>
+    void operator()(T&) const {}
+};
+
+void test_flat_visit()
+{
+    message_t m = heartbeat{ 1 };
+    BOOST_TEST_EQ(boost::flat_visit(describe(), m), "heartbeat");
+
+    m = scalar_t(5L);
+    BOOST_TEST_EQ(boost::flat_visit(describe(), m), "long");
+
+    m = command_t(cancel{ 2 });
+    const message_t& cm = m;
+    BOOST_TEST_EQ(boost::flat_visit(describe(), cm), "cancel");
+
+    m = std::string("text");
+    BOOST_TEST_EQ(boost::flat_visit(describe(), m), "text");
+
+    // Mutating visitation of a nested leaf
+    m = command_t(order{ 'b', 10 });
+    double_quantity doubler;
+    boost::flat_visit(doubler, m);
+    BOOST_TEST_EQ(boost::get<order>(boost::get<command_t>(m)).quantity, 20);
+
+    // Flat variants are visited directly
+    flat_t f = order{ 's', 1 };
+    BOOST_TEST_EQ(boost::flat_visit(describe(), f), "order");
+}
+
+void test_conversions()
+{
+    std::vector<message_t> messages;
+    messages.push_back(heartbeat{ 1 });
+    messages.push_back(scalar_t('c'));
+    messages.push_back(scalar_t(7L));
+    messages.push_back(command_t(order{ 'b', 3 }));
+    messages.push_back(command_t(cancel{ 4 }));
+    messages.push_back(std::string("text"));
+
+    for (std::size_t i = 0; i < messages.size(); ++i) {
+        const flat_t flat = boost::to_flat_variant(messages[i]);
+        BOOST_TEST_EQ(boost::apply_visitor(describe(), flat), boost::flat_visit(describe(), messages[i]));
+
+        const message_t nested = boost::from_flat_variant<message_t>(flat);
+        BOOST_TEST_EQ(nested.which(), messages[i].which());
+        BOOST_TEST_EQ(boost::flat_visit(describe(), nested), boost::flat_visit(describe(), messages[i]));
+    }
+
+    const flat_t flat = boost::to_flat_variant(messages[3]);
+    BOOST_TEST_EQ(flat.which(), 3);
+    BOOST_TEST_EQ(boost::get<order>(flat).quantity, 3);
+
+    const message_t nested = boost::from_flat_variant<message_t>(flat_t(7L));
+    BOOST_TEST_EQ(boost::get<long>(boost::get<scalar_t>(nested)), 7);
+}
+
+void test_move()
+{
+    const std::string text(100, 'x');
+    message_t m = text;
+
+    flat_t flat = boost::to_flat_variant(std::move(m));
+    BOOST_TEST_EQ(boost::get<std::string>(flat), text);
+    BOOST_TEST(boost::get<std::string>(m).empty());   // moved from
+
+    message_t back = boost::from_flat_variant<message_t>(std::move(flat));
+    BOOST_TEST_EQ(boost::get<std::string>(back), text);
+    BOOST_TEST(boost::get<std::string>(flat).empty());
+
+    // Lvalues are copied
+    flat_t copy = boost::to_flat_variant(back);
+    BOOST_TEST_EQ(boost::get<std::string>(back), text);
+    message_t copy_back = boost::from_flat_variant<message_t>(copy);
+    BOOST_TEST_EQ(boost::get<std::string>(copy), text);
+    BOOST_TEST_EQ(boost::get<std::string>(copy_back), text);
+}
+
+void test_repeated_leaf()
+{
+    typedef boost::variant<int, boost::variant<double, int> > repeated_t;
+    typedef boost::flatten_variant<repeated_t>::type repeated_flat_t;
+
+    // The inner int converts back into the outer one
+    const repeated_t inner = boost::variant<double, int>(3);
+    const repeated_flat_t flat = boost::to_flat_variant(inner);
+    BOOST_TEST_EQ(boost::get<int>(flat), 3);
+    BOOST_TEST_EQ(boost::from_flat_variant<repeated_t>(flat).which(), 0);
+
+    BOOST_TEST_EQ(boost::from_flat_variant<repeated_t>(repeated_flat_t(1.5)).which(), 1);
+}
+
+int main()
+{
+    test_flat_visit();
+    test_conversions();
+    test_move();
+    test_repeated_leaf();
+
+    return boost::report_errors();
+}
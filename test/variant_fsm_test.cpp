@@ -0,0 +1,149 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/variant_fsm_test.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "boost/variant/variant_fsm.hpp"
+#include "boost/variant/get.hpp"
+#include "boost/blank.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// States
+struct idle {};
+
+struct handshaking {
+    std::string peer;
+    int attempts;
+};
+
+struct established {
+    std::string peer;
+    std::vector<std::string> received;
+};
+
+// Events
+struct connect { std::string peer; };
+struct ack {};
+struct message { std::string text; };
+struct reset {};
+
+typedef boost::variant<idle, handshaking, established> state_t;
+typedef boost::variant<connect, ack, message, reset> event_t;
+
+struct session {
+    int moves;
+
+    session() : moves(0) {}
+
+    handshaking operator()(idle&&, const connect& e) {
+        handshaking result = { e.peer, 1 };
+        return result;
+    }
+
+    established operator()(handshaking&& s, const ack&) {
+        established result;
+        result.peer = std::move(s.peer);
+        ++moves;
+        return result;
+    }
+
+    established operator()(established&& s, const message& e) {
+        s.received.push_back(e.text);
+        return std::move(s);
+    }
+
+    template <class State>
+    idle operator()(State&&, const reset&) {
+        return idle();
+    }
+};
+
+typedef boost::variant_fsm<state_t, event_t, session, true> session_fsm;
+
+void test_transitions() {
+    session_fsm fsm((idle()));
+    BOOST_TEST_EQ(fsm.which(), 0);
+
+    // No transition from idle on ack
+    BOOST_TEST(!fsm.process(ack()));
+    BOOST_TEST(!fsm.process(event_t(message())));
+    BOOST_TEST_EQ(fsm.which(), 0);
+
+    connect c = { "peer" };
+    BOOST_TEST(fsm.process(c));
+    BOOST_TEST_EQ(boost::get<handshaking>(fsm.state()).peer, "peer");
+    BOOST_TEST_EQ(boost::get<handshaking>(fsm.state()).attempts, 1);
+
+    BOOST_TEST(fsm.process(event_t(ack())));
+    BOOST_TEST_EQ(boost::get<established>(fsm.state()).peer, "peer");
+    BOOST_TEST_EQ(fsm.transitions().moves, 1);
+
+    message m = { "hello" };
+    BOOST_TEST(fsm.process(m));
+    m.text = "world";
+    BOOST_TEST(fsm.process(event_t(m)));
+    const established& e = boost::get<established>(fsm.state());
+    BOOST_TEST_EQ(e.received.size(), 2u);
+    BOOST_TEST_EQ(e.received[1], "world");
+
+    BOOST_TEST(!fsm.process(c));
+    BOOST_TEST(fsm.process(reset()));
+    BOOST_TEST_EQ(fsm.which(), 0);
+
+    BOOST_TEST_EQ(fsm.transition_count(0, 0), 1u); // idle + connect
+    BOOST_TEST_EQ(fsm.transition_count(1, 1), 1u); // handshaking + ack
+    BOOST_TEST_EQ(fsm.transition_count(2, 2), 2u); // established + message
+    BOOST_TEST_EQ(fsm.transition_count(2, 3), 1u); // established + reset
+    BOOST_TEST_EQ(fsm.transition_count(0, 1), 0u); // idle + ack
+}
+
+struct throwing_session {
+    handshaking operator()(idle&&, const connect& e) {
+        if (e.peer.empty()) throw std::runtime_error("no peer");
+        handshaking result = { e.peer, 1 };
+        return result;
+    }
+
+    established operator()(handshaking&&, const ack&) {
+        throw std::runtime_error("ack");
+    }
+};
+
+typedef boost::variant<established, handshaking, boost::blank, idle> state2_t;
+
+void test_exceptions() {
+    boost::variant_fsm<state2_t, event_t, throwing_session> fsm((idle()));
+    BOOST_TEST_THROWS(fsm.process(connect()), std::runtime_error);
+    // The machine falls back to boost::blank, the preferred fallback state
+    BOOST_TEST_EQ(fsm.which(), 2);
+    BOOST_TEST(!fsm.process(connect()));
+
+    boost::variant_fsm<state2_t, event_t, throwing_session> fsm2((idle()));
+    connect c = { "peer" };
+    BOOST_TEST(fsm2.process(c));
+    BOOST_TEST_EQ(fsm2.which(), 1);
+    BOOST_TEST_THROWS(fsm2.process(ack()), std::runtime_error);
+    BOOST_TEST(boost::get<boost::blank>(&fsm2.state()));
+}
+
+// Counters are compiled out by default
+struct empty_transitions {};
+BOOST_STATIC_ASSERT(sizeof(boost::variant_fsm<state_t, event_t, empty_transitions>) == sizeof(state_t) + sizeof(void*)
+    || sizeof(boost::variant_fsm<state_t, event_t, empty_transitions>) == sizeof(state_t));
+
+int main() {
+    test_transitions();
+    test_exceptions();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,218 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/variant_instrumentation_test.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_VARIANT_INSTRUMENTATION
+
+#include "boost/variant/variant.hpp"
+#include "boost/variant/instrumentation.hpp"
+#include "boost/variant/static_visitor.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Copy may throw and there is no nothrow move nor a nothrow default
+// constructible bounded type: assignments use the heap backup.
+struct may_throw {
+    int value;
+    static bool fail;
+
+    explicit may_throw(int v) : value(v) {}
+    may_throw(const may_throw& other) : value(other.value) {
+        if (fail)
+            throw std::runtime_error("may_throw");
+    }
+    may_throw& operator=(const may_throw& other) {
+        value = other.value;
+        return *this;
+    }
+};
+
+bool may_throw::fail = false;
+
+struct named {
+    std::string name;
+
+    explicit named(const std::string& n) : name(n) {}
+    named(const named& other) : name(other.name) {}
+    named& operator=(const named& other) {
+        name = other.name;
+        return *this;
+    }
+};
+
+typedef boost::variant<int, std::string> basic_t;
+typedef boost::variant<may_throw, named> backup_t;
+
+struct size_visitor : boost::static_visitor<std::size_t> {
+    std::size_t operator()(int) const { return sizeof(int); }
+    std::size_t operator()(const std::string& s) const { return s.size(); }
+};
+
+void run_constructions_and_assignments()
+{
+    basic_t a(1);
+    basic_t b(a);                                   // copy construction
+    basic_t c(std::string("text"));
+    basic_t d(std::move(c));                        // move construction
+    BOOST_TEST(d.which() == 1);
+
+    a = b;                                          // same type 0 -> 0
+    a = d;                                          // cross type 0 -> 1
+    a = std::string("other");                       // direct same type 1 -> 1
+    a = 5;                                          // cross type 1 -> 0
+    a = basic_t(std::string("moved"));              // cross type 0 -> 1
+
+    size_visitor visitor;
+    BOOST_TEST(a.apply_visitor(visitor) == 5);
+    BOOST_TEST(b.apply_visitor(visitor) == sizeof(int));
+    BOOST_TEST(d.apply_visitor(visitor) == 4);
+}
+
+void test_builtin_counters()
+{
+    boost::reset_variant_instrumentation();
+    run_constructions_and_assignments();
+
+    const boost::variant_instrumentation_stats stats
+        = boost::variant_instrumentation_snapshot<basic_t>();
+
+    BOOST_TEST_EQ(stats.alternatives, 2u);
+    BOOST_TEST(stats.events[boost::variant_copy_construct] >= 1);
+    BOOST_TEST(stats.events[boost::variant_move_construct] >= 1);
+    BOOST_TEST_EQ(stats.events[boost::variant_same_type_assign], 2u);
+    BOOST_TEST_EQ(stats.events[boost::variant_cross_type_assign], 3u);
+    BOOST_TEST_EQ(stats.events[boost::variant_heap_backup], 0u);
+
+    BOOST_TEST_EQ(stats.transition(0, 0), 1u);
+    BOOST_TEST_EQ(stats.transition(0, 1), 2u);
+    BOOST_TEST_EQ(stats.transition(1, 1), 1u);
+    BOOST_TEST_EQ(stats.transition(1, 0), 1u);
+
+    BOOST_TEST_EQ(stats.visits[0], 1u);
+    BOOST_TEST_EQ(stats.visits[1], 2u);
+}
+
+void test_internal_visits()
+{
+    boost::reset_variant_instrumentation();
+
+    // Swaps, type() and comparisons are not user visitations
+    basic_t a(1);
+    basic_t b(2);
+    basic_t c(std::string("text"));
+    basic_t d(std::string("other"));
+
+    a.swap(b);
+    c.swap(d);
+    a.swap(c);
+    BOOST_TEST(a.type() == boost::typeindex::type_id<std::string>());
+    BOOST_TEST(!(a == d));
+    BOOST_TEST(b < c);
+    BOOST_TEST(a < d);
+
+    const boost::variant_instrumentation_stats stats
+        = boost::variant_instrumentation_snapshot<basic_t>();
+    BOOST_TEST_EQ(stats.visits[0], 0u);
+    BOOST_TEST_EQ(stats.visits[1], 0u);
+}
+
+void test_heap_backup()
+{
+    boost::reset_variant_instrumentation();
+
+    backup_t v(named("text"));
+    const backup_t w(may_throw(3));
+    const backup_t x(named("other"));
+
+    v = w;                                          // 1 -> 0
+    BOOST_TEST(v.which() == 0);
+    v = x;                                          // 0 -> 1
+    BOOST_TEST(v.which() == 1);
+
+    may_throw::fail = true;
+    BOOST_TEST_THROWS(v = w, std::runtime_error);   // restored from the backup
+    may_throw::fail = false;
+    BOOST_TEST(v.which() == 1);
+
+    const boost::variant_instrumentation_stats stats
+        = boost::variant_instrumentation_snapshot<backup_t>();
+    BOOST_TEST_EQ(stats.events[boost::variant_heap_backup], 3u);
+    BOOST_TEST_EQ(stats.events[boost::variant_cross_type_assign], 3u);
+    BOOST_TEST_EQ(stats.transition(1, 0), 2u);
+    BOOST_TEST_EQ(stats.transition(0, 1), 1u);
+}
+
+std::vector<int> hook_events;
+std::vector<int> hook_visits;
+int hook_transitions = 0;
+
+void on_event(const boost::typeindex::type_info&, boost::variant_event event, int)
+{
+    hook_events.push_back(event);
+}
+
+void on_visit(const boost::typeindex::type_info& type, int which)
+{
+    if (boost::typeindex::type_index(type) == boost::typeindex::type_id<basic_t>())
+        hook_visits.push_back(which);
+}
+
+void on_transition(const boost::typeindex::type_info&, int, int)
+{
+    ++hook_transitions;
+}
+
+void test_user_hooks()
+{
+    static const boost::variant_instrumentation_hooks hooks = { &on_event, &on_visit, &on_transition };
+
+    boost::reset_variant_instrumentation();
+    boost::set_variant_instrumentation_hooks(&hooks);
+    run_constructions_and_assignments();
+    boost::set_variant_instrumentation_hooks(nullptr);
+
+    BOOST_TEST_EQ(hook_transitions, 5);
+    BOOST_TEST_EQ(hook_visits.size(), 3u);
+    BOOST_TEST(!hook_events.empty());
+
+    // The built-in counters are not updated while the hooks are installed
+    const boost::variant_instrumentation_stats stats
+        = boost::variant_instrumentation_snapshot<basic_t>();
+    BOOST_TEST_EQ(stats.events[boost::variant_cross_type_assign], 0u);
+}
+
+void test_report()
+{
+    boost::reset_variant_instrumentation();
+    run_constructions_and_assignments();
+
+    std::ostringstream out;
+    boost::report_variant_instrumentation(out);
+    const std::string report = out.str();
+
+    BOOST_TEST(report.find(boost::typeindex::type_id<basic_t>().pretty_name()) != std::string::npos);
+    BOOST_TEST(report.find("cross type assignments: 3") != std::string::npos);
+    BOOST_TEST(report.find("heap backups") != std::string::npos);
+}
+
+int main()
+{
+    test_builtin_counters();
+    test_internal_visits();
+    test_heap_backup();
+    test_user_hooks();
+    test_report();
+
+    return boost::report_errors();
+}
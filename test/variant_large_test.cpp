@@ -0,0 +1,164 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/variant_large_test.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "boost/variant.hpp"
+#include "boost/core/lightweight_test.hpp"
+#include "boost/functional/hash.hpp"
+
+#include "boost/mpl/at.hpp"
+#include "boost/mpl/contains.hpp"
+#include "boost/mpl/front.hpp"
+#include "boost/mpl/joint_view.hpp"
+#include "boost/mpl/size.hpp"
+#include "boost/mpl/transform.hpp"
+#include "boost/mpl/vector.hpp"
+#include "boost/preprocessor/repetition/enum.hpp"
+#include "boost/static_assert.hpp"
+#include "boost/type_traits/is_nothrow_move_constructible.hpp"
+#include "boost/type_traits/is_same.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+template <int I>
+struct alt {
+    int value;
+
+    friend bool operator==(const alt& lhs, const alt& rhs) { return lhs.value == rhs.value; }
+    friend bool operator<(const alt& lhs, const alt& rhs) { return lhs.value < rhs.value; }
+    friend std::size_t hash_value(const alt& a) { return static_cast<std::size_t>(a.value); }
+};
+
+#define ALT(z, n, data) alt<n>
+
+// More bounded types than mpl::list allows
+typedef boost::variant< BOOST_PP_ENUM(64, ALT, ~) > large_t;
+
+typedef boost::make_recursive_variant<
+    BOOST_PP_ENUM(40, ALT, ~), std::vector<boost::recursive_variant_>
+>::type large_recursive_t;
+
+struct index_of : boost::static_visitor<int> {
+    template <int I>
+    int operator()(const alt<I>&) const { return I; }
+
+    template <class T>
+    int operator()(const std::vector<T>& v) const { return -static_cast<int>(v.size()); }
+};
+
+template <class T>
+struct add_pointer_f {
+    typedef T* type;
+};
+
+void test_large()
+{
+    large_t v;
+    BOOST_TEST_EQ(v.which(), 0);
+
+    v = alt<63>{ 5 };
+    BOOST_TEST_EQ(v.which(), 63);
+    BOOST_TEST_EQ(boost::apply_visitor(index_of(), v), 63);
+    BOOST_TEST_EQ(boost::get< alt<63> >(v).value, 5);
+    BOOST_TEST(!boost::get< alt<62> >(&v));
+
+    large_t copy = v;
+    BOOST_TEST(copy == v);
+    BOOST_TEST_EQ(boost::hash_value(copy), boost::hash_value(v));
+
+    large_t other = alt<40>{ 1 };
+    BOOST_TEST(other < v);
+    other.swap(copy);
+    BOOST_TEST_EQ(other.which(), 63);
+    BOOST_TEST_EQ(copy.which(), 40);
+}
+
+void test_large_recursive()
+{
+    large_recursive_t v = alt<39>{ 1 };
+    BOOST_TEST_EQ(boost::apply_visitor(index_of(), v), 39);
+
+    std::vector<large_recursive_t> children(3, v);
+    v = children;
+    BOOST_TEST_EQ(v.which(), 40);
+    BOOST_TEST_EQ(boost::apply_visitor(index_of(), v), -3);
+    BOOST_TEST(v == large_recursive_t(children));
+}
+
+void test_types_sequence()
+{
+    typedef large_t::types types;
+
+    BOOST_STATIC_ASSERT((boost::mpl::size<types>::value == 64));
+    BOOST_STATIC_ASSERT((boost::is_same<boost::mpl::front<types>::type, alt<0> >::value));
+    BOOST_STATIC_ASSERT((boost::is_same<boost::mpl::at_c<types, 40>::type, alt<40> >::value));
+    BOOST_STATIC_ASSERT((boost::mpl::contains<types, alt<63> >::value));
+    BOOST_STATIC_ASSERT((!boost::mpl::contains<types, int>::value));
+
+    typedef boost::mpl::transform<types, add_pointer_f<boost::mpl::_1> >::type pointers;
+    BOOST_STATIC_ASSERT((boost::mpl::size<pointers>::value == 64));
+    BOOST_STATIC_ASSERT((boost::is_same<boost::mpl::at_c<pointers, 7>::type, alt<7>*>::value));
+
+    // Sequences of variants still make variants over them
+    typedef boost::variant<int, std::string>::types small_types;
+    typedef boost::make_variant_over<
+        boost::mpl::joint_view<small_types, boost::mpl::vector<double> >
+    >::type over_t;
+
+    over_t o = 1.5;
+    BOOST_TEST_EQ(o.which(), 2);
+    o = std::string("text");
+    BOOST_TEST_EQ(boost::get<std::string>(o), "text");
+
+    BOOST_STATIC_ASSERT((boost::is_nothrow_move_constructible<boost::variant<int, double> >::value));
+    BOOST_STATIC_ASSERT((boost::is_nothrow_move_constructible<over_t>::value
+        == boost::is_nothrow_move_constructible<std::string>::value));
+}
+
+// Copy throws, no nothrow move: a failed assignment constructs the fallback type
+struct throwing_copy {
+    int value;
+
+    throwing_copy() : value(0) {}
+    throwing_copy(const throwing_copy&) { throw std::runtime_error("throwing_copy"); }
+    throwing_copy& operator=(const throwing_copy& other) { value = other.value; return *this; }
+};
+
+template <class Variant>
+void test_fallback()
+{
+    Variant v = std::string(100, 'a');
+    const Variant rhs; // holds throwing_copy
+
+    BOOST_TEST_THROWS(v = rhs, std::runtime_error);
+
+    // The fallback std::string is default constructed, not left uninitialized
+    BOOST_TEST_EQ(v.which(), 1);
+    BOOST_TEST(boost::get<std::string>(v).empty());
+
+    v = std::string("restored");
+    BOOST_TEST_EQ(boost::get<std::string>(v), "restored");
+}
+
+int main()
+{
+    test_large();
+    test_large_recursive();
+    test_types_sequence();
+
+    test_fallback< boost::variant<throwing_copy, std::string> >();
+    test_fallback< boost::make_variant_over<
+        boost::mpl::vector<throwing_copy, std::string>
+    >::type >();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,188 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/variant_likely_alternatives_test.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_VARIANT_PROFILE
+#define BOOST_VARIANT_PROFILE_OUTPUT ""
+
+#include "boost/variant/variant.hpp"
+#include "boost/variant/get.hpp"
+#include "boost/variant/recursive_wrapper.hpp"
+#include "boost/variant/visitation_profile.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+struct heartbeat { int seq; };
+struct quote { std::string symbol; double price; };
+struct tree;
+
+typedef boost::variant<heartbeat, quote, boost::recursive_wrapper<tree>, std::string> message_t;
+
+struct tree { int depth; };
+
+// Copy may throw and nothing is nothrow default constructible: leaves
+// the variant holding the backup after a failed assignment.
+struct fragile {
+    int value;
+    static bool fail;
+
+    explicit fragile(int v) : value(v) {}
+    fragile(const fragile& other) : value(other.value) {
+        if (fail)
+            throw std::runtime_error("fragile");
+    }
+    fragile& operator=(const fragile& other) {
+        value = other.value;
+        return *this;
+    }
+};
+
+bool fragile::fail = false;
+
+struct sturdy {
+    std::string text;
+    explicit sturdy(const std::string& t) : text(t) {}
+    sturdy(const sturdy& other) : text(other.text) {}
+    sturdy& operator=(const sturdy& other) {
+        text = other.text;
+        return *this;
+    }
+};
+
+typedef boost::variant<fragile, sturdy> backup_t;
+
+namespace boost {
+
+template <>
+struct variant_likely_alternatives<message_t>
+    : likely_alternatives<message_t, quote, tree>
+{
+};
+
+template <>
+struct variant_likely_alternatives<backup_t>
+    : likely_alternatives<backup_t, sturdy>
+{
+};
+
+} // namespace boost
+
+struct describe : boost::static_visitor<std::string> {
+    std::string operator()(const heartbeat& h) const { return "heartbeat " + std::to_string(h.seq); }
+    std::string operator()(const quote& q) const { return "quote " + q.symbol; }
+    std::string operator()(const tree& t) const { return "tree " + std::to_string(t.depth); }
+    std::string operator()(const std::string& s) const { return "text " + s; }
+};
+
+struct steal : boost::static_visitor<std::string> {
+    template <typename T>
+    std::string operator()(T&) const { return "lvalue"; }
+
+    std::string operator()(quote&& q) const {
+        std::string symbol = std::move(q.symbol);
+        return "moved " + symbol;
+    }
+
+    template <typename T>
+    std::string operator()(T&&) const { return "rvalue"; }
+};
+
+struct which_text : boost::static_visitor<std::string> {
+    std::string operator()(const fragile& f) const { return "fragile " + std::to_string(f.value); }
+    std::string operator()(const sturdy& s) const { return "sturdy " + s.text; }
+};
+
+void test_likely_dispatch()
+{
+    const describe visitor = describe();
+
+    message_t m = quote{ "ABC", 1.5 };
+    BOOST_TEST_EQ(m.apply_visitor(visitor), "quote ABC");
+
+    m = tree{ 3 };
+    BOOST_TEST_EQ(m.apply_visitor(visitor), "tree 3");
+
+    m = heartbeat{ 7 };
+    BOOST_TEST_EQ(boost::apply_visitor(visitor, m), "heartbeat 7");
+
+    const message_t c = std::string("hello");
+    BOOST_TEST_EQ(boost::apply_visitor(visitor, c), "text hello");
+
+    message_t q = quote{ "XYZ", 2.0 };
+    steal thief;
+    BOOST_TEST_EQ(q.apply_visitor(thief), "lvalue");
+    BOOST_TEST_EQ(std::move(q).apply_visitor(thief), "moved XYZ");
+    BOOST_TEST(boost::get<quote>(q).symbol.empty());
+}
+
+void test_backup_content()
+{
+    backup_t v(sturdy("first"));
+    const backup_t f(fragile(1));
+
+    fragile::fail = true;
+    BOOST_TEST_THROWS(v = f, std::runtime_error);
+    fragile::fail = false;
+
+    // v holds its backup now: the likely path must not be taken
+    BOOST_TEST_EQ(v.which(), 1);
+    BOOST_TEST_EQ(boost::apply_visitor(which_text(), v), "sturdy first");
+
+    v = f;
+    BOOST_TEST_EQ(boost::apply_visitor(which_text(), v), "fragile 1");
+}
+
+void test_profile()
+{
+    const describe visitor = describe();
+
+    message_t m = heartbeat{ 1 };
+    for (int i = 0; i < 20; ++i) {
+        if (i == 6)
+            m = quote{ "ABC", 1.0 };
+        BOOST_VARIANT_PROFILED_APPLY_VISITOR(visitor, m);
+    }
+
+    const message_t c = std::string("x");
+    BOOST_TEST_EQ(BOOST_VARIANT_PROFILED_APPLY_VISITOR(visitor, c), "text x");
+
+    std::ostringstream out;
+    boost::write_variant_profile(out);
+    const std::string profile = out.str();
+
+    const std::string variant_name = boost::typeindex::type_id<message_t>().pretty_name();
+    const std::string quote_name = boost::typeindex::type_id<quote>().pretty_name();
+    const std::string heartbeat_name = boost::typeindex::type_id<heartbeat>().pretty_name();
+
+    // Both call sites are listed
+    BOOST_TEST(profile.find("//   14 " + quote_name) != std::string::npos);
+    BOOST_TEST(profile.find("//   6 " + heartbeat_name) != std::string::npos);
+
+    // 14 + 6 + 1 visits: quote and heartbeat hold more than 25%
+    BOOST_TEST(profile.find(
+        "struct variant_likely_alternatives< " + variant_name + " >"
+    ) != std::string::npos);
+    BOOST_TEST(profile.find(
+        "likely_alternatives< " + variant_name + ", " + quote_name + ", " + heartbeat_name + " >"
+    ) != std::string::npos);
+}
+
+int main()
+{
+    test_likely_dispatch();
+    test_backup_content();
+    test_profile();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,189 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/variant_minimize_code_size_test.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_VARIANT_MINIMIZE_CODE_SIZE
+
+#include "boost/variant.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include "boost/mpl/vector.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct counted {
+    static int instances;
+    int value;
+
+    explicit counted(int v = 0) : value(v) { ++instances; }
+    counted(const counted& other) : value(other.value) { ++instances; }
+    ~counted() { --instances; }
+    counted& operator=(const counted& other) { value = other.value; return *this; }
+
+    friend bool operator==(const counted& lhs, const counted& rhs) { return lhs.value == rhs.value; }
+    friend bool operator<(const counted& lhs, const counted& rhs) { return lhs.value < rhs.value; }
+};
+
+int counted::instances = 0;
+
+// Copy may throw and there is no nothrow move nor a nothrow default
+// constructible bounded type: a failed assignment leaves the old content
+// in the heap backup.
+struct may_throw {
+    int value;
+    static bool fail;
+
+    explicit may_throw(int v) : value(v) {}
+    may_throw(const may_throw& other) : value(other.value) {
+        if (fail)
+            throw std::runtime_error("may_throw");
+    }
+    may_throw& operator=(const may_throw& other) { value = other.value; return *this; }
+
+    friend bool operator==(const may_throw& lhs, const may_throw& rhs) { return lhs.value == rhs.value; }
+    friend bool operator<(const may_throw& lhs, const may_throw& rhs) { return lhs.value < rhs.value; }
+};
+
+bool may_throw::fail = false;
+
+struct other_throw {
+    int value;
+
+    explicit other_throw(int v) : value(v) {}
+    other_throw(const other_throw& other) : value(other.value) {
+        if (may_throw::fail)
+            throw std::runtime_error("other_throw");
+    }
+    other_throw& operator=(const other_throw& other) { value = other.value; return *this; }
+
+    friend bool operator==(const other_throw& lhs, const other_throw& rhs) { return lhs.value == rhs.value; }
+    friend bool operator<(const other_throw& lhs, const other_throw& rhs) { return lhs.value < rhs.value; }
+};
+
+void test_lifecycle()
+{
+    typedef boost::variant<int, std::string, counted> variant_t;
+
+    {
+        variant_t v = counted(1);
+        BOOST_TEST_EQ(counted::instances, 1);
+
+        variant_t copy(v);
+        BOOST_TEST_EQ(counted::instances, 2);
+        BOOST_TEST(copy == v);
+        BOOST_TEST(copy.type() == boost::typeindex::type_id<counted>());
+
+        variant_t moved(std::move(copy));
+        BOOST_TEST_EQ(boost::get<counted>(moved).value, 1);
+
+        copy = counted(2);
+        moved = copy;                           // same type copy assignment
+        BOOST_TEST_EQ(boost::get<counted>(moved).value, 2);
+        BOOST_TEST(v < moved);
+
+        moved = variant_t(counted(3));          // same type move assignment
+        BOOST_TEST_EQ(boost::get<counted>(moved).value, 3);
+
+        moved = std::string("text");            // different type
+        BOOST_TEST_EQ(boost::get<std::string>(moved), "text");
+        BOOST_TEST(moved.type() == boost::typeindex::type_id<std::string>());
+        BOOST_TEST(moved < v);                  // std::string is before counted
+        BOOST_TEST(!(v == moved));
+
+        variant_t s = std::string("other");
+        s.swap(moved);                          // same type swap
+        BOOST_TEST_EQ(boost::get<std::string>(s), "text");
+        BOOST_TEST_EQ(boost::get<std::string>(moved), "other");
+
+        s.swap(v);                              // different types
+        BOOST_TEST_EQ(boost::get<counted>(s).value, 1);
+        BOOST_TEST_EQ(boost::get<std::string>(v), "text");
+    }
+
+    BOOST_TEST_EQ(counted::instances, 0);
+}
+
+void test_backup()
+{
+    typedef boost::variant<may_throw, other_throw> variant_t;
+
+    variant_t v = may_throw(1);
+    const variant_t rhs = other_throw(2);
+
+    may_throw::fail = true;
+    BOOST_TEST_THROWS(v = rhs, std::runtime_error);
+    may_throw::fail = false;
+
+    // The content is still may_throw(1), now held in the heap backup
+    BOOST_TEST_EQ(v.which(), 0);
+    BOOST_TEST_EQ(boost::get<may_throw>(v).value, 1);
+    BOOST_TEST(v.type() == boost::typeindex::type_id<may_throw>());
+
+    const variant_t copy(v);
+    BOOST_TEST(copy == v);
+    BOOST_TEST(!(copy < v));
+
+    variant_t same = may_throw(5);
+    v = same;                                   // same type assignment into the backup
+    BOOST_TEST_EQ(boost::get<may_throw>(v).value, 5);
+
+    same = may_throw(7);
+    v.swap(same);
+    BOOST_TEST_EQ(boost::get<may_throw>(v).value, 7);
+    BOOST_TEST_EQ(boost::get<may_throw>(same).value, 5);
+
+    v = rhs;
+    BOOST_TEST_EQ(boost::get<other_throw>(v).value, 2);
+}
+
+void test_wrappers()
+{
+    typedef boost::make_recursive_variant<
+        int, std::vector<boost::recursive_variant_>
+    >::type recursive_t;
+
+    std::vector<recursive_t> children(2, recursive_t(3));
+    recursive_t r = children;
+    recursive_t r_copy = r;
+    BOOST_TEST(r_copy == r);
+    BOOST_TEST(r_copy.type() == boost::typeindex::type_id< std::vector<recursive_t> >());
+
+    boost::get< std::vector<recursive_t> >(r_copy).push_back(recursive_t(1));
+    BOOST_TEST(r < r_copy);
+    r.swap(r_copy);
+    BOOST_TEST_EQ(boost::get< std::vector<recursive_t> >(r).size(), 3u);
+
+    int i = 1;
+    boost::variant<int&, std::string> ref = i;
+    boost::variant<int&, std::string> ref_copy = ref;
+    BOOST_TEST_EQ(&boost::get<int&>(ref_copy), &i);
+    BOOST_TEST(ref_copy.type() == boost::typeindex::type_id<int>());
+
+    typedef boost::make_variant_over< boost::mpl::vector<int, std::string, counted> >::type over_t;
+    over_t o = counted(4);
+    over_t o_copy = o;
+    BOOST_TEST(o_copy == o);
+    o = std::string("over");
+    BOOST_TEST(o < o_copy);
+    BOOST_TEST_EQ(counted::instances, 1);
+}
+
+int main()
+{
+    test_lifecycle();
+    test_backup();
+    test_wrappers();
+
+    BOOST_TEST_EQ(counted::instances, 0);
+    return boost::report_errors();
+}
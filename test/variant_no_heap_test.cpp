@@ -0,0 +1,117 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/variant_no_heap_test.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "boost/config.hpp"
+
+#include <cstddef>
+#include <new>
+
+static int allocations = 0;
+
+// Backup allocator counting the heap backups
+struct counting_backup_allocator {
+    static void* allocate(std::size_t size, std::size_t) {
+        ++allocations;
+        return ::operator new(size);
+    }
+
+    static void deallocate(void* p, std::size_t, std::size_t) BOOST_NOEXCEPT {
+        ::operator delete(p);
+    }
+};
+
+#define BOOST_VARIANT_NO_HEAP
+#define BOOST_VARIANT_BACKUP_ALLOCATOR counting_backup_allocator
+
+#include "boost/variant/variant.hpp"
+#include "boost/variant/get.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+// Nothrow copy, but a throwing move: backed up on the heap without
+// BOOST_VARIANT_NO_HEAP.
+struct copy_only {
+    int value;
+
+    explicit copy_only(int v) : value(v) {}
+    copy_only(const copy_only& other) BOOST_NOEXCEPT : value(other.value) {}
+    copy_only(copy_only&& other) BOOST_NOEXCEPT_IF(false) : value(other.value) {}
+    copy_only& operator=(const copy_only& other) { value = other.value; return *this; }
+};
+
+// Unlike std::runtime_error, does not allocate its message
+struct copy_failure {};
+
+struct may_throw {
+    int value;
+    static bool fail;
+
+    explicit may_throw(int v) : value(v) {}
+    may_throw(const may_throw& other) : value(other.value) {
+        if (fail)
+            throw copy_failure();
+    }
+    may_throw& operator=(const may_throw& other) { value = other.value; return *this; }
+};
+
+bool may_throw::fail = false;
+
+void test_stack_backup()
+{
+    typedef boost::variant<copy_only, may_throw> variant_t;
+
+    variant_t v = copy_only(1);
+    const variant_t rhs = may_throw(2);
+    const int before = allocations;
+
+    may_throw::fail = true;
+    BOOST_TEST_THROWS(v = rhs, copy_failure);
+    may_throw::fail = false;
+
+    // Restored from the stack backup
+    BOOST_TEST_EQ(v.which(), 0);
+    BOOST_TEST_EQ(boost::get<copy_only>(v).value, 1);
+
+    v = rhs;
+    BOOST_TEST_EQ(boost::get<may_throw>(v).value, 2);
+
+    v = copy_only(3);
+    BOOST_TEST_EQ(boost::get<copy_only>(v).value, 3);
+
+    variant_t other = may_throw(4);
+    v.swap(other);
+    BOOST_TEST_EQ(boost::get<may_throw>(v).value, 4);
+    BOOST_TEST_EQ(boost::get<copy_only>(other).value, 3);
+
+    BOOST_TEST_EQ(allocations, before);
+}
+
+void test_fallback()
+{
+    // may_throw assignments use the nothrow default constructible fallback
+    typedef boost::variant<may_throw, int> variant_t;
+
+    variant_t v = may_throw(1);
+    const int before = allocations;
+
+    v = 5;
+    v = may_throw(2);
+    BOOST_TEST_EQ(boost::get<may_throw>(v).value, 2);
+
+    BOOST_TEST_EQ(allocations, before);
+}
+
+int main()
+{
+    test_stack_backup();
+    test_fallback();
+
+    return boost::report_errors();
+}
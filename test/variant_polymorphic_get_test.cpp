@@ -14,6 +14,7 @@
 #include "boost/variant/apply_visitor.hpp"
 #include "boost/variant/static_visitor.hpp"
 #include "boost/variant/polymorphic_get.hpp"
+#include "boost/variant/recursive_wrapper.hpp"
 #include "boost/core/lightweight_test.hpp"
 
 struct base {int trash;};
@@ -25,6 +26,10 @@ struct vderived1 : virtual vbase{ virtual int foo() const { return 1; } };
 struct vderived2 : virtual vbase{ virtual int foo() const { return 3; } };
 struct vderived3 : vderived1, vderived2 { virtual int foo() const { return 3; } };
 
+// Base subobject at a non-zero offset
+struct other_base { double pad; };
+struct offset_derived : other_base, base {};
+
 template <class T, class Variant>
 inline void check_throws(Variant& v) {
     try {
@@ -36,6 +41,37 @@ inline void check_throws(Variant& v) {
     }
 }
 
+void test_wrapped_contents()
+{
+    offset_derived od;
+    od.trash = 5;
+
+    typedef boost::variant<int, offset_derived, boost::recursive_wrapper<derived1> > wvar_t;
+
+    wvar_t w = od;
+    BOOST_TEST_EQ(boost::polymorphic_get<base>(&w), static_cast<base*>(&boost::get<offset_derived>(w)));
+    BOOST_TEST_EQ(boost::polymorphic_get<base>(w).trash, 5);
+    BOOST_TEST(boost::polymorphic_get<other_base>(&w));
+
+    derived1 d1;
+    d1.trash = 6;
+    w = d1;
+    BOOST_TEST_EQ(boost::polymorphic_get<base>(&w), &boost::get<derived1>(w));
+    BOOST_TEST_EQ(boost::polymorphic_get<const base>(w).trash, 6);
+    BOOST_TEST(!boost::polymorphic_get<other_base>(&w));
+
+    w = 1;
+    BOOST_TEST(!boost::polymorphic_get<base>(&w));
+    BOOST_TEST_EQ(boost::polymorphic_get<int>(w), 1);
+
+    derived2 d2;
+    d2.trash = 7;
+    boost::variant<int, derived2&> r = d2;
+    BOOST_TEST_EQ(boost::polymorphic_relaxed_get<base>(&r), &d2);
+    const boost::variant<int, derived2&>& cr = r;
+    BOOST_TEST_EQ(boost::polymorphic_relaxed_get<const base>(&cr), &d2);
+}
+
 int main()
 {
     typedef boost::variant<int, base, derived1, derived2> var_t;
@@ -77,5 +113,7 @@ int main()
     BOOST_TEST(boost::polymorphic_get<const vbase>(cv).foo() == 3);
     BOOST_TEST(boost::polymorphic_get<const vbase>(v).foo() == 3);
 
+    test_wrapped_contents();
+
     return boost::report_errors();
 }
@@ -0,0 +1,201 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/variant_queue_test.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "boost/variant/variant_queue.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct tick {
+    long long value;
+};
+
+struct bomb {
+    explicit bomb(bool explode) {
+        if (explode) throw std::runtime_error("bomb");
+    }
+};
+
+struct counted {
+    static int alive;
+
+    counted() { ++alive; }
+    counted(const counted&) { ++alive; }
+    ~counted() { --alive; }
+};
+int counted::alive = 0;
+
+typedef boost::variant<tick, std::string, bomb, counted> message_t;
+typedef boost::variant_queue<tick, std::string, bomb, counted> queue_t;
+
+struct collector {
+    std::vector<std::string> seen;
+
+    void operator()(tick& t) { seen.push_back(std::to_string(t.value)); }
+    void operator()(std::string& s) { seen.push_back(std::move(s)); }
+    void operator()(bomb&) { seen.push_back("bomb"); }
+    void operator()(counted&) { seen.push_back("counted"); }
+};
+
+struct thrower {
+    template <class T>
+    void operator()(T&) const { throw std::runtime_error("visitor"); }
+};
+
+void test_single_thread() {
+    queue_t q(3);
+    BOOST_TEST_EQ(q.capacity(), 4u);
+    BOOST_TEST(q.empty());
+
+    tick t = { 42 };
+    BOOST_TEST(q.emplace<tick>(t));
+    BOOST_TEST(q.emplace<std::string>(5, 'x'));
+    BOOST_TEST(q.push(message_t(std::string("pushed"))));
+    const message_t copied(tick{ 7 });
+    BOOST_TEST(q.push(copied));
+    BOOST_TEST(!q.emplace<tick>(t));
+    BOOST_TEST(!q.empty());
+
+    collector c;
+    BOOST_TEST(q.consume_one(c));
+    BOOST_TEST_EQ(c.seen.size(), 1u);
+    BOOST_TEST_EQ(c.seen[0], "42");
+
+    BOOST_TEST_EQ(q.consume_all(c), 3u);
+    BOOST_TEST_EQ(c.seen.size(), 4u);
+    BOOST_TEST_EQ(c.seen[1], "xxxxx");
+    BOOST_TEST_EQ(c.seen[2], "pushed");
+    BOOST_TEST_EQ(c.seen[3], "7");
+    BOOST_TEST(q.empty());
+    BOOST_TEST(!q.consume_one(c));
+    BOOST_TEST_EQ(q.consume_all(c), 0u);
+
+    // Wrapping around the ring buffer
+    for (int i = 0; i < 10; ++i) {
+        tick v = { i };
+        BOOST_TEST(q.emplace<tick>(v));
+        BOOST_TEST(q.emplace<tick>(v));
+        BOOST_TEST_EQ(q.consume_all(c), 2u);
+        BOOST_TEST_EQ(c.seen.back(), std::to_string(i));
+    }
+}
+
+void test_exceptions() {
+    {
+        queue_t q(4);
+        BOOST_TEST_THROWS(q.emplace<bomb>(true), std::runtime_error);
+        BOOST_TEST(q.emplace<bomb>(false));
+
+        // The slot of the failed construction is skipped, and not counted
+        collector c;
+        BOOST_TEST_EQ(q.consume_all(c), 1u);
+        BOOST_TEST_EQ(c.seen.size(), 1u);
+        BOOST_TEST_EQ(c.seen[0], "bomb");
+
+        BOOST_TEST_THROWS(q.emplace<bomb>(true), std::runtime_error);
+        BOOST_TEST(!q.consume_one(c));
+        BOOST_TEST_EQ(q.consume_all(c), 0u);
+
+        BOOST_TEST_THROWS(q.emplace<bomb>(true), std::runtime_error);
+        tick t = { 3 };
+        BOOST_TEST(q.emplace<tick>(t));
+        BOOST_TEST(q.consume_one(c));
+        BOOST_TEST_EQ(c.seen.back(), "3");
+        BOOST_TEST(q.empty());
+    }
+
+    {
+        queue_t q(8);
+        for (int i = 0; i < 5; ++i) {
+            BOOST_TEST(q.emplace<counted>());
+        }
+        BOOST_TEST_EQ(counted::alive, 5);
+
+        // The messages are destroyed even if the visitor throws
+        BOOST_TEST_THROWS(q.consume_one(thrower()), std::runtime_error);
+        BOOST_TEST_EQ(counted::alive, 4);
+        BOOST_TEST_THROWS(q.consume_all(thrower()), std::runtime_error);
+        BOOST_TEST_EQ(counted::alive, 0);
+        BOOST_TEST(q.empty());
+
+        BOOST_TEST(q.emplace<counted>());
+        BOOST_TEST(q.emplace<counted>());
+    }
+    // Destructor destroys the rest
+    BOOST_TEST_EQ(counted::alive, 0);
+}
+
+struct summer {
+    long long sum;
+    long long count;
+
+    void operator()(tick& t) { sum += t.value; ++count; }
+    void operator()(std::string& s) { sum += static_cast<long long>(s.size()); ++count; }
+    void operator()(bomb&) {}
+    void operator()(counted&) {}
+};
+
+void test_concurrent() {
+    queue_t q(64);
+    const int producers = 4;
+    const int consumers = 4;
+    const int messages_per_producer = 20000;
+    std::atomic<long long> consumed(0);
+    std::atomic<long long> total(0);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.push_back(std::thread([&q]() {
+            for (int i = 1; i <= messages_per_producer; ++i) {
+                if (i % 2) {
+                    tick t = { i };
+                    while (!q.emplace<tick>(t)) std::this_thread::yield();
+                } else {
+                    while (!q.emplace<std::string>(static_cast<std::size_t>(i % 100), 'a')) std::this_thread::yield();
+                }
+            }
+        }));
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.push_back(std::thread([&]() {
+            summer s = { 0, 0 };
+            while (consumed.load() < static_cast<long long>(producers) * messages_per_producer) {
+                const std::size_t n = q.consume_all(s);
+                consumed += static_cast<long long>(n);
+                if (!n) std::this_thread::yield();
+            }
+            total += s.sum;
+        }));
+    }
+    for (std::size_t t = 0; t < threads.size(); ++t) {
+        threads[t].join();
+    }
+
+    long long expected = 0;
+    for (int i = 1; i <= messages_per_producer; ++i) {
+        expected += (i % 2) ? i : i % 100;
+    }
+    BOOST_TEST_EQ(consumed.load(), static_cast<long long>(producers) * messages_per_producer);
+    BOOST_TEST_EQ(total.load(), expected * producers);
+    BOOST_TEST(q.empty());
+}
+
+int main() {
+    test_single_thread();
+    test_exceptions();
+    test_concurrent();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,152 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/variant_ref_test.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "boost/variant/variant_ref.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include "boost/static_assert.hpp"
+#include "boost/type_traits/is_trivially_copyable.hpp"
+
+#include <string>
+#include <vector>
+
+struct node { int key; long payload; };
+struct leaf { double value; };
+struct branch { node* children[2]; };
+
+typedef boost::variant_ref<node, leaf, branch> ref_t;
+
+// The index fits into the low bits of the address
+BOOST_STATIC_ASSERT((sizeof(ref_t) == sizeof(void*)));
+BOOST_STATIC_ASSERT((sizeof(ref_t) < sizeof(boost::variant<node&, leaf&, branch&>)));
+BOOST_STATIC_ASSERT((boost::is_trivially_copyable<ref_t>::value));
+
+// Not enough alignment: a second word
+typedef boost::variant_ref<char, int> small_ref_t;
+BOOST_STATIC_ASSERT((sizeof(small_ref_t) == 2 * sizeof(void*)));
+BOOST_STATIC_ASSERT((boost::is_trivially_copyable<small_ref_t>::value));
+
+// A single type needs no index
+BOOST_STATIC_ASSERT((sizeof(boost::variant_ref<char>) == sizeof(void*)));
+
+struct describe : boost::static_visitor<std::string> {
+    std::string operator()(const node&) const { return "node"; }
+    std::string operator()(const leaf&) const { return "leaf"; }
+    std::string operator()(const branch&) const { return "branch"; }
+};
+
+struct bump : boost::static_visitor<> {
+    void operator()(node& n) const { ++n.key; }
+    void operator()(leaf& l) const { l.value += 1; }
+    void operator()(branch&) const {}
+};
+
+void test_visit_and_get()
+{
+    node n = { 1, 2 };
+    leaf l = { 0.5 };
+    branch b = { { &n, 0 } };
+
+    std::vector<ref_t> refs;
+    refs.push_back(n);
+    refs.push_back(l);
+    refs.push_back(b);
+
+    BOOST_TEST_EQ(refs[0].which(), 0);
+    BOOST_TEST_EQ(refs[1].which(), 1);
+    BOOST_TEST_EQ(refs[2].which(), 2);
+    BOOST_TEST_EQ(refs[2].address(), static_cast<void*>(&b));
+
+    BOOST_TEST_EQ(boost::apply_visitor(describe(), refs[0]), "node");
+    BOOST_TEST_EQ(boost::apply_visitor(describe(), refs[1]), "leaf");
+    BOOST_TEST_EQ(boost::apply_visitor(describe(), refs[2]), "branch");
+
+    // Visitation and get refer to the objects
+    for (std::size_t i = 0; i < refs.size(); ++i)
+        boost::apply_visitor(bump(), refs[i]);
+    BOOST_TEST_EQ(n.key, 2);
+    BOOST_TEST_EQ(l.value, 1.5);
+
+    BOOST_TEST_EQ(&boost::get<node>(refs[0]), &n);
+    BOOST_TEST_EQ(boost::get<leaf>(&refs[1]), &l);
+    BOOST_TEST(!boost::get<leaf>(&refs[0]));
+    BOOST_TEST_THROWS(boost::get<branch>(refs[0]), boost::bad_get);
+
+    // Rebinding by assignment
+    ref_t r = refs[0];
+    r = refs[2];
+    BOOST_TEST_EQ(boost::get<branch>(r).children[0], &n);
+    BOOST_TEST_EQ(n.key, 2);
+}
+
+void test_unpacked()
+{
+    char c = 'x';
+    int i = 5;
+
+    small_ref_t r = c;
+    BOOST_TEST_EQ(r.which(), 0);
+    BOOST_TEST_EQ(boost::get<char>(r), 'x');
+
+    r = i;
+    boost::get<int>(r) = 6;
+    BOOST_TEST_EQ(i, 6);
+    BOOST_TEST(!boost::get<char>(&r));
+}
+
+void test_const()
+{
+    const node n = { 3, 4 };
+    leaf l = { 2.5 };
+
+    typedef boost::variant_ref<const node, const leaf> const_ref_t;
+    const_ref_t r = n;
+    BOOST_TEST_EQ(boost::get<const node>(r).key, 3);
+    BOOST_TEST_EQ(boost::apply_visitor(describe(), r), "node");
+
+    // Non-const objects bind to const types
+    r = l;
+    BOOST_TEST_EQ(boost::get<const leaf>(r).value, 2.5);
+}
+
+void test_from_variant()
+{
+    typedef boost::variant<node, leaf, branch> variant_t;
+
+    variant_t v = leaf();
+    ref_t r = v;
+    BOOST_TEST_EQ(r.which(), 1);
+    BOOST_TEST_EQ(&boost::get<leaf>(r), &boost::get<leaf>(v));
+
+    boost::apply_visitor(bump(), r);
+    BOOST_TEST_EQ(boost::get<leaf>(v).value, 1.0);
+
+    // Types may be in another order, or more
+    boost::variant<branch, node> other = node();
+    boost::get<node>(other).key = 7;
+    r = other;
+    BOOST_TEST_EQ(r.which(), 0);
+    BOOST_TEST_EQ(boost::get<node>(r).key, 7);
+
+    const variant_t cv = node();
+    const boost::variant_ref<const node, const leaf, const branch> cr = cv;
+    BOOST_TEST_EQ(&boost::get<const node>(cr), &boost::get<node>(cv));
+}
+
+int main()
+{
+    test_visit_and_get();
+    test_unpacked();
+    test_const();
+    test_from_variant();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,275 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/variant_relocation_test.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "boost/variant/variant.hpp"
+#include "boost/variant/get.hpp"
+#include "boost/variant/recursive_wrapper.hpp"
+#include "boost/variant/trivially_relocatable.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include "boost/static_assert.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+int moves = 0;
+int copies = 0;
+bool throw_on_move = false;
+
+// Owns a heap value: relocatable, but with a throwing move
+struct handle {
+    int* value;
+
+    explicit handle(int v = 0) : value(new int(v)) {}
+    handle(const handle& other) : value(new int(*other.value)) { ++copies; }
+    handle(handle&& other) : value(other.value) {
+        if (throw_on_move)
+            throw std::runtime_error("move");
+        other.value = 0;
+        ++moves;
+    }
+    handle& operator=(const handle& other) { handle temp(other); std::swap(value, temp.value); return *this; }
+    handle& operator=(handle&& other) { std::swap(value, other.value); return *this; }
+    ~handle() { delete value; }
+};
+
+namespace boost {
+template <>
+struct is_trivially_relocatable<handle> : mpl::true_ {};
+}
+
+// Points into itself: not relocatable
+struct anchored {
+    anchored* self;
+    int value;
+
+    explicit anchored(int v = 0) : self(this), value(v) {}
+    anchored(const anchored& other) : self(this), value(other.value) { ++copies; }
+    anchored(anchored&& other) : self(this), value(other.value) {
+        if (throw_on_move)
+            throw std::runtime_error("move");
+        ++moves;
+    }
+    anchored& operator=(const anchored& other) { value = other.value; return *this; }
+
+    bool valid() const { return self == this; }
+};
+
+BOOST_STATIC_ASSERT((boost::is_trivially_relocatable<int>::value));
+BOOST_STATIC_ASSERT((boost::is_trivially_relocatable< boost::recursive_wrapper<std::string> >::value));
+BOOST_STATIC_ASSERT((!boost::is_trivially_relocatable<anchored>::value));
+BOOST_STATIC_ASSERT((boost::is_trivially_relocatable< boost::variant<int, handle> >::value));
+BOOST_STATIC_ASSERT((boost::is_trivially_relocatable< boost::variant<int, boost::recursive_wrapper<anchored> > >::value));
+BOOST_STATIC_ASSERT((!boost::is_trivially_relocatable< boost::variant<int, anchored> >::value));
+
+void test_swap()
+{
+    typedef boost::variant<int, handle> variant_t;
+
+    // Relocatable contents are swapped without moves
+    variant_t a(handle(5));
+    variant_t b(7);
+    moves = 0;
+    a.swap(b);
+    BOOST_TEST_EQ(moves, 0);
+    BOOST_TEST_EQ(boost::get<int>(a), 7);
+    BOOST_TEST_EQ(*boost::get<handle>(b).value, 5);
+
+    swap(a, b);
+    BOOST_TEST_EQ(moves, 0);
+    BOOST_TEST_EQ(*boost::get<handle>(a).value, 5);
+    BOOST_TEST_EQ(boost::get<int>(b), 7);
+}
+
+struct page { char bytes[4096]; };
+struct tag {};
+
+void test_sized_swap()
+{
+    typedef boost::variant<int, page, tag, handle> variant_t;
+
+    // Only the bytes of the contents are exchanged, whatever their sizes
+    page p;
+    p.bytes[0] = 'a';
+    p.bytes[4095] = 'z';
+
+    variant_t a(1);
+    variant_t b(p);
+    a.swap(b);
+    BOOST_TEST_EQ(boost::get<page>(a).bytes[4095], 'z');
+    BOOST_TEST_EQ(boost::get<int>(b), 1);
+
+    variant_t c = tag();
+    a.swap(c);
+    BOOST_TEST_EQ(a.which(), 2);
+    BOOST_TEST_EQ(boost::get<page>(c).bytes[0], 'a');
+
+    variant_t h(handle(3));
+    moves = 0;
+    h.swap(c);
+    BOOST_TEST_EQ(moves, 0);
+    BOOST_TEST_EQ(boost::get<page>(h).bytes[4095], 'z');
+    BOOST_TEST_EQ(*boost::get<handle>(c).value, 3);
+}
+
+void test_mixed_swap()
+{
+    typedef boost::variant<handle, anchored> variant_t;
+
+    // A single move, of the content that is not relocatable
+    variant_t a(handle(1));
+    variant_t b(anchored(2));
+    moves = 0;
+    a.swap(b);
+    BOOST_TEST_EQ(moves, 1);
+    BOOST_TEST(boost::get<anchored>(a).valid());
+    BOOST_TEST_EQ(boost::get<anchored>(a).value, 2);
+    BOOST_TEST_EQ(*boost::get<handle>(b).value, 1);
+
+    moves = 0;
+    b.swap(a);
+    BOOST_TEST_EQ(moves, 1);
+    BOOST_TEST(boost::get<anchored>(b).valid());
+    BOOST_TEST_EQ(*boost::get<handle>(a).value, 1);
+
+    // Strong guarantee if the move throws
+    throw_on_move = true;
+    BOOST_TEST_THROWS(a.swap(b), std::runtime_error);
+    throw_on_move = false;
+    BOOST_TEST_EQ(*boost::get<handle>(a).value, 1);
+    BOOST_TEST(boost::get<anchored>(b).valid());
+    BOOST_TEST_EQ(boost::get<anchored>(b).value, 2);
+}
+
+void test_assign()
+{
+    // Neither content has a nothrow copy or move, and no fallback type:
+    // the assignments relocate a temporary copy instead of a heap backup.
+    typedef boost::variant<handle, anchored> variant_t;
+
+    variant_t v(anchored(3));
+    const variant_t h(handle(4));
+
+    copies = 0;
+    moves = 0;
+    v = h;
+    BOOST_TEST_EQ(copies, 1);
+    BOOST_TEST_EQ(moves, 0);
+    BOOST_TEST_EQ(*boost::get<handle>(v).value, 4);
+
+    v = anchored(5);
+    BOOST_TEST(boost::get<anchored>(v).valid());
+
+    variant_t source(handle(6));
+    moves = 0;
+    v = std::move(source);
+    BOOST_TEST_EQ(moves, 1);
+    BOOST_TEST_EQ(*boost::get<handle>(v).value, 6);
+
+    // Strong guarantee if the move throws
+    v = anchored(7);
+    variant_t other(handle(8));
+    throw_on_move = true;
+    BOOST_TEST_THROWS(v = std::move(other), std::runtime_error);
+    throw_on_move = false;
+    BOOST_TEST_EQ(boost::get<anchored>(v).value, 7);
+    BOOST_TEST_EQ(*boost::get<handle>(other).value, 8);
+}
+
+template <typename T>
+struct raw_buffer {
+    union { T items[4]; };
+    raw_buffer() {}
+    ~raw_buffer() {}
+};
+
+void test_relocate_range()
+{
+    typedef boost::variant<int, handle> variant_t;
+
+    raw_buffer<variant_t> from;
+    raw_buffer<variant_t> to;
+    new (&from.items[0]) variant_t(1);
+    new (&from.items[1]) variant_t(handle(2));
+    new (&from.items[2]) variant_t(3);
+
+    moves = 0;
+    variant_t* end = boost::relocate_range(from.items, from.items + 3, to.items);
+    BOOST_TEST_EQ(end, to.items + 3);
+    BOOST_TEST_EQ(moves, 0);
+    BOOST_TEST_EQ(boost::get<int>(to.items[0]), 1);
+    BOOST_TEST_EQ(*boost::get<handle>(to.items[1]).value, 2);
+    BOOST_TEST_EQ(boost::get<int>(to.items[2]), 3);
+
+    // Overlapping ranges
+    end = boost::relocate_range(to.items, to.items + 3, to.items + 1);
+    BOOST_TEST_EQ(*boost::get<handle>(to.items[2]).value, 2);
+    for (variant_t* it = to.items + 1; it != end; ++it)
+        it->~variant_t();
+
+    // Not relocatable: moves and destructions
+    typedef boost::variant<int, anchored> anchored_t;
+
+    raw_buffer<anchored_t> src;
+    raw_buffer<anchored_t> dst;
+    new (&src.items[0]) anchored_t(anchored(1));
+    new (&src.items[1]) anchored_t(2);
+
+    moves = 0;
+    anchored_t* dst_end = boost::relocate_range(src.items, src.items + 2, dst.items);
+    BOOST_TEST_EQ(dst_end, dst.items + 2);
+    BOOST_TEST_EQ(moves, 1);
+    BOOST_TEST(boost::get<anchored>(dst.items[0]).valid());
+    BOOST_TEST_EQ(boost::get<int>(dst.items[1]), 2);
+    dst.items[0].~anchored_t();
+    dst.items[1].~anchored_t();
+}
+
+void test_vector()
+{
+    typedef boost::variant<int, handle, std::string> variant_t;
+
+    std::vector<variant_t> values;
+    for (int i = 0; i < 100; ++i) {
+        if (i % 3 == 0)
+            values.push_back(handle(i));
+        else if (i % 3 == 1)
+            values.push_back(std::string(40, 'a'));
+        else
+            values.push_back(i);
+    }
+
+    std::vector<variant_t> reversed(values.rbegin(), values.rend());
+    for (std::size_t i = 0; i < values.size() / 2; ++i)
+        swap(values[i], values[values.size() - 1 - i]);
+
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        BOOST_TEST_EQ(values[i].which(), reversed[i].which());
+        if (const handle* h = boost::get<handle>(&values[i]))
+            BOOST_TEST_EQ(*h->value, *boost::get<handle>(reversed[i]).value);
+        else if (const std::string* s = boost::get<std::string>(&values[i]))
+            BOOST_TEST_EQ(*s, boost::get<std::string>(reversed[i]));
+    }
+}
+
+int main()
+{
+    test_swap();
+    test_sized_swap();
+    test_mixed_swap();
+    test_assign();
+    test_relocate_range();
+    test_vector();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,128 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/variant_seqlock_test.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "boost/variant/seqlock_variant.hpp"
+#include "boost/variant/apply_visitor.hpp"
+#include "boost/variant/get.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+struct route {
+    unsigned address;
+    unsigned short port;
+    int weights[8];
+};
+
+struct redirect {
+    long long target;
+    double ratio;
+};
+
+struct disabled {};
+
+typedef boost::variant<disabled, route, redirect, long double> config_t;
+typedef boost::seqlock_variant<disabled, route, redirect, long double> shared_config_t;
+
+route make_route(int n) {
+    route r;
+    r.address = static_cast<unsigned>(n);
+    r.port = static_cast<unsigned short>(n);
+    for (int i = 0; i < 8; ++i) {
+        r.weights[i] = n;
+    }
+    return r;
+}
+
+// Checks that the snapshot is not torn: all the fields come from one store
+struct consistency_checker : boost::static_visitor<bool> {
+    bool operator()(disabled) const { return true; }
+    bool operator()(long double v) const { return v == 1.5L; }
+    bool operator()(const redirect& r) const { return r.ratio == static_cast<double>(r.target); }
+    bool operator()(const route& r) const {
+        for (int i = 0; i < 8; ++i) {
+            if (r.weights[i] != static_cast<int>(r.address)) return false;
+        }
+        return static_cast<unsigned short>(r.address) == r.port;
+    }
+};
+
+void test_operations() {
+    shared_config_t c;
+    BOOST_TEST_EQ(c.which(), 0);
+    BOOST_TEST(boost::get<disabled>(&static_cast<const config_t&>(c.load())));
+
+    c.store(make_route(5));
+    BOOST_TEST_EQ(c.which(), 1);
+    BOOST_TEST_EQ(boost::get<route>(c.load()).weights[7], 5);
+    BOOST_TEST(boost::apply_visitor(consistency_checker(), c));
+
+    redirect r = { 7, 7.0 };
+    c = config_t(r);
+    BOOST_TEST_EQ(boost::get<redirect>(static_cast<config_t>(c)).target, 7);
+
+    c.store(1.5L);
+    BOOST_TEST_EQ(boost::get<long double>(c.load()), 1.5L);
+
+    const shared_config_t initialized(make_route(3));
+    BOOST_TEST_EQ(boost::get<route>(initialized.load()).port, 3);
+}
+
+void test_concurrent_readers() {
+    shared_config_t c(make_route(0));
+    std::atomic<bool> stop(false);
+    std::atomic<int> torn(0);
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.push_back(std::thread([&]() {
+            consistency_checker checker;
+            while (!stop.load(std::memory_order_relaxed)) {
+                if (!c.apply_visitor(checker)) {
+                    ++torn;
+                }
+            }
+        }));
+    }
+
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 2; ++t) {
+        writers.push_back(std::thread([&c, t]() {
+            for (int i = 0; i < 20000; ++i) {
+                if (i % 3 == 0) {
+                    redirect r = { i, static_cast<double>(i) };
+                    c.store(r);
+                } else {
+                    c.store(make_route(i * 2 + t));
+                }
+            }
+        }));
+    }
+
+    for (std::size_t t = 0; t < writers.size(); ++t) {
+        writers[t].join();
+    }
+    stop = true;
+    for (std::size_t t = 0; t < readers.size(); ++t) {
+        readers[t].join();
+    }
+
+    BOOST_TEST_EQ(torn.load(), 0);
+}
+
+int main() {
+    test_operations();
+    test_concurrent_readers();
+
+    return boost::report_errors();
+}
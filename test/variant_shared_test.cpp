@@ -0,0 +1,211 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/variant_shared_test.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "boost/variant/shared_variant.hpp"
+#include "boost/variant/apply_visitor.hpp"
+#include "boost/variant/get.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+typedef std::vector<int> table_t;
+typedef std::map<std::string, int> index_t;
+
+typedef boost::variant<std::string, table_t, index_t> config_t;
+typedef boost::shared_variant<std::string, table_t, index_t> shared_config_t;
+
+table_t make_table(int n) {
+    return table_t(256, n);
+}
+
+index_t make_index(int n) {
+    index_t result;
+    for (int i = 0; i < 32; ++i) {
+        result[std::to_string(i)] = n;
+    }
+    return result;
+}
+
+// Checks that the value was not modified or destroyed while being visited
+struct consistency_checker : boost::static_visitor<bool> {
+    bool operator()(const std::string& s) const {
+        return s.empty() || s == std::string(64, s[0]);
+    }
+
+    bool operator()(const table_t& t) const {
+        if (t.size() != 256) return false;
+        for (std::size_t i = 0; i < t.size(); ++i) {
+            if (t[i] != t[0]) return false;
+        }
+        return true;
+    }
+
+    bool operator()(const index_t& m) const {
+        if (m.size() != 32) return false;
+        for (index_t::const_iterator it = m.begin(); it != m.end(); ++it) {
+            if (it->second != m.begin()->second) return false;
+        }
+        return true;
+    }
+};
+
+struct address_getter : boost::static_visitor<const void*> {
+    template <class T>
+    const void* operator()(const T& v) const { return &v; }
+};
+
+struct incrementer {
+    void operator()(config_t& v) const {
+        table_t& t = boost::get<table_t>(v);
+        for (std::size_t i = 0; i < t.size(); ++i) {
+            ++t[i];
+        }
+    }
+};
+
+void test_operations() {
+    shared_config_t c;
+    BOOST_TEST_EQ(c.which(), 0);
+    BOOST_TEST(boost::get<std::string>(c.load()).empty());
+
+    c.store(make_table(5));
+    BOOST_TEST_EQ(c.which(), 1);
+    BOOST_TEST_EQ(boost::get<table_t>(c.load())[255], 5);
+    BOOST_TEST(boost::apply_visitor(consistency_checker(), c));
+
+    c = config_t(make_index(7));
+    BOOST_TEST_EQ(boost::get<index_t>(c.load()).at("31"), 7);
+
+    config_t s(std::string(64, 'x'));
+    c = std::move(s);
+    BOOST_TEST_EQ(boost::get<std::string>(c.load()), std::string(64, 'x'));
+
+    c.store(make_table(1));
+    c.update(incrementer());
+    BOOST_TEST_EQ(boost::get<table_t>(c.load())[0], 2);
+
+    const shared_config_t initialized(config_t(make_table(3)));
+    BOOST_TEST_EQ(boost::get<table_t>(initialized.load()).size(), 256u);
+}
+
+void test_zero_copy_reads() {
+    const shared_config_t c(config_t(make_table(1)));
+
+    // Visitation and guards access the published version in place
+    const void* const visited = boost::apply_visitor(address_getter(), c);
+    {
+        shared_config_t::read_guard guard(c);
+        BOOST_TEST_EQ(&boost::get<table_t>(*guard), visited);
+        BOOST_TEST_EQ(guard->which(), 1);
+        BOOST_TEST_EQ(boost::get<table_t>(guard.get()).size(), 256u);
+    }
+}
+
+void test_guard_keeps_version_alive() {
+    shared_config_t c(config_t(make_table(1)));
+    std::atomic<bool> stored(false);
+
+    std::unique_ptr<shared_config_t::read_guard> guard(new shared_config_t::read_guard(c));
+    std::thread writer([&c, &stored]() {
+        c.store(make_table(2));
+        stored = true;
+    });
+
+    // The writer waits for the guard, the old version is still intact
+    for (int i = 0; i < 100 && !stored.load(); ++i) {
+        std::this_thread::yield();
+    }
+    BOOST_TEST(!stored.load());
+    BOOST_TEST_EQ(boost::get<table_t>(guard->get())[0], 1);
+    BOOST_TEST(consistency_checker()(boost::get<table_t>(guard->get())));
+
+    guard.reset();
+    writer.join();
+    BOOST_TEST(stored.load());
+    BOOST_TEST_EQ(boost::get<table_t>(c.load())[0], 2);
+}
+
+void test_concurrent_readers() {
+    shared_config_t c(config_t(make_table(0)));
+    std::atomic<bool> stop(false);
+    std::atomic<int> inconsistent(0);
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.push_back(std::thread([&]() {
+            consistency_checker checker;
+            while (!stop.load(std::memory_order_relaxed)) {
+                if (!c.apply_visitor(checker)) {
+                    ++inconsistent;
+                }
+            }
+        }));
+    }
+
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 2; ++t) {
+        writers.push_back(std::thread([&c, t]() {
+            for (int i = 0; i < 300; ++i) {
+                switch (i % 3) {
+                case 0: c.store(make_index(i)); break;
+                case 1: c.store(std::string(64, static_cast<char>('a' + t))); break;
+                default: c.store(make_table(i)); break;
+                }
+            }
+        }));
+    }
+
+    for (std::size_t t = 0; t < writers.size(); ++t) {
+        writers[t].join();
+    }
+    stop = true;
+    for (std::size_t t = 0; t < readers.size(); ++t) {
+        readers[t].join();
+    }
+
+    BOOST_TEST_EQ(inconsistent.load(), 0);
+}
+
+void test_concurrent_updates() {
+    shared_config_t c(config_t(make_table(0)));
+
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 4; ++t) {
+        writers.push_back(std::thread([&c]() {
+            for (int i = 0; i < 500; ++i) {
+                c.update(incrementer());
+            }
+        }));
+    }
+    for (std::size_t t = 0; t < writers.size(); ++t) {
+        writers[t].join();
+    }
+
+    // No update is lost
+    const table_t result = boost::get<table_t>(c.load());
+    BOOST_TEST_EQ(result[0], 2000);
+    BOOST_TEST(consistency_checker()(result));
+}
+
+int main() {
+    test_operations();
+    test_zero_copy_reads();
+    test_guard_keeps_version_alive();
+    test_concurrent_readers();
+    test_concurrent_updates();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,205 @@
+//-----------------------------------------------------------------------------
+// boost-libs variant/test/variant_trivial_content_test.cpp source file
+// See http://www.boost.org for updates, documentation, and revision history.
+//-----------------------------------------------------------------------------
+//
+// Copyright (c) 2026 agent
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "boost/variant/variant.hpp"
+#include "boost/variant/get.hpp"
+#include "boost/core/lightweight_test.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+int copies = 0;
+int moves = 0;
+int destructions = 0;
+
+struct counted {
+    std::string value;
+
+    explicit counted(const std::string& v = std::string()) : value(v) {}
+    counted(const counted& other) : value(other.value) { ++copies; }
+    counted(counted&& other) : value(std::move(other.value)) { ++moves; }
+    counted& operator=(const counted& other) { value = other.value; ++copies; return *this; }
+    counted& operator=(counted&& other) { value = std::move(other.value); ++moves; return *this; }
+    ~counted() { ++destructions; }
+};
+
+struct point { int x; int y; };
+
+typedef boost::variant<int, double, point, counted> variant_t;
+
+void reset()
+{
+    copies = 0;
+    moves = 0;
+    destructions = 0;
+}
+
+void test_construct_and_destroy()
+{
+    std::vector<variant_t> events;
+    for (int i = 0; i < 20; ++i) {
+        if (i % 10 == 9)
+            events.push_back(counted("event"));
+        else if (i % 2)
+            events.push_back(i * 0.5);
+        else
+            events.push_back(i);
+    }
+    const point p = { 1, 2 };
+    events.push_back(p);
+
+    reset();
+    {
+        std::vector<variant_t> copy(events);
+        BOOST_TEST_EQ(copies, 2);
+        BOOST_TEST_EQ(destructions, 0);
+
+        for (std::size_t i = 0; i < copy.size(); ++i) {
+            BOOST_TEST_EQ(copy[i].which(), events[i].which());
+            if (const counted* c = boost::get<counted>(&copy[i]))
+                BOOST_TEST_EQ(c->value, "event");
+        }
+        BOOST_TEST_EQ(boost::get<int>(copy[4]), 4);
+        BOOST_TEST_EQ(boost::get<double>(copy[7]), 3.5);
+        BOOST_TEST_EQ(boost::get<point>(copy[20]).y, 2);
+    }
+    BOOST_TEST_EQ(destructions, 2);
+
+    variant_t moved_from(counted("moved"));
+    reset();
+    variant_t moved(std::move(moved_from));
+    BOOST_TEST_EQ(moves, 1);
+    BOOST_TEST_EQ(boost::get<counted>(moved).value, "moved");
+
+    variant_t scalar(2.5);
+    variant_t moved_scalar(std::move(scalar));
+    BOOST_TEST_EQ(moves, 1);
+    BOOST_TEST_EQ(boost::get<double>(moved_scalar), 2.5);
+}
+
+void test_assign()
+{
+    variant_t v(1);
+    const variant_t d(1.5);
+    const variant_t c(counted("text"));
+
+    reset();
+
+    // Between trivially copyable contents
+    v = d;
+    BOOST_TEST_EQ(boost::get<double>(v), 1.5);
+    v = variant_t(3);
+    BOOST_TEST_EQ(boost::get<int>(v), 3);
+    v = v;
+    BOOST_TEST_EQ(boost::get<int>(v), 3);
+    BOOST_TEST_EQ(copies + moves + destructions, 0);
+
+    // To and from a content that is not
+    v = c;
+    BOOST_TEST_EQ(copies, 1);
+    BOOST_TEST_EQ(boost::get<counted>(v).value, "text");
+
+    v = d;
+    BOOST_TEST_EQ(destructions, 1);
+    BOOST_TEST_EQ(boost::get<double>(v), 1.5);
+
+    reset();
+    v = c;
+    v = c;
+    BOOST_TEST_EQ(copies, 2);
+    v = variant_t(7);
+    BOOST_TEST_EQ(boost::get<int>(v), 7);
+}
+
+struct block { char bytes[512]; };
+struct empty {};
+
+void test_sizes()
+{
+    // Only the bytes of the active content are copied
+    typedef boost::variant<int, block, empty, counted> sized_variant_t;
+
+    sized_variant_t i(5);
+    sized_variant_t copy(i);
+    BOOST_TEST_EQ(boost::get<int>(copy), 5);
+
+    block b;
+    b.bytes[0] = 'a';
+    b.bytes[511] = 'z';
+    copy = sized_variant_t(b);
+    BOOST_TEST_EQ(boost::get<block>(copy).bytes[511], 'z');
+
+    sized_variant_t e = empty();
+    copy = e;
+    BOOST_TEST_EQ(copy.which(), 2);
+    copy = i;
+    copy = copy;
+    BOOST_TEST_EQ(boost::get<int>(copy), 5);
+}
+
+bool throw_on_copy = false;
+
+// Trivial destructor, but a throwing copy: may be held in a heap backup
+struct fragile {
+    int value;
+
+    explicit fragile(int v) : value(v) {}
+    fragile(const fragile& other) : value(other.value) {
+        if (throw_on_copy)
+            throw std::runtime_error("copy");
+    }
+    fragile& operator=(const fragile& other) { value = other.value; return *this; }
+};
+
+struct brittle {
+    int value;
+
+    explicit brittle(int v) : value(v) {}
+    brittle(const brittle& other) : value(other.value) {
+        if (throw_on_copy)
+            throw std::runtime_error("copy");
+    }
+    brittle& operator=(const brittle& other) { value = other.value; return *this; }
+};
+
+void test_backup()
+{
+    typedef boost::variant<fragile, brittle> backup_variant_t;
+
+    backup_variant_t v(fragile(1));
+    const backup_variant_t b(brittle(2));
+
+    v = b;
+    BOOST_TEST_EQ(boost::get<brittle>(v).value, 2);
+
+    // The failed assignment leaves the previous content in its backup,
+    // which the copy and the destructor do not take as trivial.
+    v = fragile(3);
+    throw_on_copy = true;
+    BOOST_TEST_THROWS(v = b, std::runtime_error);
+    throw_on_copy = false;
+    BOOST_TEST_EQ(boost::get<fragile>(v).value, 3);
+
+    backup_variant_t copy(v);
+    BOOST_TEST_EQ(boost::get<fragile>(copy).value, 3);
+}
+
+int main()
+{
+    test_construct_and_destroy();
+    test_assign();
+    test_sizes();
+    test_backup();
+
+    return boost::report_errors();
+}